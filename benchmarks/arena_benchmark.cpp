@@ -0,0 +1,82 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include "arena.h"
+#include "benchmark.h"
+#include "deque.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct SonarPing {
+        float range;
+        float bearing;
+        unsigned timestamp;
+    };
+
+    // Fills a scratch deque with one frame of pings and reads it back
+    template<typename Container>
+    unsigned fillFrame(Container& scratch, size_t nodesPerFrame) {
+        for (size_t i = 0; i < nodesPerFrame; i++) scratch.push_back(SonarPing{1.0f, 2.0f, static_cast<unsigned>(i)});
+        return scratch.back().timestamp;
+    }
+
+    // Runs frame(nodesPerFrame) until about operations nodes have been built and thrown away
+    template<typename Frame>
+    double frames(size_t nodesPerFrame, size_t operations, Frame&& frame) {
+        const size_t frameCount = std::max<size_t>(1, operations / nodesPerFrame);
+        return measure(frameCount * nodesPerFrame, [&] {
+            unsigned sum = 0;
+            for (size_t i = 0; i < frameCount; i++) sum += frame(nodesPerFrame);
+            doNotOptimize(sum);
+        });
+    }
+}
+
+void runArenaBenchmark() {
+    std::cout << "=== Per-frame scratch Deque: heap vs NodePool vs arena rollback (ns per node) ===" << std::endl;
+    const size_t operations = 1 << 21;
+    for (size_t nodes : {64, 4096, 262144}) {
+        std::string suffix = " (" + std::to_string(nodes) + " per frame)";
+        report("std::allocator" + suffix, frames(nodes, operations, [](size_t n) {
+            Deque<SonarPing, std::allocator> scratch;
+            return fillFrame(scratch, n);
+        }));
+        report("NodePool" + suffix, frames(nodes, operations, [](size_t n) {
+            Deque<SonarPing> scratch;
+            return fillFrame(scratch, n);
+        }));
+        Arena arena;
+        report("Arena + ArenaScope" + suffix, frames(nodes, operations, [&](size_t n) {
+            ArenaScope frameScope(arena);
+            Deque<SonarPing, ArenaAllocator> scratch(arena);
+            return fillFrame(scratch, n);
+        }));
+    }
+
+    std::cout << "=== Tearing down a full Deque: clear() vs arena reset ===" << std::endl;
+    for (size_t nodes : {4096, 262144}) {
+        std::string suffix = " (" + std::to_string(nodes) + " nodes)";
+        const size_t rounds = std::max<size_t>(1, (1 << 22) / nodes);
+        Deque<SonarPing> pooled;
+        report("NodePool clear()" + suffix, measure(rounds * nodes, [&] {
+            for (size_t r = 0; r < rounds; r++) {
+                for (size_t i = 0; i < nodes; i++) pooled.push_back(SonarPing{1.0f, 2.0f, static_cast<unsigned>(i)});
+                pooled.clear();
+            }
+        }));
+        Arena arena;
+        Deque<SonarPing, ArenaAllocator> scratch(arena);
+        report("Arena clear() + reset()" + suffix, measure(rounds * nodes, [&] {
+            for (size_t r = 0; r < rounds; r++) {
+                for (size_t i = 0; i < nodes; i++) scratch.push_back(SonarPing{1.0f, 2.0f, static_cast<unsigned>(i)});
+                scratch.clear();
+                arena.reset();
+            }
+        }));
+    }
+}
@@ -0,0 +1,75 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+/* Notes:
+ * Tiny timing helpers shared by the benchmark files, so every benchmark prints the same way.
+ * measure - Runs a function a few times and returns the best wall time in nanoseconds per operation.
+ * report - Prints one aligned result line (name, ns/op and millions of ops per second).
+ * doNotOptimize - Stops the compiler from throwing away a value that is only computed for timing.
+ */
+
+namespace CommandaStructures::Bench {
+
+    /*
+     * Name: doNotOptimize
+     * Description: Forces the compiler to treat the value as used, so the work that produced it is not optimized away.
+     * Parameters: value - The value to keep alive.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    /*
+     * Name: measure
+     * Description: Runs func() repeats times and keeps the fastest run, which filters out scheduler noise.
+     * Parameters: operations - The number of operations one call of func() performs.
+     *             func - The work to time.
+     *             repeats - How many times to run func() (default is 5).
+     * Returns: double - Nanoseconds per operation of the fastest run.
+     */
+    template<typename Func>
+    double measure(size_t operations, Func&& func, int repeats = 5) {
+        double best = 0.0;
+        for (int i = 0; i < repeats; i++) {
+            auto start = std::chrono::steady_clock::now();
+            func();
+            auto stop = std::chrono::steady_clock::now();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(operations);
+            best = (i == 0) ? ns : std::min(best, ns);
+        }
+        return best;
+    }
+
+    /*
+     * Name: report
+     * Description: Prints a single result line.
+     * Parameters: name - What was measured.
+     *             nsPerOp - Nanoseconds per operation (from measure()).
+     * Returns: void - No return value.
+     */
+    inline void report(const std::string& name, double nsPerOp) {
+        std::cout << "  " << std::left << std::setw(48) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2) << nsPerOp << " ns/op"
+                  << std::setw(10) << std::setprecision(1) << (nsPerOp > 0.0 ? 1000.0 / nsPerOp : 0.0) << " Mops/s" << std::endl;
+    }
+
+}
+
+#endif //BENCHMARK_H
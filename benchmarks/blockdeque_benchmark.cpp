@@ -0,0 +1,83 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include "benchmark.h"
+#include "blockdeque.h"
+#include "deque.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    // Sliding window: fill to depth at the back, then every new sample pushes out the oldest one at the front
+    template<typename Container>
+    double slidingWindow(size_t depth, size_t operations) {
+        Container deque;
+        for (size_t i = 0; i < depth; i++) deque.push_back(static_cast<float>(i));
+        return measure(operations, [&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < operations; i++) {
+                deque.push_back(static_cast<float>(i));
+                sum += deque.pop_front();
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    // Fill to depth, then drain from the back (undo history, LIFO use of the deque)
+    template<typename Container>
+    double fillDrainBack(size_t depth) {
+        Container deque;
+        return measure(2 * depth, [&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < depth; i++) deque.push_front(static_cast<float>(i));
+            for (size_t i = 0; i < depth; i++) sum += deque.pop_back();
+            doNotOptimize(sum);
+        });
+    }
+
+    // Sums every element through the iterator
+    template<typename Container>
+    double traverse(Container& deque) {
+        return measure(deque.getSize(), [&] {
+            float sum = 0.0f;
+            for (float value : deque) sum += value;
+            doNotOptimize(sum);
+        });
+    }
+}
+
+void runBlockDequeBenchmark() {
+    std::cout << "=== Deque (list nodes) vs BlockDeque (chunks), float elements ===" << std::endl;
+    for (size_t depth : {size_t{64}, size_t{100000}}) {
+        const std::string suffix = " (" + std::to_string(depth) + ")";
+        report("Deque sliding window" + suffix, slidingWindow<Deque<float>>(depth, 1 << 20));
+        report("BlockDeque sliding window" + suffix, slidingWindow<BlockDeque<float>>(depth, 1 << 20));
+        report("Deque fill front, drain back" + suffix, fillDrainBack<Deque<float>>(depth));
+        report("BlockDeque fill front, drain back" + suffix, fillDrainBack<BlockDeque<float>>(depth));
+    }
+
+    const size_t count = 1000000;
+    Deque<float> listDeque;
+    BlockDeque<float> blockDeque;
+    for (size_t i = 0; i < count; i++) {
+        listDeque.push_back(static_cast<float>(i));
+        blockDeque.push_back(static_cast<float>(i));
+    }
+    std::cout << "=== Reading 1000000 elements (ns per element) ===" << std::endl;
+    report("Deque iterator", traverse(listDeque));
+    report("BlockDeque iterator", traverse(blockDeque));
+    report("BlockDeque chunk spans", measure(count, [&] {
+        float sum = 0.0f;
+        for (size_t k = 0; k < blockDeque.chunkCount(); k++) {
+            for (float value : blockDeque.chunk(k)) sum += value;
+        }
+        doNotOptimize(sum);
+    }));
+    report("BlockDeque operator[], strided", measure(count, [&] {
+        float sum = 0.0f;
+        for (size_t i = 0, index = 0; i < count; i++, index = (index + 7919) % count) sum += blockDeque[index];
+        doNotOptimize(sum);
+    }));
+}
@@ -0,0 +1,100 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <vector>
+#include "benchmark.h"
+#include "cache.h"
+#include "doublelinkedlist.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct TileEntry {
+        unsigned id;
+        unsigned checksum;
+        bool operator==(const TileEntry& other) const { return id == other.id; }
+    };
+
+    // Tile requests while panning around a chart: most land on a small working set, the rest anywhere
+    std::vector<unsigned> makeRequests(size_t count, unsigned tiles) {
+        std::vector<unsigned> requests;
+        requests.reserve(count);
+        unsigned random = 2463534242u;
+        for (size_t i = 0; i < count; i++) {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            const bool hot = random % 10 < 8;
+            requests.push_back(hot ? random / 10 % (tiles / 8) : random / 10 % tiles);
+        }
+        return requests;
+    }
+
+    // get, and put on a miss, for every request
+    template<typename CacheType>
+    double lookupOrLoad(CacheType& cache, const std::vector<unsigned>& requests) {
+        return measure(requests.size(), [&] {
+            unsigned sum = 0;
+            for (unsigned id : requests) {
+                if (const unsigned* checksum = cache.get(id)) {
+                    sum += *checksum;
+                } else {
+                    sum += cache.put(id, id * 31);
+                }
+            }
+            doNotOptimize(sum);
+        });
+    }
+}
+
+void runCacheBenchmark() {
+    const size_t capacity = 256;
+    const unsigned tiles = 4096;
+    const std::vector<unsigned> requests = makeRequests(1 << 18, tiles);
+
+    std::cout << "=== Tile cache, 256 entries, 80% of requests on 512 tiles (ns per request) ===" << std::endl;
+    // The hand-rolled version: scan the list for the tile, move a hit to the front by removing and reinserting it
+    DoubleLinkedList<TileEntry> list;
+    const std::vector<unsigned> fewerRequests(requests.begin(), requests.begin() + (1 << 13));
+    report("DoubleLinkedList findNode + reinsert", measure(fewerRequests.size(), [&] {
+        unsigned sum = 0;
+        for (unsigned id : fewerRequests) {
+            DoubleNode<TileEntry>* node = list.findNode(TileEntry{id, 0});
+            TileEntry entry{id, id * 31};
+            if (node) {
+                entry = node->getData();
+                list.removeNode(node);
+            } else if (list.getSize() >= capacity) {
+                list.removeNode(list.getTail());
+            }
+            list.insert(entry, DoubleLinkedList<TileEntry>::HEAD);
+            sum += entry.checksum;
+        }
+        doNotOptimize(sum);
+    }));
+    LruCache<unsigned, unsigned> lru(capacity);
+    report("LruCache", lookupOrLoad(lru, requests));
+    LfuCache<unsigned, unsigned> lfu(capacity);
+    report("LfuCache", lookupOrLoad(lfu, requests));
+
+    std::cout << "=== Hit rate on the same requests ===" << std::endl;
+    std::cout << "LRU " << 100.0 * static_cast<double>(lru.getHits()) / static_cast<double>(lru.getHits() + lru.getMisses())
+              << "%, LFU " << 100.0 * static_cast<double>(lfu.getHits()) / static_cast<double>(lfu.getHits() + lfu.getMisses())
+              << "%" << std::endl;
+
+    std::cout << "=== Locking cost, one thread (ns per request) ===" << std::endl;
+    ShardedCache<unsigned, unsigned> sharded(capacity, 16);
+    report("ShardedCache<LRU>, 16 shards", measure(requests.size(), [&] {
+        unsigned sum = 0;
+        for (unsigned id : requests) {
+            unsigned checksum;
+            if (sharded.get(id, checksum)) {
+                sum += checksum;
+            } else {
+                sharded.put(id, id * 31);
+            }
+        }
+        doNotOptimize(sum);
+    }));
+}
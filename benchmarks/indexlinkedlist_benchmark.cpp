@@ -0,0 +1,67 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "doublelinkedlist.h"
+#include "indexlinkedlist.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    template<typename List>
+    double traverse(const List& list) {
+        return measure(list.getSize(), [&] {
+            float sum = 0.0f;
+            for (auto it = list.cbegin(); it != list.cend(); ++it) sum += *it;
+            doNotOptimize(sum);
+        });
+    }
+
+    // Edits in random places: remove a node and insert a new one after another random node, count times.
+    // Leaves both lists with the same contents in the same, scrambled, memory order.
+    void scramble(DoubleLinkedList<float>& pointerList, std::vector<DoubleNode<float>*>& pointers,
+                  IndexLinkedList<float>& indexList, std::vector<uint32_t>& handles, size_t count) {
+        std::mt19937 rng(7);
+        for (size_t i = 0; i < count; i++) {
+            const size_t victim = rng() % pointers.size();
+            const size_t anchor = rng() % pointers.size();
+            if (victim == anchor) continue;
+            pointerList.removeNode(pointers[victim]);
+            indexList.removeNode(handles[victim]);
+            pointerList.insertAfter(pointers[anchor], static_cast<float>(i));
+            pointers[victim] = pointers[anchor]->next;
+            handles[victim] = indexList.insertAfter(handles[anchor], static_cast<float>(i));
+        }
+    }
+}
+
+void runIndexLinkedListBenchmark() {
+    std::cout << "=== DoubleLinkedList vs IndexLinkedList (ns per element) ===" << std::endl;
+    std::cout << "  Node size: DoubleNode<float> " << sizeof(DoubleNode<float>) << " bytes, IndexNode<float> "
+              << sizeof(IndexLinkedList<float>::Node) << " bytes" << std::endl;
+    for (size_t count : {size_t{10000}, size_t{1000000}}) {
+        const std::string suffix = " (" + std::to_string(count) + ")";
+        DoubleLinkedList<float> pointerList;
+        IndexLinkedList<float> indexList;
+        std::vector<DoubleNode<float>*> pointers;
+        std::vector<uint32_t> handles;
+        for (size_t i = 0; i < count; i++) {
+            pointerList.insert(static_cast<float>(i));
+            pointers.push_back(pointerList.getTail());
+            handles.push_back(indexList.insert(static_cast<float>(i)));
+        }
+        report("DoubleLinkedList, in order" + suffix, traverse(pointerList));
+        report("IndexLinkedList, in order" + suffix, traverse(indexList));
+
+        double pointerEdit = measure(count, [&] { scramble(pointerList, pointers, indexList, handles, count); }, 1);
+        report("Random remove + insertAfter, both lists" + suffix, pointerEdit);
+        report("DoubleLinkedList, after edits" + suffix, traverse(pointerList));
+        report("IndexLinkedList, after edits" + suffix, traverse(indexList));
+        indexList.compact();
+        report("IndexLinkedList, after compact()" + suffix, traverse(indexList));
+    }
+}
@@ -0,0 +1,96 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "doublelinkedlist.h"
+#include "intrusivedoublelist.h"
+#include "intrusivelist.h"
+#include "linkedlist.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct Command {
+        float values[14];
+        unsigned sequence;
+        SingleHook<Command> hook;
+        DoubleHook<Command> doubleHook;
+        bool operator==(const Command& other) const { return sequence == other.sequence; }
+    };
+
+    using IntrusiveQueue = IntrusiveList<Command, &Command::hook>;
+    using IntrusiveDeque = IntrusiveDoubleList<Command, &Command::doubleHook>;
+}
+
+void runIntrusiveListBenchmark() {
+    std::cout << "=== Intrusive vs copying lists (ns per operation, intrusive checks "
+              << (COMMANDA_INTRUSIVE_CHECKS ? "on" : "off") << ") ===" << std::endl;
+    const size_t operations = 1 << 20;
+    std::vector<Command> commands(64);
+    for (size_t i = 0; i < commands.size(); i++) commands[i].sequence = static_cast<unsigned>(i);
+
+    // FIFO hand-off: push at the back, pop at the front, 64 commands in flight
+    {
+        LinkedList<Command> list;
+        for (Command& command : commands) list.insert(command, LinkedList<Command>::HEAD);
+        report("LinkedList<Command> insert HEAD + remove head", measure(operations, [&] {
+            unsigned sum = 0;
+            for (size_t i = 0; i < operations; i++) {
+                Command& command = commands[i % commands.size()];
+                sum += list.getHead()->data.sequence;
+                list.removeNode(list.getHead());
+                list.insert(command, LinkedList<Command>::HEAD);
+            }
+            doNotOptimize(sum);
+        }));
+    }
+    {
+        IntrusiveQueue list;
+        for (Command& command : commands) list.insert(command);
+        report("IntrusiveList pop_front + insert", measure(operations, [&] {
+            unsigned sum = 0;
+            for (size_t i = 0; i < operations; i++) {
+                Command& command = list.pop_front();
+                sum += command.sequence;
+                list.insert(command);
+            }
+            doNotOptimize(sum);
+        }));
+    }
+
+    // Cancel from a random position and re-add at the back, 1024 entries
+    std::vector<Command> many(1024);
+    for (size_t i = 0; i < many.size(); i++) many[i].sequence = static_cast<unsigned>(i);
+    std::vector<size_t> victims(operations);
+    std::mt19937 rng(11);
+    for (size_t& victim : victims) victim = rng() % many.size();
+    {
+        DoubleLinkedList<Command> list;
+        std::vector<DoubleNode<Command>*> nodes(many.size());
+        for (size_t i = 0; i < many.size(); i++) {
+            list.insert(many[i]);
+            nodes[i] = list.getTail();
+        }
+        report("DoubleLinkedList removeNode + insert (copy)", measure(operations, [&] {
+            for (size_t victim : victims) {
+                list.removeNode(nodes[victim]);
+                list.insert(many[victim]);
+                nodes[victim] = list.getTail();
+            }
+        }));
+    }
+    {
+        IntrusiveDeque list;
+        for (Command& command : many) list.insert(command);
+        report("IntrusiveDoubleList remove + insert", measure(operations, [&] {
+            for (size_t victim : victims) {
+                list.remove(many[victim]);
+                list.insert(many[victim]);
+            }
+        }));
+    }
+}
@@ -0,0 +1,132 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "lockfreequeue.h"
+#include "queue.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    // Today's setup: one global lock around a Queue
+    class LockedQueue {
+    public:
+        void push(const unsigned& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push(value);
+        }
+        bool try_pop(unsigned& out) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.isEmpty()) return false;
+            out = queue.pop();
+            return true;
+        }
+    private:
+        std::mutex mutex;
+        Queue<unsigned> queue;
+    };
+
+    // Michael & Scott's two-lock queue: producers and consumers take different locks, the dummy node keeps them apart
+    class TwoLockQueue {
+    public:
+        TwoLockQueue() : head(new Node{0, nullptr}), tail(head) {}
+        ~TwoLockQueue() {
+            while (head) {
+                Node* next = head->next.load(std::memory_order_relaxed);
+                delete head;
+                head = next;
+            }
+        }
+        void push(const unsigned& value) {
+            Node* node = new Node{value, nullptr};
+            std::lock_guard<std::mutex> lock(tailMutex);
+            tail->next.store(node, std::memory_order_release); // Read by a consumer holding the other lock
+            tail = node;
+        }
+        bool try_pop(unsigned& out) {
+            std::unique_lock<std::mutex> lock(headMutex);
+            Node* first = head;
+            Node* next = first->next.load(std::memory_order_acquire);
+            if (!next) return false;
+            out = next->value;
+            head = next;
+            lock.unlock();
+            delete first;
+            return true;
+        }
+    private:
+        struct Node {
+            unsigned value;
+            std::atomic<Node*> next;
+        };
+        alignas(64) std::mutex headMutex;
+        Node* head;
+        alignas(64) std::mutex tailMutex;
+        Node* tail;
+    };
+
+    // producers threads push items between them, consumers threads pop until every item has been seen
+    template<typename QueueType>
+    double transfer(size_t producers, size_t consumers, size_t items) {
+        QueueType queue;
+        return measure(items, [&] {
+            std::atomic<size_t> consumed{0};
+            std::vector<std::thread> threads;
+            for (size_t p = 0; p < producers; p++) {
+                threads.emplace_back([&, p] {
+                    for (size_t i = p; i < items; i += producers) queue.push(static_cast<unsigned>(i));
+                });
+            }
+            for (size_t c = 0; c < consumers; c++) {
+                threads.emplace_back([&] {
+                    unsigned value = 0;
+                    unsigned checksum = 0;
+                    while (consumed.load(std::memory_order_relaxed) < items) {
+                        if (queue.try_pop(value)) {
+                            checksum += value;
+                            consumed.fetch_add(1, std::memory_order_relaxed);
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+                    doNotOptimize(checksum);
+                });
+            }
+            for (auto& thread : threads) thread.join();
+        }, 3);
+    }
+
+    // Single-threaded reference: the plain Queue with no lock and no threads
+    double singleThreaded(size_t items) {
+        Queue<unsigned> queue;
+        return measure(items, [&] {
+            unsigned checksum = 0;
+            for (size_t i = 0; i < items; i++) {
+                queue.push(static_cast<unsigned>(i));
+                if (queue.getSize() > 64) checksum += queue.pop();
+            }
+            while (!queue.isEmpty()) checksum += queue.pop();
+            doNotOptimize(checksum);
+        });
+    }
+}
+
+void runLockFreeQueueBenchmark() {
+    std::cout << "=== LockFreeQueue vs two-lock queue vs mutex-wrapped Queue (P producers / C consumers) ===" << std::endl;
+    std::cout << "  hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    const size_t items = 1 << 18;
+    report("Queue, single thread (no lock)", singleThreaded(items));
+    const std::pair<size_t, size_t> configurations[] = {{1, 1}, {2, 2}, {4, 4}, {8, 8}, {4, 1}, {1, 4}};
+    for (auto [producers, consumers] : configurations) {
+        std::string suffix = " (" + std::to_string(producers) + "P/" + std::to_string(consumers) + "C)";
+        report("mutex Queue" + suffix, transfer<LockedQueue>(producers, consumers, items));
+        report("two-lock queue" + suffix, transfer<TwoLockQueue>(producers, consumers, items));
+        report("LockFreeQueue" + suffix, transfer<LockFreeQueue<unsigned>>(producers, consumers, items));
+    }
+}
@@ -0,0 +1,72 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "lockfreestack.h"
+#include "stack.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    // Today's setup: the shared free-work stack is a Stack behind one mutex
+    class LockedStack {
+    public:
+        void push(const unsigned& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            stack.push(value);
+        }
+        bool try_pop(unsigned& out) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stack.isEmpty()) return false;
+            out = stack.pop();
+            return true;
+        }
+    private:
+        std::mutex mutex;
+        Stack<unsigned, std::allocator> stack; // new/delete per node, same as LockFreeStack
+    };
+
+    // Every thread pushes a work item and pops one back, over and over (a worker returning and taking work)
+    template<typename StackType>
+    double churn(size_t threadCount, size_t operations) {
+        StackType stack;
+        for (unsigned i = 0; i < 64; i++) stack.push(i); // Some work already queued, so pops rarely see an empty stack
+        const size_t perThread = operations / threadCount / 2;
+        double ns = measure(perThread * threadCount * 2, [&] {
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < threadCount; t++) {
+                threads.emplace_back([&, t] {
+                    unsigned value = 0;
+                    unsigned checksum = 0;
+                    for (size_t i = 0; i < perThread; i++) {
+                        stack.push(static_cast<unsigned>(t + i));
+                        if (stack.try_pop(value)) checksum += value;
+                    }
+                    doNotOptimize(checksum);
+                });
+            }
+            for (auto& thread : threads) thread.join();
+        }, 3);
+        return ns;
+    }
+}
+
+void runLockFreeStackBenchmark() {
+    std::cout << "=== LockFreeStack vs mutex-wrapped Stack (push+pop per thread) ===" << std::endl;
+    std::cout << "  hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    const size_t operations = 1 << 20;
+    struct NoElimination : LockFreeStack<unsigned> {
+        NoElimination() : LockFreeStack<unsigned>(false) {}
+    };
+    for (size_t threads = 1; threads <= 32; threads *= 2) {
+        std::string suffix = " (" + std::to_string(threads) + " threads)";
+        report("mutex Stack" + suffix, churn<LockedStack>(threads, operations));
+        report("LockFreeStack, no elimination" + suffix, churn<NoElimination>(threads, operations));
+        report("LockFreeStack, elimination" + suffix, churn<LockFreeStack<unsigned>>(threads, operations));
+    }
+}
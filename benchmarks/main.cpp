@@ -0,0 +1,69 @@
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+extern void runRingBufferBenchmark();
+extern void runSpscRingBufferBenchmark();
+extern void runMpmcQueueBenchmark();
+extern void runStatsRingBufferBenchmark();
+extern void runQuantileRingBufferBenchmark();
+extern void runSimdKernelsBenchmark();
+extern void runNodePoolBenchmark();
+extern void runArenaBenchmark();
+extern void runUnrolledListBenchmark();
+extern void runIndexLinkedListBenchmark();
+extern void runIntrusiveListBenchmark();
+extern void runMoveSemanticsBenchmark();
+extern void runLockFreeStackBenchmark();
+extern void runLockFreeQueueBenchmark();
+extern void runWorkStealingBenchmark();
+extern void runBlockDequeBenchmark();
+extern void runSmallStackBenchmark();
+extern void runSlotMapBenchmark();
+extern void runCacheBenchmark();
+extern void runPriorityQueueBenchmark();
+extern void runTimingWheelBenchmark();
+
+struct BenchmarkEntry {
+    const char* name;
+    void (*run)();
+};
+
+// Pass one or more names on the command line to run only those benchmarks, no arguments runs everything
+static const BenchmarkEntry benchmarks[] = {
+    {"ringbuffer", runRingBufferBenchmark},
+    {"spsc", runSpscRingBufferBenchmark},
+    {"mpmc", runMpmcQueueBenchmark},
+    {"stats", runStatsRingBufferBenchmark},
+    {"quantile", runQuantileRingBufferBenchmark},
+    {"simd", runSimdKernelsBenchmark},
+    {"nodepool", runNodePoolBenchmark},
+    {"arena", runArenaBenchmark},
+    {"unrolled", runUnrolledListBenchmark},
+    {"indexlist", runIndexLinkedListBenchmark},
+    {"intrusive", runIntrusiveListBenchmark},
+    {"moves", runMoveSemanticsBenchmark},
+    {"lockfreestack", runLockFreeStackBenchmark},
+    {"lockfreequeue", runLockFreeQueueBenchmark},
+    {"workstealing", runWorkStealingBenchmark},
+    {"blockdeque", runBlockDequeBenchmark},
+    {"smallstack", runSmallStackBenchmark},
+    {"slotmap", runSlotMapBenchmark},
+    {"cache", runCacheBenchmark},
+    {"priorityqueue", runPriorityQueueBenchmark},
+    {"timingwheel", runTimingWheelBenchmark},
+};
+
+int main(int argc, char** argv) {
+    for (const auto& benchmark : benchmarks) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc && !selected; i++) {
+            selected = strcmp(argv[i], benchmark.name) == 0;
+        }
+        if (selected) {
+            benchmark.run();
+            cout << endl;
+        }
+    }
+    return 0;
+}
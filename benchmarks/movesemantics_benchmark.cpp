@@ -0,0 +1,120 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "benchmark.h"
+#include "deque.h"
+#include "queue.h"
+#include "ringbuffer.h"
+#include "stack.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    size_t copies = 0; // Telemetry copy constructions and copy assignments since the last reset
+
+    // Telemetry record with heap-owning members, so every copy is a string and a vector allocation
+    struct Telemetry {
+        std::string source;
+        std::vector<float> values;
+        unsigned timestamp = 0;
+
+        Telemetry() = default;
+        Telemetry(std::string source, size_t channels, unsigned timestamp)
+            : source(std::move(source)), values(channels, 1.0f), timestamp(timestamp) {}
+        Telemetry(const Telemetry& other) : source(other.source), values(other.values), timestamp(other.timestamp) { copies++; }
+        Telemetry(Telemetry&&) noexcept = default;
+        Telemetry& operator=(const Telemetry& other) {
+            source = other.source;
+            values = other.values;
+            timestamp = other.timestamp;
+            copies++;
+            return *this;
+        }
+        Telemetry& operator=(Telemetry&&) noexcept = default;
+    };
+
+    const std::string sourceName = "hydrophone-array-starboard"; // Longer than the small string buffer, so it allocates
+    constexpr size_t channels = 16;
+
+    // Times one push/pop round trip per operation and prints ns/op followed by the copies each operation made
+    template<typename Func>
+    void run(const std::string& name, size_t operations, Func&& func) {
+        copies = 0;
+        const int repeats = 5;
+        double ns = measure(operations, func, repeats);
+        std::ostringstream label;
+        label << name << " [" << std::fixed << std::setprecision(1)
+              << static_cast<double>(copies) / static_cast<double>(operations * repeats) << " copies]";
+        report(label.str(), ns);
+    }
+
+    // The three ways of getting a record in: copy an existing one, move a freshly built one, or build it in place
+    enum class Insert { Copy, Move, Emplace };
+
+    template<Insert How, typename Container, typename Push, typename Emplace, typename Pop>
+    void roundTrips(const std::string& name, size_t operations, Push push, Emplace emplace, Pop pop) {
+        Container container;
+        run(name, operations, [&] {
+            unsigned sum = 0;
+            for (size_t i = 0; i < operations; i++) {
+                const auto stamp = static_cast<unsigned>(i);
+                if constexpr (How == Insert::Copy) {
+                    Telemetry record(sourceName, channels, stamp);
+                    push(container, record);
+                } else if constexpr (How == Insert::Move) {
+                    push(container, Telemetry(sourceName, channels, stamp));
+                } else {
+                    emplace(container, sourceName, channels, stamp);
+                }
+                if (container.getSize() > 4) sum += pop(container).timestamp;
+            }
+            while (!container.isEmpty()) sum += pop(container).timestamp;
+            doNotOptimize(sum);
+        });
+    }
+
+    template<typename Container, typename Push, typename Emplace, typename Pop>
+    void compare(const std::string& name, size_t operations, Push push, Emplace emplace, Pop pop) {
+        roundTrips<Insert::Copy, Container>(name + " copy", operations, push, emplace, pop);
+        roundTrips<Insert::Move, Container>(name + " move", operations, push, emplace, pop);
+        roundTrips<Insert::Emplace, Container>(name + " emplace", operations, push, emplace, pop);
+    }
+
+    // RingBuffer has no default constructor, so it gets a thin wrapper with a fixed capacity
+    struct Ring : RingBuffer<Telemetry> {
+        Ring() : RingBuffer<Telemetry>(8) {}
+    };
+}
+
+void runMoveSemanticsBenchmark() {
+    std::cout << "=== Copy vs move vs emplace (Telemetry with a string and a vector) ===" << std::endl;
+    const size_t operations = 1 << 18;
+    auto pop = [](auto& container) { return container.pop(); };
+    auto push = [](auto& container, auto&& value) { container.push(std::forward<decltype(value)>(value)); };
+    auto emplace = [](auto& container, auto&&... args) { container.emplace(std::forward<decltype(args)>(args)...); };
+
+    compare<Queue<Telemetry>>("Queue", operations, push, emplace, pop);
+    compare<Stack<Telemetry>>("Stack", operations, push, emplace, pop);
+    compare<Deque<Telemetry>>("Deque", operations,
+        [](auto& deque, auto&& value) { deque.push_back(std::forward<decltype(value)>(value)); },
+        [](auto& deque, auto&&... args) { deque.emplace_back(std::forward<decltype(args)>(args)...); },
+        [](auto& deque) { return deque.pop_front(); });
+    compare<Ring>("RingBuffer", operations, push, emplace, pop);
+    compare<RingBuffer<Telemetry, 8>>("RingBuffer<8>", operations, push, emplace, pop);
+
+    // Moving a whole container hands over the nodes / slot array instead of copying each record
+    Queue<Telemetry> full;
+    for (size_t i = 0; i < 1024; i++) full.emplace(sourceName, channels, static_cast<unsigned>(i));
+    run("Queue(1024) copy construct", 1, [&] { Queue<Telemetry> copy(full); doNotOptimize(copy.getSize()); });
+    run("Queue(1024) move construct + back", 1, [&] {
+        Queue<Telemetry> moved(std::move(full));
+        full = std::move(moved);
+        doNotOptimize(full.getSize());
+    });
+}
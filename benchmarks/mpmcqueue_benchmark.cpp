@@ -0,0 +1,92 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "mpmcqueue.h"
+#include "queue.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    // Today's setup: one global lock around a Queue, bounded by hand so both sides see the same backpressure
+    class LockedQueue {
+    public:
+        explicit LockedQueue(size_t capacity) : maxCapacity(capacity) {}
+        bool try_push(const unsigned& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (static_cast<size_t>(queue.getSize()) >= maxCapacity) return false;
+            queue.push(value);
+            return true;
+        }
+        bool try_pop(unsigned& out) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.isEmpty()) return false;
+            out = queue.pop();
+            return true;
+        }
+    private:
+        std::mutex mutex;
+        Queue<unsigned> queue;
+        size_t maxCapacity;
+    };
+
+    // producers threads push items between them, consumers threads pop until every item has been seen
+    template<typename QueueType>
+    double transfer(QueueType& queue, size_t producers, size_t consumers, size_t items) {
+        return measure(items, [&] {
+            std::atomic<size_t> consumed{0};
+            std::vector<std::thread> threads;
+            for (size_t p = 0; p < producers; p++) {
+                threads.emplace_back([&, p] {
+                    for (size_t i = p; i < items; i += producers) {
+                        while (!queue.try_push(static_cast<unsigned>(i))) std::this_thread::yield();
+                    }
+                });
+            }
+            for (size_t c = 0; c < consumers; c++) {
+                threads.emplace_back([&] {
+                    unsigned value = 0;
+                    unsigned checksum = 0;
+                    while (consumed.load(std::memory_order_relaxed) < items) {
+                        if (queue.try_pop(value)) {
+                            checksum += value;
+                            consumed.fetch_add(1, std::memory_order_relaxed);
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+                    doNotOptimize(checksum);
+                });
+            }
+            for (auto& thread : threads) thread.join();
+        }, 3);
+    }
+}
+
+void runMpmcQueueBenchmark() {
+    std::cout << "=== MpmcQueue vs mutex-wrapped Queue (P producers / C consumers) ===" << std::endl;
+    const size_t items = 1 << 18;
+    const size_t capacity = 256;
+    const size_t cores = std::max(2u, std::thread::hardware_concurrency());
+    std::cout << "  hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    // Symmetric P/C pairs from 1 up to the core count, plus the fan-in case (many sensor drivers, one uplink worker)
+    std::vector<std::pair<size_t, size_t>> configurations;
+    for (size_t threads = 1; threads <= cores; threads *= 2) {
+        configurations.emplace_back(threads, threads);
+        if (threads > 1) configurations.emplace_back(threads, 1);
+    }
+    for (auto [producers, consumers] : configurations) {
+        std::string suffix = " (" + std::to_string(producers) + "P/" + std::to_string(consumers) + "C)";
+        LockedQueue locked(capacity);
+        MpmcQueue<unsigned> mpmc(capacity);
+        report("mutex Queue" + suffix, transfer(locked, producers, consumers, items));
+        report("MpmcQueue" + suffix, transfer(mpmc, producers, consumers, items));
+    }
+}
@@ -0,0 +1,77 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <memory>
+#include <string>
+#include "benchmark.h"
+#include "deque.h"
+#include "queue.h"
+#include "stack.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct Telemetry {
+        float values[6];
+        unsigned timestamp;
+    };
+
+    // Steady state: the container fills to depth and drains again, over and over
+    template<typename Container>
+    double stackChurn(size_t depth, size_t operations) {
+        Container stack;
+        operations = (operations + depth - 1) / depth * depth;
+        return measure(operations, [&] {
+            unsigned sum = 0;
+            for (size_t done = 0; done < operations; done += depth) {
+                for (size_t i = 0; i < depth; i++) stack.push(Telemetry{{}, static_cast<unsigned>(i)});
+                for (size_t i = 0; i < depth; i++) sum += stack.pop().timestamp;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    template<typename Container>
+    double dequeChurn(size_t depth, size_t operations) {
+        Container deque;
+        operations = (operations + depth - 1) / depth * depth;
+        return measure(operations, [&] {
+            unsigned sum = 0;
+            for (size_t done = 0; done < operations; done += depth) {
+                for (size_t i = 0; i < depth; i++) deque.push_back(Telemetry{{}, static_cast<unsigned>(i)});
+                for (size_t i = 0; i < depth; i++) sum += deque.pop_front().timestamp;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    // A short queue, so every push reuses a node the pool got back a few pops ago
+    template<typename Container>
+    double queueChurn(size_t operations) {
+        Container queue;
+        return measure(operations, [&] {
+            unsigned sum = 0;
+            for (size_t i = 0; i < operations; i++) {
+                queue.push(Telemetry{{}, static_cast<unsigned>(i)});
+                if (queue.getSize() > 4) sum += queue.pop().timestamp;
+            }
+            while (!queue.isEmpty()) sum += queue.pop().timestamp;
+            doNotOptimize(sum);
+        });
+    }
+}
+
+void runNodePoolBenchmark() {
+    std::cout << "=== Node allocation: NodePool vs new/delete (std::allocator) ===" << std::endl;
+    const size_t operations = 1 << 20;
+    for (size_t depth : {16, 1024, 65536}) {
+        std::string suffix = " (depth " + std::to_string(depth) + ")";
+        report("Stack push+pop, std::allocator" + suffix, stackChurn<Stack<Telemetry, std::allocator>>(depth, operations));
+        report("Stack push+pop, NodePool" + suffix, stackChurn<Stack<Telemetry>>(depth, operations));
+        report("Deque back+front, std::allocator" + suffix, dequeChurn<Deque<Telemetry, std::allocator>>(depth, operations));
+        report("Deque back+front, NodePool" + suffix, dequeChurn<Deque<Telemetry>>(depth, operations));
+    }
+    report("Queue push+pop, std::allocator", queueChurn<Queue<Telemetry, std::allocator>>(operations));
+    report("Queue push+pop, NodePool", queueChurn<Queue<Telemetry>>(operations));
+}
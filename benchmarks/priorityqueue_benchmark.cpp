@@ -0,0 +1,187 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "linkedlist.h"
+#include "priorityqueue.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct OpenCell {
+        int cost; // Path so far plus the estimate to the goal
+        int cell;
+        bool operator<(const OpenCell& other) const { return cost < other.cost || (cost == other.cost && cell < other.cell); }
+        bool operator>(const OpenCell& other) const { return other < *this; }
+        bool operator==(const OpenCell& other) const { return cost == other.cost && cell == other.cell; }
+    };
+
+    // Lake grid: open water costs 1 to enter, weed beds 4, 0 is land
+    struct Grid {
+        int size;
+        std::vector<int> weight;
+    };
+
+    Grid makeGrid(int size) {
+        Grid grid{size, std::vector<int>(size * size)};
+        unsigned random = 88172645u;
+        for (int& weight : grid.weight) {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            const unsigned roll = random % 10;
+            weight = roll == 0 ? 0 : roll < 3 ? 4 : 1;
+        }
+        grid.weight.front() = 1;
+        grid.weight.back() = 1;
+        return grid;
+    }
+
+    int estimate(const Grid& grid, int cell) {
+        return std::abs(grid.size - 1 - cell % grid.size) + std::abs(grid.size - 1 - cell / grid.size);
+    }
+
+    // Calls visit(next, cost) for every open neighbour of cell
+    template<typename Visit>
+    void forNeighbours(const Grid& grid, int cell, Visit&& visit) {
+        const int x = cell % grid.size;
+        const int y = cell / grid.size;
+        if (x + 1 < grid.size && grid.weight[cell + 1]) visit(cell + 1, grid.weight[cell + 1]);
+        if (y + 1 < grid.size && grid.weight[cell + grid.size]) visit(cell + grid.size, grid.weight[cell + grid.size]);
+        if (x > 0 && grid.weight[cell - 1]) visit(cell - 1, grid.weight[cell - 1]);
+        if (y > 0 && grid.weight[cell - grid.size]) visit(cell - grid.size, grid.weight[cell - grid.size]);
+    }
+
+    // A* with one open-set entry per cell, lowered with decrease_key
+    template<size_t Arity>
+    int searchDecreaseKey(const Grid& grid) {
+        const int goal = grid.size * grid.size - 1;
+        std::vector<int> pathCost(grid.weight.size(), -1);
+        std::vector<SlotHandle> inOpen(grid.weight.size());
+        PriorityQueue<OpenCell, Arity> open;
+        pathCost[0] = 0;
+        inOpen[0] = open.push({estimate(grid, 0), 0});
+        while (!open.isEmpty()) {
+            const int cell = open.pop().cell;
+            if (cell == goal) break;
+            forNeighbours(grid, cell, [&](int next, int weight) {
+                const int cost = pathCost[cell] + weight;
+                if (pathCost[next] != -1 && cost >= pathCost[next]) return;
+                pathCost[next] = cost;
+                if (open.contains(inOpen[next])) {
+                    open.decrease_key(inOpen[next], {cost + estimate(grid, next), next});
+                } else {
+                    inOpen[next] = open.push({cost + estimate(grid, next), next});
+                }
+            });
+        }
+        return pathCost[goal];
+    }
+
+    // A* the usual std::priority_queue way: push a duplicate when a cost drops, skip entries of closed cells
+    int searchStdLazy(const Grid& grid) {
+        const int goal = grid.size * grid.size - 1;
+        std::vector<int> pathCost(grid.weight.size(), -1);
+        std::vector<bool> closed(grid.weight.size(), false);
+        std::priority_queue<OpenCell, std::vector<OpenCell>, std::greater<>> open;
+        pathCost[0] = 0;
+        open.push({estimate(grid, 0), 0});
+        while (!open.empty()) {
+            const int cell = open.top().cell;
+            open.pop();
+            if (closed[cell]) continue;
+            closed[cell] = true;
+            if (cell == goal) break;
+            forNeighbours(grid, cell, [&](int next, int weight) {
+                const int cost = pathCost[cell] + weight;
+                if (pathCost[next] != -1 && cost >= pathCost[next]) return;
+                pathCost[next] = cost;
+                open.push({cost + estimate(grid, next), next});
+            });
+        }
+        return pathCost[goal];
+    }
+
+    // A* on a sorted LinkedList: walk to the insertion spot, insert(value, spot), pop the head; duplicates as above
+    int searchSortedList(const Grid& grid) {
+        const int goal = grid.size * grid.size - 1;
+        std::vector<int> pathCost(grid.weight.size(), -1);
+        std::vector<bool> closed(grid.weight.size(), false);
+        LinkedList<OpenCell> open;
+        pathCost[0] = 0;
+        open.insert({estimate(grid, 0), 0});
+        while (open.getHead()) {
+            const int cell = open.getHead()->getData().cell;
+            open.removeNode(open.getHead());
+            if (closed[cell]) continue;
+            closed[cell] = true;
+            if (cell == goal) break;
+            forNeighbours(grid, cell, [&](int next, int weight) {
+                const int cost = pathCost[cell] + weight;
+                if (pathCost[next] != -1 && cost >= pathCost[next]) return;
+                pathCost[next] = cost;
+                const OpenCell entry{cost + estimate(grid, next), next};
+                int spot = 0;
+                for (const OpenCell& queued : open) {
+                    if (entry < queued) break;
+                    spot++;
+                }
+                if (spot == static_cast<int>(open.getSize())) {
+                    open.insert(entry);
+                } else {
+                    open.insert(entry, spot);
+                }
+            });
+        }
+        return pathCost[goal];
+    }
+
+    template<typename Search>
+    double timeSearch(const Grid& grid, Search&& search) {
+        return measure(grid.weight.size(), [&] { doNotOptimize(search(grid)); });
+    }
+}
+
+void runPriorityQueueBenchmark() {
+    for (int size : {64, 512}) {
+        const Grid grid = makeGrid(size);
+        std::cout << "=== A* on a " << size << "x" << size << " lake grid, route cost " << searchStdLazy(grid)
+                  << " (ns per grid cell) ===" << std::endl;
+        report("std::priority_queue, lazy duplicates", timeSearch(grid, searchStdLazy));
+        report("PriorityQueue<2> + decrease_key", timeSearch(grid, searchDecreaseKey<2>));
+        report("PriorityQueue<4> + decrease_key", timeSearch(grid, searchDecreaseKey<4>));
+        report("PriorityQueue<8> + decrease_key", timeSearch(grid, searchDecreaseKey<8>));
+        if (size <= 64) {
+            report("sorted LinkedList, insert(value, spot)", timeSearch(grid, searchSortedList));
+        }
+    }
+
+    std::cout << "=== Building a queue of 1M deadlines (ns per element) ===" << std::endl;
+    std::vector<int> deadlines(1 << 20);
+    unsigned random = 2463534242u;
+    for (int& deadline : deadlines) {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        deadline = static_cast<int>(random >> 1);
+    }
+    report("std::priority_queue(range)", measure(deadlines.size(), [&] {
+        std::priority_queue<int, std::vector<int>, std::greater<>> queue(deadlines.begin(), deadlines.end());
+        doNotOptimize(queue.top());
+    }));
+    report("PriorityQueue<4>(range)", measure(deadlines.size(), [&] {
+        PriorityQueue<int> queue(deadlines.begin(), deadlines.end());
+        doNotOptimize(queue.top());
+    }));
+    report("PriorityQueue<4>, one push per element", measure(deadlines.size(), [&] {
+        PriorityQueue<int> queue;
+        queue.reserve(deadlines.size());
+        for (int deadline : deadlines) queue.push(deadline);
+        doNotOptimize(queue.top());
+    }));
+}
@@ -0,0 +1,63 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "quantileringbuffer.h"
+#include "ringbuffer.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    float sample(size_t i) {
+        return 12.0f + 0.5f * std::sin(static_cast<float>(i) * 0.1f) + static_cast<float>((i * 2654435761u) % 97) * 0.01f;
+    }
+
+    // What the despiking filter did before: copy the window out and nth_element for each statistic
+    float copyAndSelect(const RingBuffer<float>& window, std::vector<float>& scratch, double q) {
+        scratch.assign(window.cbegin(), window.cend());
+        auto nth = scratch.begin() + static_cast<std::ptrdiff_t>(q * static_cast<double>(scratch.size() - 1));
+        std::nth_element(scratch.begin(), nth, scratch.end());
+        return *nth;
+    }
+}
+
+void runQuantileRingBufferBenchmark() {
+    std::cout << "=== QuantileRingBuffer: push + median/p5/p95 every tick, tree vs copy + nth_element ===" << std::endl;
+    for (size_t window : {31, 301, 3001, 30001}) {
+        std::string suffix = " (window " + std::to_string(window) + ")";
+        // Copy-and-select is O(window) per tick, so it gets a fixed budget of ~50M sample visits
+        const size_t copyTicks = std::max<size_t>(64, 50'000'000 / window);
+        const size_t treeTicks = 1 << 18;
+
+        RingBuffer<float> plain(window, true);
+        std::vector<float> scratch;
+        scratch.reserve(window);
+        for (size_t i = 0; i < window; i++) plain.push(sample(i));
+        size_t next = window;
+        report("copy + nth_element" + suffix, measure(copyTicks, [&] {
+            float check = 0.0f;
+            for (size_t t = 0; t < copyTicks; t++) {
+                plain.push(sample(next++));
+                check += copyAndSelect(plain, scratch, 0.5) + copyAndSelect(plain, scratch, 0.05) + copyAndSelect(plain, scratch, 0.95);
+            }
+            doNotOptimize(check);
+        }, 3));
+
+        QuantileRingBuffer<float> tracked(window);
+        for (size_t i = 0; i < window; i++) tracked.push(sample(i));
+        next = window;
+        report("QuantileRingBuffer" + suffix, measure(treeTicks, [&] {
+            float check = 0.0f;
+            for (size_t t = 0; t < treeTicks; t++) {
+                tracked.push(sample(next++));
+                check += tracked.median() + tracked.percentile(5) + tracked.percentile(95);
+            }
+            doNotOptimize(check);
+        }, 3));
+    }
+}
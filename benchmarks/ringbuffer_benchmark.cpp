@@ -0,0 +1,158 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "linkedlist.h"
+#include "ringbuffer.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    /* The previous RingBuffer, kept here only as the baseline: a LinkedList that allocates a node per push
+     * and frees the head node when it overwrites. LinkedList now pools its nodes by default, so the baseline
+     * names std::allocator to keep the malloc per push it is meant to measure.
+     */
+    template<typename T>
+    class NodeRingBuffer {
+    public:
+        NodeRingBuffer(size_t capacity, bool overwrite) : maxCapacity(capacity), overwriteOnly(overwrite) {}
+        void push(const T& value) {
+            if (list.getSize() >= maxCapacity) {
+                if (!overwriteOnly) throw std::runtime_error("full");
+                list.removeNode(list.getHead());
+            }
+            list.insert(value);
+        }
+        T pop() {
+            T value = list.getHead()->getData();
+            list.removeNode(list.getHead());
+            return value;
+        }
+        auto begin() { return list.begin(); }
+        auto end() { return list.end(); }
+    private:
+        LinkedList<T, std::allocator> list;
+        size_t maxCapacity;
+        bool overwriteOnly;
+    };
+
+    struct ImuSample {
+        float accel[3];
+        float gyro[3];
+        unsigned timestamp;
+    };
+
+    // Overwrite mode at steady state: the buffer is always full, so every push evicts the oldest sample
+    template<typename Buffer>
+    double overwritePush(size_t capacity, size_t operations) {
+        Buffer buffer(capacity, true);
+        for (size_t i = 0; i < capacity; i++) buffer.push(ImuSample{{}, {}, static_cast<unsigned>(i)});
+        return measure(operations, [&] {
+            for (size_t i = 0; i < operations; i++) {
+                buffer.push(ImuSample{{1.0f, 2.0f, 3.0f}, {0.1f, 0.2f, 0.3f}, static_cast<unsigned>(i)});
+            }
+            doNotOptimize(buffer);
+        });
+    }
+
+    // Producer/consumer pattern: push a burst then drain it
+    template<typename Buffer>
+    double pushPop(size_t capacity, size_t operations) {
+        Buffer buffer(capacity, false);
+        operations = (operations + capacity - 1) / capacity * capacity;
+        return measure(operations, [&] {
+            unsigned sum = 0;
+            for (size_t done = 0; done < operations; done += capacity) {
+                for (size_t i = 0; i < capacity; i++) buffer.push(ImuSample{{}, {}, static_cast<unsigned>(i)});
+                for (size_t i = 0; i < capacity; i++) sum += buffer.pop().timestamp;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    // Full traversal of a full buffer through the iterators
+    template<typename Buffer>
+    double iterate(size_t capacity, size_t operations) {
+        Buffer buffer(capacity, true);
+        operations = (operations + capacity - 1) / capacity * capacity;
+        for (size_t i = 0; i < capacity + capacity / 2; i++) buffer.push(ImuSample{{static_cast<float>(i)}, {}, static_cast<unsigned>(i)});
+        return measure(operations, [&] {
+            float sum = 0.0f;
+            for (size_t done = 0; done < operations; done += capacity) {
+                for (auto& sample : buffer) sum += sample.accel[0];
+            }
+            doNotOptimize(sum);
+        });
+    }
+}
+
+void runRingBufferBenchmark() {
+    std::cout << "=== RingBuffer: contiguous slots vs LinkedList nodes ===" << std::endl;
+    const size_t operations = 1 << 20;
+    for (size_t capacity : {64, 1000, 10000}) {
+        std::string suffix = " (capacity " + std::to_string(capacity) + ")";
+        report("node overwrite push" + suffix, overwritePush<NodeRingBuffer<ImuSample>>(capacity, operations));
+        report("array overwrite push" + suffix, overwritePush<RingBuffer<ImuSample>>(capacity, operations));
+        report("node push+pop" + suffix, pushPop<NodeRingBuffer<ImuSample>>(capacity, operations));
+        report("array push+pop" + suffix, pushPop<RingBuffer<ImuSample>>(capacity, operations));
+        report("node iterate" + suffix, iterate<NodeRingBuffer<ImuSample>>(capacity, operations));
+        report("array iterate" + suffix, iterate<RingBuffer<ImuSample>>(capacity, operations));
+    }
+
+    std::cout << "=== RingBuffer: runtime capacity vs fixed RingBuffer<T, N> ===" << std::endl;
+    {
+        RingBuffer<ImuSample> dynamic(1024, true);
+        static RingBuffer<ImuSample, 1024, OverflowPolicy::Overwrite> fixedPow2; // Static storage, like on the safety MCU
+        static RingBuffer<ImuSample, 1000, OverflowPolicy::Overwrite> fixedOdd;
+        auto pushAll = [&](auto& buffer) {
+            return measure(operations, [&] {
+                for (size_t i = 0; i < operations; i++) {
+                    buffer.push(ImuSample{{1.0f, 2.0f, 3.0f}, {0.1f, 0.2f, 0.3f}, static_cast<unsigned>(i)});
+                }
+                doNotOptimize(buffer);
+            });
+        };
+        report("RingBuffer<T>(1024, true) overwrite push", pushAll(dynamic));
+        report("RingBuffer<T, 1024, Overwrite> push (mask)", pushAll(fixedPow2));
+        report("RingBuffer<T, 1000, Overwrite> push (compare)", pushAll(fixedOdd));
+    }
+
+    std::cout << "=== RingBuffer: draining a LoRa window, pop() loop vs bulk APIs ===" << std::endl;
+    for (size_t window : {64, 512, 4096}) {
+        std::string suffix = " (window " + std::to_string(window) + ")";
+        RingBuffer<ImuSample> buffer(window, true);
+        std::vector<ImuSample> samples(window, ImuSample{{1.0f, 2.0f, 3.0f}, {}, 7});
+        std::vector<ImuSample> packet(window);
+        const size_t rounds = std::max<size_t>(1, operations / window);
+        report("push() + pop() loop" + suffix, measure(rounds * window, [&] {
+            for (size_t r = 0; r < rounds; r++) {
+                for (const auto& sample : samples) buffer.push(sample);
+                for (size_t i = 0; i < window; i++) packet[i] = buffer.pop();
+            }
+            doNotOptimize(packet);
+        }));
+        report("push_bulk + pop_bulk" + suffix, measure(rounds * window, [&] {
+            for (size_t r = 0; r < rounds; r++) {
+                buffer.push_bulk(samples);
+                buffer.pop_bulk(packet);
+            }
+            doNotOptimize(packet);
+        }));
+        report("push_bulk + peek_contiguous + consume" + suffix, measure(rounds * window, [&] {
+            unsigned checksum = 0;
+            for (size_t r = 0; r < rounds; r++) {
+                buffer.push_bulk(samples);
+                for (auto segment : buffer.peek_contiguous()) {
+                    for (const auto& sample : segment) checksum += sample.timestamp;
+                }
+                buffer.consume(buffer.getSize());
+            }
+            doNotOptimize(checksum);
+        }));
+    }
+}
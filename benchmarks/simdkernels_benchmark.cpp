@@ -0,0 +1,87 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "linkedlist.h"
+#include "ringbuffer.h"
+#include "simdkernels.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    const char* levelName(Kernels::SimdLevel level) {
+        switch (level) {
+            case Kernels::SimdLevel::Avx2: return "avx2";
+            case Kernels::SimdLevel::Sse2: return "sse2";
+            default: return "scalar";
+        }
+    }
+
+    // Runs every kernel over a full, wrapped window at each available instruction set, ns/op is per sample
+    template<typename T>
+    void runKernels(const std::string& typeName, size_t window) {
+        const std::string suffix = " (" + typeName + ", window " + std::to_string(window) + ")";
+        RingBuffer<T> buffer(window, true);
+        for (size_t i = 0; i < window + window / 3; i++) buffer.push(static_cast<T>(i % 101) * T(0.01));
+        std::vector<T> weights(window, T(1) / static_cast<T>(window));
+        const size_t rounds = std::max<size_t>(1, (1 << 24) / window);
+        const size_t samples = rounds * window;
+
+        // What the old code did: walk the samples through an iterator (LinkedList here, only the sum)
+        {
+            LinkedList<T> list;
+            for (size_t i = 0; i < window; i++) list.insert(static_cast<T>(i % 101) * T(0.01));
+            const size_t listRounds = std::max<size_t>(1, (1 << 22) / window);
+            report("LinkedList iterator sum" + suffix, measure(listRounds * window, [&] {
+                T total = 0;
+                for (size_t r = 0; r < listRounds; r++) {
+                    for (T value : list) total += value;
+                }
+                doNotOptimize(total);
+            }, 3));
+        }
+
+        for (auto level : {Kernels::SimdLevel::Scalar, Kernels::SimdLevel::Sse2, Kernels::SimdLevel::Avx2}) {
+            if (Kernels::setSimdLevel(level) != level) {
+                continue; // Not supported on this CPU
+            }
+            const std::string name = std::string(" ") + levelName(level) + suffix;
+            report("sum" + name, measure(samples, [&] {
+                T total = 0;
+                for (size_t r = 0; r < rounds; r++) total += Kernels::sum(buffer);
+                doNotOptimize(total);
+            }));
+            report("dot" + name, measure(samples, [&] {
+                T total = 0;
+                for (size_t r = 0; r < rounds; r++) total += Kernels::dot(buffer, weights);
+                doNotOptimize(total);
+            }));
+            report("minMax" + name, measure(samples, [&] {
+                T total = 0;
+                for (size_t r = 0; r < rounds; r++) total += Kernels::minMax(buffer).second;
+                doNotOptimize(total);
+            }));
+            report("rms" + name, measure(samples, [&] {
+                T total = 0;
+                for (size_t r = 0; r < rounds; r++) total += Kernels::rms(buffer);
+                doNotOptimize(total);
+            }));
+            report("scaleOffset" + name, measure(samples, [&] {
+                for (size_t r = 0; r < rounds; r++) Kernels::scaleOffset(buffer, T(1), T(0));
+                doNotOptimize(buffer);
+            }));
+        }
+        Kernels::setSimdLevel(Kernels::detectedSimdLevel());
+    }
+}
+
+void runSimdKernelsBenchmark() {
+    std::cout << "=== SIMD kernels over RingBuffer windows (ns per sample) ===" << std::endl;
+    for (size_t window : {256, 4096, 65536, 1 << 20}) {
+        runKernels<float>("float", window);
+        runKernels<double>("double", window);
+    }
+}
@@ -0,0 +1,93 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "linkedlist.h"
+#include "slotmap.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct Obstacle {
+        unsigned id;
+        float x;
+        float y;
+        float radius;
+        bool operator==(const Obstacle& other) const { return id == other.id; }
+    };
+
+    template<typename Container>
+    double sumRadii(const Container& container, size_t count) {
+        return measure(count, [&] {
+            float sum = 0.0f;
+            for (const Obstacle& obstacle : container) sum += obstacle.radius;
+            doNotOptimize(sum);
+        });
+    }
+}
+
+void runSlotMapBenchmark() {
+    const size_t count = 1000;
+    SlotMap<Obstacle> map;
+    LinkedList<Obstacle> list;
+    std::vector<Obstacle> vector;
+    std::vector<SlotHandle> handles;
+    for (unsigned i = 0; i < count; i++) {
+        const Obstacle obstacle{i, static_cast<float>(i), 0.0f, 1.0f + static_cast<float>(i % 7)};
+        handles.push_back(map.insert(obstacle));
+        list.insert(obstacle);
+        vector.push_back(obstacle);
+    }
+    // Churn the map a little, so the dense array is no longer in insertion order
+    for (unsigned i = 0; i < count; i += 3) {
+        const Obstacle obstacle = map.at(handles[i]);
+        map.erase(handles[i]);
+        handles[i] = map.insert(obstacle);
+    }
+
+    std::cout << "=== Dense iteration over 1000 obstacles (ns per element) ===" << std::endl;
+    report("std::vector", sumRadii(vector, count));
+    report("SlotMap", sumRadii(map, count));
+    report("LinkedList", sumRadii(list, count));
+
+    std::cout << "=== Lookup of a tracked obstacle (ns per lookup) ===" << std::endl;
+    const size_t lookups = 1 << 16;
+    report("SlotMap find(handle)", measure(lookups, [&] {
+        float sum = 0.0f;
+        for (size_t i = 0; i < lookups; i++) sum += map.find(handles[(i * 7919) % count])->x;
+        doNotOptimize(sum);
+    }));
+    report("LinkedList findNode(value)", measure(lookups / 16, [&] {
+        float sum = 0.0f;
+        for (size_t i = 0; i < lookups / 16; i++) sum += list.findNode(Obstacle{static_cast<unsigned>((i * 7919) % count), 0, 0, 0})->getData().x;
+        doNotOptimize(sum);
+    }));
+
+    std::cout << "=== Drop one obstacle and track a new one (ns per pair) ===" << std::endl;
+    // Random victims that differ between repeats: a fixed sequence would leave the list in probe order after one pass
+    unsigned random = 12345;
+    auto nextVictim = [&random] {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        return random % count;
+    };
+    const size_t replacements = 1 << 14;
+    report("SlotMap erase(handle) + insert", measure(replacements, [&] {
+        for (size_t i = 0; i < replacements; i++) {
+            const size_t k = nextVictim();
+            map.erase(handles[k]);
+            handles[k] = map.insert(Obstacle{static_cast<unsigned>(k), 0, 0, 1});
+        }
+    }));
+    report("LinkedList findNode + removeNode + insert", measure(replacements / 16, [&] {
+        for (size_t i = 0; i < replacements / 16; i++) {
+            const auto k = static_cast<unsigned>(nextVictim());
+            list.removeNode(list.findNode(Obstacle{k, 0, 0, 0}));
+            list.insert(Obstacle{k, 0, 0, 1});
+        }
+    }));
+}
@@ -0,0 +1,62 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include "benchmark.h"
+#include "smallstack.h"
+#include "stack.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct Frame {
+        int x;
+        int y;
+        int direction;
+    };
+
+    // A fresh stack per search, filled to depth and drained again, the way a backtracking search uses it
+    template<typename Container>
+    double searchChurn(size_t depth, size_t operations) {
+        operations = (operations + depth - 1) / depth * depth;
+        return measure(operations, [&] {
+            int sum = 0;
+            for (size_t done = 0; done < operations; done += depth) {
+                Container stack;
+                for (size_t i = 0; i < depth; i++) stack.emplace(Frame{static_cast<int>(i), 0, 0});
+                while (!stack.isEmpty()) sum += stack.pop().x;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    // Evaluates "1 2 + 3 + ... n +" style RPN: the stack never gets deeper than two
+    template<typename Container>
+    double rpnEvaluation(size_t operations) {
+        return measure(operations, [&] {
+            Container stack;
+            stack.push(0.0);
+            for (size_t i = 0; i < operations; i++) {
+                stack.push(static_cast<double>(i));
+                const double right = stack.pop();
+                stack.top() += right;
+            }
+            doNotOptimize(stack.top());
+        });
+    }
+}
+
+void runSmallStackBenchmark() {
+    std::cout << "=== Stack (list nodes) vs SmallStack (inline array), fresh stack per search ===" << std::endl;
+    const size_t operations = 1 << 20;
+    for (size_t depth : {8, 32, 256}) {
+        const std::string suffix = " (depth " + std::to_string(depth) + ")";
+        report("Stack, std::allocator" + suffix, searchChurn<Stack<Frame, std::allocator>>(depth, operations));
+        report("Stack, NodePool" + suffix, searchChurn<Stack<Frame>>(depth, operations));
+        report("SmallStack<Frame, 32>" + suffix, searchChurn<SmallStack<Frame, 32>>(depth, operations));
+    }
+    std::cout << "=== RPN evaluation, push + pop + top per token ===" << std::endl;
+    report("Stack<double>", rpnEvaluation<Stack<double>>(operations));
+    report("SmallStack<double>", rpnEvaluation<SmallStack<double>>(operations));
+}
@@ -0,0 +1,83 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include "benchmark.h"
+#include "ringbuffer.h"
+#include "spscringbuffer.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct Telemetry {
+        double values[4];
+        unsigned sequence;
+    };
+
+    // Today's setup: a RingBuffer shared by both threads behind one mutex
+    class LockedRingBuffer {
+    public:
+        explicit LockedRingBuffer(size_t capacity) : buffer(capacity) {}
+        bool try_push(const Telemetry& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (buffer.isFull()) return false;
+            buffer.push(value);
+            return true;
+        }
+        bool try_pop(Telemetry& out) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (buffer.isEmpty()) return false;
+            out = buffer.pop();
+            return true;
+        }
+    private:
+        std::mutex mutex;
+        RingBuffer<Telemetry> buffer;
+    };
+
+    // One producer thread and one consumer thread move items through the buffer
+    template<typename Buffer>
+    double transfer(Buffer& buffer, size_t items) {
+        return measure(items, [&] {
+            std::thread producer([&] {
+                for (size_t i = 0; i < items; i++) {
+                    Telemetry value{{1.0, 2.0, 3.0, 4.0}, static_cast<unsigned>(i)};
+                    while (!buffer.try_push(value)) std::this_thread::yield();
+                }
+            });
+            unsigned checksum = 0;
+            Telemetry value{};
+            for (size_t received = 0; received < items;) {
+                if (buffer.try_pop(value)) {
+                    checksum += value.sequence;
+                    received++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            producer.join();
+            doNotOptimize(checksum);
+        }, 3);
+    }
+}
+
+void runSpscRingBufferBenchmark() {
+    std::cout << "=== SpscRingBuffer vs mutex-guarded RingBuffer (1 producer, 1 consumer) ===" << std::endl;
+    const size_t items = 1 << 20;
+    for (size_t capacity : {64, 1024}) {
+        std::string suffix = " (capacity " + std::to_string(capacity) + ")";
+        LockedRingBuffer locked(capacity);
+        SpscRingBuffer<Telemetry> spsc(capacity);
+        report("mutex RingBuffer transfer" + suffix, transfer(locked, items));
+        report("SpscRingBuffer transfer" + suffix, transfer(spsc, items));
+    }
+
+    // Producer-side cost alone, with nothing contending: the "one store" fast path
+    SpscRingBuffer<Telemetry, OverflowPolicy::Overwrite> overwrite(1024);
+    report("SpscRingBuffer overwrite push (uncontended)", measure(items, [&] {
+        for (size_t i = 0; i < items; i++) overwrite.try_push(Telemetry{{}, static_cast<unsigned>(i)});
+        doNotOptimize(overwrite);
+    }));
+}
@@ -0,0 +1,78 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include "benchmark.h"
+#include "ringbuffer.h"
+#include "statsringbuffer.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    struct WindowStats {
+        double mean;
+        double variance;
+        float min;
+        float max;
+    };
+
+    // What the control loop did before: walk the whole window for every statistic on every tick
+    WindowStats recompute(const RingBuffer<float>& window) {
+        double sum = 0.0;
+        float low = window.front();
+        float high = window.front();
+        for (auto it = window.cbegin(); it != window.cend(); ++it) {
+            sum += *it;
+            low = std::min(low, *it);
+            high = std::max(high, *it);
+        }
+        const double mean = sum / window.getSize();
+        double m2 = 0.0;
+        for (auto it = window.cbegin(); it != window.cend(); ++it) {
+            m2 += (*it - mean) * (*it - mean);
+        }
+        return {mean, m2 / window.getSize(), low, high};
+    }
+
+    float sample(size_t i) {
+        return 7.0f + 0.2f * std::sin(static_cast<float>(i) * 0.05f) + static_cast<float>(i % 7) * 0.01f;
+    }
+}
+
+void runStatsRingBufferBenchmark() {
+    std::cout << "=== StatsRingBuffer: push + query every tick, incremental vs recompute ===" << std::endl;
+    for (size_t window : {100, 1000, 10000, 100000}) {
+        std::string suffix = " (window " + std::to_string(window) + ")";
+        // Recomputing is O(window) per tick, so it gets a fixed budget of ~50M sample visits
+        const size_t recomputeTicks = std::max<size_t>(64, 50'000'000 / window);
+        const size_t incrementalTicks = 1 << 20;
+
+        RingBuffer<float> plain(window, true);
+        for (size_t i = 0; i < window; i++) plain.push(sample(i));
+        size_t next = window;
+        report("recompute from scratch" + suffix, measure(recomputeTicks, [&] {
+            double check = 0.0;
+            for (size_t t = 0; t < recomputeTicks; t++) {
+                plain.push(sample(next++));
+                WindowStats stats = recompute(plain);
+                check += stats.mean + stats.variance + stats.min + stats.max;
+            }
+            doNotOptimize(check);
+        }, 3));
+
+        StatsRingBuffer<float> tracked(window);
+        for (size_t i = 0; i < window; i++) tracked.push(sample(i));
+        next = window;
+        report("StatsRingBuffer incremental" + suffix, measure(incrementalTicks, [&] {
+            double check = 0.0;
+            for (size_t t = 0; t < incrementalTicks; t++) {
+                tracked.push(sample(next++));
+                check += tracked.mean() + tracked.variance() + tracked.min() + tracked.max();
+            }
+            doNotOptimize(check);
+        }));
+    }
+}
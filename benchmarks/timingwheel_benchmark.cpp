@@ -0,0 +1,149 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "doublelinkedlist.h"
+#include "priorityqueue.h"
+#include "timingwheel.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    const uint64_t maxDelay = 60000; // Timeouts up to a minute at one tick per millisecond
+
+    struct Random {
+        uint32_t state = 2463534242u;
+        uint32_t next() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+        uint64_t delay() { return 1 + next() % maxDelay; }
+    };
+
+    struct HeapTimer {
+        uint64_t deadline;
+        std::function<void()> callback;
+        bool operator<(const HeapTimer& other) const { return deadline < other.deadline; }
+    };
+
+    struct ListTimer {
+        uint64_t deadline;
+        uint32_t id;
+        std::function<void()> callback;
+        bool operator==(const ListTimer& other) const { return id == other.id; }
+    };
+
+    // The timer set the control loop keeps today: a DoubleLinkedList sorted by deadline
+    class SortedListTimers {
+    public:
+        uint32_t schedule(uint64_t deadline, std::function<void()> callback) {
+            const ListTimer timer{deadline, nextId, std::move(callback)};
+            DoubleNode<ListTimer>* position = list.getHead();
+            while (position && position->getData().deadline <= deadline) position = position->next;
+            if (position) {
+                list.insertBefore(position, timer);
+            } else {
+                list.insert(timer);
+            }
+            return nextId++;
+        }
+        void cancel(uint32_t id) { list.removeNode(list.findNode(ListTimer{0, id, nullptr})); }
+        size_t advance(uint64_t now) {
+            size_t fired = 0;
+            while (list.getHead() && list.getHead()->getData().deadline <= now) {
+                std::function<void()> callback = std::move(list.getHead()->getData().callback);
+                list.removeNode(list.getHead());
+                callback();
+                fired++;
+            }
+            return fired;
+        }
+
+    private:
+        DoubleLinkedList<ListTimer> list;
+        uint32_t nextId = 0;
+    };
+
+    // Schedule count timers, push back `resets` random ones (a watchdog fed), then fire them all
+    template<typename Schedule, typename Reset, typename FireAll>
+    void run(const std::string& name, size_t count, size_t resets, Schedule&& schedule, Reset&& reset, FireAll&& fireAll) {
+        report(name + ", schedule", measure(count, schedule, 1));
+        report(name + ", cancel + reschedule", measure(resets, reset));
+        report(name + ", fire all", measure(count, fireAll, 1));
+    }
+}
+
+void runTimingWheelBenchmark() {
+    for (size_t count : {10000, 100000, 1000000}) {
+        std::cout << "=== " << count << " outstanding timers, delays up to 60 s in 1 ms ticks (ns per timer) ===" << std::endl;
+        const size_t resets = 1 << 16;
+        size_t fired = 0;
+        auto onFire = [&fired] { fired++; };
+
+        {
+            TimingWheel<> wheel;
+            std::vector<SlotHandle> handles(count);
+            Random random;
+            run("TimingWheel", count, resets,
+                [&] {
+                    for (size_t i = 0; i < count; i++) handles[i] = wheel.schedule(random.delay(), onFire);
+                },
+                [&] {
+                    for (size_t i = 0; i < resets; i++) {
+                        SlotHandle& handle = handles[random.next() % count];
+                        wheel.cancel(handle);
+                        handle = wheel.schedule(random.delay(), onFire);
+                    }
+                },
+                [&] { doNotOptimize(wheel.advance(wheel.getNow() + maxDelay)); });
+        }
+
+        {
+            PriorityQueue<HeapTimer> heap;
+            std::vector<SlotHandle> handles(count);
+            uint64_t now = 0;
+            Random random;
+            run("PriorityQueue<4>", count, resets,
+                [&] {
+                    for (size_t i = 0; i < count; i++) handles[i] = heap.push({now + random.delay(), onFire});
+                },
+                [&] {
+                    for (size_t i = 0; i < resets; i++) {
+                        SlotHandle& handle = handles[random.next() % count];
+                        heap.erase(handle);
+                        handle = heap.push({now + random.delay(), onFire});
+                    }
+                },
+                [&] {
+                    now += maxDelay;
+                    while (!heap.isEmpty() && heap.top().deadline <= now) heap.pop().callback();
+                });
+        }
+
+        if (count <= 10000) {
+            SortedListTimers list;
+            std::vector<uint32_t> ids(count);
+            Random random;
+            run("Sorted DoubleLinkedList", count, resets / 64,
+                [&] {
+                    for (size_t i = 0; i < count; i++) ids[i] = list.schedule(random.delay(), onFire);
+                },
+                [&] {
+                    for (size_t i = 0; i < resets / 64; i++) {
+                        uint32_t& id = ids[random.next() % count];
+                        list.cancel(id);
+                        id = list.schedule(random.delay(), onFire);
+                    }
+                },
+                [&] { doNotOptimize(list.advance(maxDelay)); });
+        }
+        doNotOptimize(fired);
+    }
+}
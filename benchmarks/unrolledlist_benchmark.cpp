@@ -0,0 +1,67 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "linkedlist.h"
+#include "unrolledlist.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    // Sums the list through its forward iterator, the way algorithm code walks it
+    template<typename List>
+    double traverse(const List& list) {
+        return measure(list.getSize(), [&] {
+            float sum = 0.0f;
+            for (float value : list) sum += value;
+            doNotOptimize(sum);
+        });
+    }
+
+    // Appends in order, so a pooled list gets its nodes in allocation order
+    template<typename List>
+    void fillLinked(List& list, size_t count) {
+        for (size_t i = 0; i < count; i++) list.insert(static_cast<float>(i));
+    }
+}
+
+void runUnrolledListBenchmark() {
+    std::cout << "=== Full traversal of a float list: LinkedList vs UnrolledList (ns per element) ===" << std::endl;
+    for (size_t count : {size_t{10000}, size_t{1000000}}) {
+        const std::string suffix = " (" + std::to_string(count) + ")";
+
+        LinkedList<float> pooled;
+        fillLinked(pooled, count);
+        report("LinkedList, NodePool" + suffix, traverse(pooled));
+
+        // Four lists grown side by side on the heap, as long-lived lists end up: neighbours are never adjacent
+        std::vector<std::unique_ptr<LinkedList<float, std::allocator>>> interleaved;
+        for (int i = 0; i < 4; i++) interleaved.push_back(std::make_unique<LinkedList<float, std::allocator>>());
+        for (size_t i = count; i > 0; i--) {
+            for (auto& list : interleaved) list->insert(static_cast<float>(i - 1), LinkedList<float, std::allocator>::HEAD);
+        }
+        report("LinkedList, heap, interleaved" + suffix, traverse(*interleaved.front()));
+        interleaved.clear();
+
+        UnrolledList<float, 64> unrolled64;
+        for (size_t i = 0; i < count; i++) unrolled64.insert(static_cast<float>(i));
+        report("UnrolledList, 64 byte nodes" + suffix, traverse(unrolled64));
+
+        UnrolledList<float> unrolled;
+        for (size_t i = 0; i < count; i++) unrolled.insert(static_cast<float>(i));
+        report("UnrolledList, 128 byte nodes" + suffix, traverse(unrolled));
+
+        UnrolledList<float, 512> unrolled512;
+        for (size_t i = 0; i < count; i++) unrolled512.insert(static_cast<float>(i));
+        report("UnrolledList, 512 byte nodes" + suffix, traverse(unrolled512));
+    }
+
+    std::cout << "=== Memory per element ===" << std::endl;
+    std::cout << "  LinkedList<float>:   " << sizeof(SingleNode<float>) << " bytes" << std::endl;
+    std::cout << "  UnrolledList<float>: " << static_cast<double>(sizeof(UnrolledList<float>::Node)) / UnrolledList<float>::nodeCapacity
+              << " bytes (full nodes)" << std::endl;
+}
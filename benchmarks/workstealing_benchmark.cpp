@@ -0,0 +1,165 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "queue.h"
+#include "stack.h"
+#include "threadpool.h"
+#include "workstealingdeque.h"
+using namespace CommandaStructures;
+using namespace CommandaStructures::Bench;
+
+namespace {
+    // The usual first pool: one Queue of std::function behind one mutex, every worker and every submit takes it
+    class SharedQueuePool {
+    public:
+        explicit SharedQueuePool(size_t threads) {
+            for (size_t i = 0; i < threads; i++) {
+                workers.emplace_back([this] {
+                    while (true) {
+                        std::function<void()> task;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            wakeUp.wait(lock, [this] { return stopping || !tasks.isEmpty(); });
+                            if (tasks.isEmpty()) return;
+                            task = tasks.pop();
+                        }
+                        task();
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (--unfinished == 0) allDone.notify_all();
+                    }
+                });
+            }
+        }
+        ~SharedQueuePool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wakeUp.notify_all();
+            for (auto& worker : workers) worker.join();
+        }
+        void submit(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                tasks.push(std::move(task));
+                unfinished++;
+            }
+            wakeUp.notify_one();
+        }
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            allDone.wait(lock, [this] { return unfinished == 0; });
+        }
+    private:
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::condition_variable allDone;
+        Queue<std::function<void()>> tasks;
+        size_t unfinished = 0;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+    };
+
+    // A few hundred nanoseconds of dependent arithmetic, standing in for one small tile
+    unsigned work(unsigned seed) {
+        for (int i = 0; i < 200; i++) seed = seed * 1664525u + 1013904223u;
+        return seed;
+    }
+
+    // tasks independent tasks submitted from the calling thread
+    template<typename Pool>
+    double flatFanOut(size_t threads, size_t tasks) {
+        Pool pool(threads);
+        std::atomic<unsigned> checksum{0};
+        return measure(tasks, [&] {
+            for (size_t i = 0; i < tasks; i++) {
+                pool.submit([&checksum, i] { checksum.fetch_add(work(static_cast<unsigned>(i)), std::memory_order_relaxed); });
+            }
+            pool.wait();
+            doNotOptimize(checksum.load());
+        }, 3);
+    }
+
+    // One root task that halves its range until a leaf is one task's worth, submitting the halves from inside the pool
+    template<typename Pool>
+    double recursiveFanOut(size_t threads, size_t tasks) {
+        Pool pool(threads);
+        std::atomic<unsigned> checksum{0};
+        std::function<void(size_t, size_t)> split = [&](size_t begin, size_t end) {
+            if (end - begin == 1) {
+                checksum.fetch_add(work(static_cast<unsigned>(begin)), std::memory_order_relaxed);
+                return;
+            }
+            const size_t middle = begin + (end - begin) / 2;
+            pool.submit([&split, begin, middle] { split(begin, middle); });
+            pool.submit([&split, middle, end] { split(middle, end); });
+        };
+        return measure(tasks, [&] {
+            pool.submit([&split, tasks] { split(0, tasks); });
+            pool.wait();
+            doNotOptimize(checksum.load());
+        }, 3);
+    }
+}
+
+void runWorkStealingBenchmark() {
+    std::cout << "=== WorkStealingDeque owner path vs Stack ===" << std::endl;
+    const size_t operations = 1 << 20;
+    report("Stack push+pop (no lock)", measure(operations, [&] {
+        Stack<unsigned> stack;
+        unsigned checksum = 0;
+        for (size_t i = 0; i < operations; i++) {
+            stack.push(static_cast<unsigned>(i));
+            if (i % 4 == 3) for (int k = 0; k < 4; k++) checksum += stack.pop();
+        }
+        doNotOptimize(checksum);
+    }));
+    report("mutex Stack push+pop", measure(operations, [&] {
+        Stack<unsigned> stack;
+        std::mutex mutex;
+        unsigned checksum = 0;
+        for (size_t i = 0; i < operations; i++) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stack.push(static_cast<unsigned>(i));
+            }
+            if (i % 4 == 3) {
+                for (int k = 0; k < 4; k++) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    checksum += stack.pop();
+                }
+            }
+        }
+        doNotOptimize(checksum);
+    }));
+    report("WorkStealingDeque push_back+pop_back", measure(operations, [&] {
+        WorkStealingDeque<unsigned> deque;
+        unsigned checksum = 0;
+        unsigned value = 0;
+        for (size_t i = 0; i < operations; i++) {
+            deque.push_back(static_cast<unsigned>(i));
+            if (i % 4 == 3) for (int k = 0; k < 4; k++) checksum += deque.pop_back(value) ? value : 0;
+        }
+        doNotOptimize(checksum);
+    }));
+
+    std::cout << std::endl << "=== ThreadPool (work stealing) vs one shared mutex queue, small tasks ===" << std::endl;
+    std::cout << "  hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    const size_t tasks = 1 << 15;
+    for (size_t threads : {1, 2, 4, 8}) {
+        const std::string suffix = " (" + std::to_string(threads) + " threads)";
+        report("shared queue, flat" + suffix, flatFanOut<SharedQueuePool>(threads, tasks));
+        report("ThreadPool, flat" + suffix, flatFanOut<ThreadPool>(threads, tasks));
+        report("shared queue, recursive split" + suffix, recursiveFanOut<SharedQueuePool>(threads, tasks));
+        report("ThreadPool, recursive split" + suffix, recursiveFanOut<ThreadPool>(threads, tasks));
+    }
+}
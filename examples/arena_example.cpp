@@ -0,0 +1,47 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include "arena.h"
+#include "deque.h"
+#include "linkedlist.h"
+using namespace CommandaStructures;
+
+struct SonarPing {
+    float range;
+    float bearing;
+    unsigned timestamp;
+};
+
+void runArenaTest() {
+    /* Sample Use Case:
+     * Every mission leg builds thousands of temporary nodes while it processes sonar pings. The nodes all live in one
+     * arena: each frame's scratch deque is rolled back when the frame ends, and the whole leg is dropped with one reset().
+     */
+
+    Arena legArena(16 * 1024);
+    LinkedList<SonarPing, ArenaAllocator> contacts(legArena); // Lives for the whole leg
+
+    for (int frame = 0; frame < 5; ++frame) {
+        ArenaScope frameScope(legArena);                // Declared first, so it rolls back after scratch is gone
+        Deque<SonarPing, ArenaAllocator> scratch(legArena);
+        for (int ping = 0; ping < 200; ++ping) {
+            scratch.push_back({1.0f + ping * 0.1f, static_cast<float>(ping % 360), static_cast<unsigned>(ping)});
+        }
+        float closest = scratch.front().range;
+        for (const SonarPing& ping : scratch) {
+            closest = ping.range < closest ? ping.range : closest;
+        }
+        std::cout << "Frame " << frame << ": " << scratch.getSize() << " pings, closest " << closest << " m, arena "
+                  << legArena.bytesUsed() << " bytes" << std::endl;
+    }
+
+    std::cout << "Arena after the frames: " << legArena.bytesUsed() << " bytes used, high water "
+              << legArena.highWater() << ", reserved " << legArena.bytesReserved() << std::endl;
+
+    // Contacts were allocated outside the frames, so they survive the rollbacks. End of leg: drop everything at once.
+    contacts.insert({12.5f, 90.0f, 1});
+    contacts.clear(); // O(1): SonarPing is trivially destructible and the arena owns the memory
+    legArena.reset();
+    std::cout << "Arena after reset: " << legArena.bytesUsed() << " bytes used" << std::endl;
+}
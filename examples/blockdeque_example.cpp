@@ -0,0 +1,52 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <span>
+#include <string>
+#include "blockdeque.h"
+#include "simdkernels.h"
+using namespace CommandaStructures;
+
+void runBlockDequeTest() {
+    /* Sample Use Case:
+     * A 2 second window of 500 Hz accelerometer samples: new samples are pushed at the back, samples older than the
+     * window are popped from the front. Random access lets the detector look up the sample 20 ms back directly, and
+     * the window is summed chunk by chunk with the SIMD kernels instead of element by element.
+     */
+
+    const int rate = 500;
+    const int window = 2 * rate;
+    BlockDeque<float> samples;
+    for (int t = 0; t < 3 * rate; ++t) {
+        samples.push_back(static_cast<float>(t % 50) * 0.1f);
+        if (samples.getSize() > window) {
+            samples.pop_front();
+        }
+    }
+
+    std::cout << "Window size: " << samples.getSize() << " samples in " << samples.chunkCount() << " chunks of "
+              << BlockDeque<float>::chunkCapacity << std::endl;
+    std::cout << "Newest sample: " << samples.back() << ", 20 ms earlier: " << samples[samples.getSize() - 1 - rate / 50] << std::endl;
+
+    float chunkedSum = 0.0f;
+    for (size_t k = 0; k < samples.chunkCount(); ++k) {
+        chunkedSum += Kernels::sum(std::span<const float>(samples.chunk(k)));
+    }
+    float iteratedSum = 0.0f;
+    for (float sample : samples) iteratedSum += sample;
+    std::cout << "Window sum (chunk spans): " << chunkedSum << ", (iterator): " << iteratedSum << std::endl;
+
+    // Both ends: an undo history where the newest edit goes in front and the oldest falls off the back
+    BlockDeque<std::string> history;
+    for (int edit = 1; edit <= 6; ++edit) {
+        history.push_front("edit " + std::to_string(edit));
+        if (history.getSize() > 4) {
+            history.pop_back();
+        }
+    }
+    std::cout << "Undo history:";
+    for (const auto& entry : history) std::cout << " [" << entry << "]";
+    std::cout << std::endl;
+    std::cout << "Undo: " << history.pop_front() << ", next undo: " << history.front() << std::endl;
+}
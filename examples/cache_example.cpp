@@ -0,0 +1,81 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cache.h"
+using namespace CommandaStructures;
+
+void runCacheTest() {
+    /* Sample Use Case:
+     * The chart display keeps the last few decoded map tiles in memory, keyed by tile ID. Panning back and forth hits
+     * the cache; when a new tile is decoded and the cache is full, the tile looked at longest ago is dropped and the
+     * eviction callback writes its annotations back to disk if they were edited.
+     */
+
+    struct Tile {
+        std::vector<unsigned char> pixels;
+        bool annotated;
+    };
+
+    LruCache<unsigned, Tile> tiles(3);
+    tiles.setEvictionCallback([](const unsigned& id, Tile& tile) {
+        std::cout << "  evicted tile " << id << (tile.annotated ? " (annotations saved)" : "") << std::endl;
+    });
+    auto show = [&](unsigned id) {
+        if (Tile* tile = tiles.get(id)) {
+            std::cout << "Tile " << id << ": cached, " << tile->pixels.size() << " bytes" << std::endl;
+        } else {
+            std::cout << "Tile " << id << ": decoding" << std::endl;
+            tiles.put(id, Tile{std::vector<unsigned char>(256 * 256), false});
+        }
+    };
+    for (unsigned id : {101u, 102u, 103u, 101u}) show(id);
+    tiles.get(102)->annotated = true; // The operator marks a buoy on tile 102
+    for (unsigned id : {104u, 105u, 101u}) show(id);
+    std::cout << "Hits " << tiles.getHits() << ", misses " << tiles.getMisses() << ", evictions " << tiles.getEvictions()
+              << std::endl;
+
+    /* Sample Use Case:
+     * Sensor calibrations are looked up by sensor key. The pH and turbidity probes are read every cycle, the spare
+     * probes only during a self-test: with LFU, one burst of self-test lookups does not push the busy probes out.
+     */
+
+    LfuCache<std::string, double> calibrations(3);
+    calibrations.setEvictionCallback([](const std::string& key, double&) {
+        std::cout << "Calibration dropped: " << key << std::endl;
+    });
+    calibrations.put("ph", 7.02);
+    calibrations.put("turbidity", 0.35);
+    for (int cycle = 0; cycle < 5; ++cycle) {
+        calibrations.get("ph");
+        calibrations.get("turbidity");
+    }
+    calibrations.put("spare-ph", 6.98);        // Fills the last slot
+    calibrations.put("spare-turbidity", 0.40); // Evicts spare-ph (used once), not a busy probe
+    std::cout << "pH cached: " << (calibrations.contains("ph") ? "yes" : "no") << ", turbidity cached: "
+              << (calibrations.contains("turbidity") ? "yes" : "no") << std::endl;
+
+    /* Sample Use Case:
+     * Several worker threads render tiles at once. ShardedCache gives every shard its own lock, so workers asking for
+     * different tiles do not wait for each other.
+     */
+
+    ShardedCache<unsigned, unsigned> rendered(64, 4);
+    std::vector<std::thread> workers;
+    for (unsigned worker = 0; worker < 4; ++worker) {
+        workers.emplace_back([&rendered, worker] {
+            for (unsigned i = 0; i < 1000; ++i) {
+                const unsigned id = (i * 7 + worker) % 96;
+                unsigned checksum;
+                if (!rendered.get(id, checksum)) rendered.put(id, id * 31);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    std::cout << "Sharded cache: " << rendered.getSize() << "/" << rendered.capacity() << " entries in "
+              << rendered.getShardCount() << " shards, " << rendered.getHits() + rendered.getMisses() << " lookups"
+              << std::endl;
+}
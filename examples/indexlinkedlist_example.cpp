@@ -0,0 +1,56 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "indexlinkedlist.h"
+using namespace CommandaStructures;
+
+struct SurveyLeg {
+    float heading;
+    float distance;
+};
+
+void runIndexLinkedListTest() {
+    /* Sample Use Case:
+     * The survey plan is an ordered list of legs that the operator edits on the fly (insert a detour, drop a leg).
+     * With an IndexLinkedList the edits use handles instead of node pointers, and since no node holds an address the
+     * whole plan can be saved to flash with one memcpy and loaded back with the links still valid.
+     */
+
+    IndexLinkedList<SurveyLeg> plan;
+    auto start = plan.insert({0.0f, 100.0f});
+    auto turn = plan.insert({90.0f, 20.0f});
+    plan.insert({180.0f, 100.0f});
+    auto detour = plan.insertAfter(start, {45.0f, 10.0f}); // Go around an obstacle
+    plan.insertBefore(turn, {-45.0f, 10.0f});
+    plan.removeNode(detour);                              // Obstacle gone after all, the slot is reused next
+    plan.insert({270.0f, 20.0f});
+
+    std::cout << "Survey plan (" << plan.getSize() << " legs):" << std::endl;
+    plan.display([](const SurveyLeg& leg) {
+        std::cout << "  heading " << leg.heading << " for " << leg.distance << " m" << std::endl;
+    });
+
+    // Save the plan: the slots hold no addresses, so for a trivially copyable leg type the bytes are the whole story
+    using Node = IndexLinkedList<SurveyLeg>::Node;
+    const auto& slots = plan.getSlots();
+    std::vector<unsigned char> flash(slots.size() * sizeof(Node));
+    std::memcpy(flash.data(), slots.data(), flash.size());
+    std::cout << "Saved " << flash.size() << " bytes for " << plan.getSize() << " legs" << std::endl;
+
+    // Load it into a fresh list
+    std::vector<Node> loaded(flash.size() / sizeof(Node), Node({}, 0, 0));
+    std::memcpy(static_cast<void*>(loaded.data()), flash.data(), flash.size());
+    IndexLinkedList<SurveyLeg> restored;
+    restored.restore(std::move(loaded), plan.getHead(), plan.getTail(), plan.getFreeHead());
+    std::cout << "Restored " << restored.getSize() << " legs, first heading " << restored.get(restored.getHead()).heading << std::endl;
+
+    std::cout << "Reversed for the trip home:";
+    plan.reverse();
+    for (const SurveyLeg& leg : plan) {
+        std::cout << " " << leg.heading;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,72 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include "intrusivedoublelist.h"
+#include "intrusivelist.h"
+using namespace CommandaStructures;
+
+namespace {
+    struct ActuatorCommand {
+        int actuator;
+        float setpoint;
+        SingleHook<ActuatorCommand> hook; // Lets the command sit in a pending / free list without being copied
+    };
+
+    struct ScheduledTask {
+        const char* name;
+        unsigned dueMs;
+        DoubleHook<ScheduledTask> hook;   // O(1) cancel from anywhere in the schedule
+    };
+
+    // Static storage, nothing below allocates
+    ActuatorCommand commandSlots[8];
+    ScheduledTask tasks[] = {{"sample sonar", 10, {}}, {"log depth", 50, {}}, {"ping base", 200, {}}, {"trim ballast", 500, {}}};
+}
+
+void runIntrusiveListTest() {
+    /* Sample Use Case:
+     * The control loop owns a fixed set of actuator command slots. Free slots sit in one intrusive list, filled commands
+     * in another, and moving a slot between them is a pointer splice. Scheduled tasks live in a double list so a task
+     * can be cancelled in O(1) no matter where it is.
+     */
+
+    IntrusiveList<ActuatorCommand, &ActuatorCommand::hook> freeSlots;
+    IntrusiveList<ActuatorCommand, &ActuatorCommand::hook> pending;
+    for (ActuatorCommand& slot : commandSlots) {
+        freeSlots.insert(slot);
+    }
+
+    for (int actuator = 0; actuator < 3; ++actuator) {
+        ActuatorCommand& command = freeSlots.pop_front();
+        command.actuator = actuator;
+        command.setpoint = 0.25f * static_cast<float>(actuator + 1);
+        pending.insert(command);
+    }
+    std::cout << "Pending commands (" << pending.getSize() << "), free slots " << freeSlots.getSize() << ":" << std::endl;
+    pending.display([](const ActuatorCommand& command) {
+        std::cout << "  actuator " << command.actuator << " -> " << command.setpoint << std::endl;
+    });
+    while (!pending.isEmpty()) {
+        freeSlots.insert(pending.pop_front(), IntrusiveList<ActuatorCommand, &ActuatorCommand::hook>::HEAD); // Sent, recycle
+    }
+
+#if COMMANDA_INTRUSIVE_CHECKS
+    try {
+        freeSlots.insert(commandSlots[0]); // Already in freeSlots
+    } catch (const std::logic_error& error) {
+        std::cout << "Caught: " << error.what() << std::endl;
+    }
+#endif
+
+    IntrusiveDoubleList<ScheduledTask, &ScheduledTask::hook> schedule;
+    for (ScheduledTask& task : tasks) {
+        schedule.insert(task);
+    }
+    schedule.remove(tasks[2]); // Base station out of range, cancel the ping
+    std::cout << "Schedule after cancelling '" << tasks[2].name << "':";
+    for (const ScheduledTask& task : schedule) {
+        std::cout << " " << task.name << "@" << task.dueMs;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,68 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "lockfreequeue.h"
+using namespace CommandaStructures;
+
+void runLockFreeQueueTest() {
+    /* Sample Use Case:
+     * Every sensor thread appends log records to one shared backlog, and two writer threads drain it to the SD card.
+     * The card can stall for seconds, so the backlog depth cannot be bounded ahead of time: LockFreeQueue grows its
+     * node pool as needed instead of rejecting records like a bounded MpmcQueue would.
+     *
+     * This doubles as the stress check for the queue: every record must arrive exactly once, and the records of each
+     * sensor must arrive in the order they were logged. Build with -DCOMMANDA_TSAN=ON to run it under ThreadSanitizer.
+     */
+
+    struct LogRecord {
+        int sensor;
+        int sequence;
+        std::string line;
+    };
+
+    const int sensors = 4;
+    const int recordsPerSensor = 5000;
+    const int writers = 2;
+    LockFreeQueue<LogRecord> backlog;
+
+    std::vector<std::thread> threads;
+    for (int sensor = 0; sensor < sensors; ++sensor) {
+        threads.emplace_back([&, sensor] {
+            for (int i = 0; i < recordsPerSensor; ++i) {
+                backlog.emplace(LogRecord{sensor, i, "sensor " + std::to_string(sensor) + " reading " + std::to_string(i)});
+            }
+        });
+    }
+
+    std::atomic<int> written{0};
+    std::atomic<int> outOfOrder{0};
+    std::atomic<long> sequenceSum{0};
+    for (int writer = 0; writer < writers; ++writer) {
+        threads.emplace_back([&] {
+            std::vector<int> lastSeen(sensors, -1); // Per sensor, a single consumer must see increasing sequences
+            LogRecord record;
+            while (written.load() < sensors * recordsPerSensor) {
+                if (!backlog.try_pop(record)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (record.sequence <= lastSeen[record.sensor]) outOfOrder++;
+                lastSeen[record.sensor] = record.sequence;
+                sequenceSum += record.sequence;
+                written++;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const long expectedSum = static_cast<long>(sensors) * recordsPerSensor * (recordsPerSensor - 1) / 2;
+    std::cout << "Log records written: " << written.load() << " of " << sensors * recordsPerSensor << std::endl;
+    std::cout << "Every record exactly once: " << (sequenceSum.load() == expectedSum ? "yes" : "NO") << std::endl;
+    std::cout << "Per-sensor order kept: " << (outOfOrder.load() == 0 ? "yes" : "NO") << std::endl;
+    std::cout << "Backlog empty: " << (backlog.isEmpty() ? "yes" : "no") << std::endl;
+}
@@ -0,0 +1,58 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "lockfreestack.h"
+using namespace CommandaStructures;
+
+void runLockFreeStackTest() {
+    /* Sample Use Case:
+     * Survey grid cells waiting to be processed sit on one shared free-work stack. Worker threads take a cell, and a
+     * cell that turns out to be too large is split into four smaller ones that go straight back on the stack.
+     * No mutex: workers only ever contend on a CAS, and popped cells are reclaimed with hazard pointers.
+     */
+
+    struct GridCell {
+        int x;
+        int y;
+        int size; // Side length in metres
+    };
+
+    LockFreeStack<GridCell> work;
+    work.push({0, 0, 64});
+    work.push({64, 0, 64});
+
+    std::atomic<int> processed{0};
+    std::atomic<int> pending{2}; // Cells pushed but not yet finished, the workers stop when it reaches zero
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 4; ++w) {
+        workers.emplace_back([&] {
+            GridCell cell{};
+            while (pending.load() > 0) {
+                if (!work.try_pop(cell)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (cell.size > 16) {
+                    const int half = cell.size / 2;
+                    pending += 4;
+                    work.push({cell.x, cell.y, half});
+                    work.push({cell.x + half, cell.y, half});
+                    work.push({cell.x, cell.y + half, half});
+                    work.emplace(GridCell{cell.x + half, cell.y + half, half});
+                } else {
+                    processed++;
+                }
+                pending--;
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    std::cout << "Survey cells processed: " << processed.load() << " (expected 32)" << std::endl;
+    std::cout << "Work stack empty: " << (work.isEmpty() ? "yes" : "no")
+              << ", push/pop pairs eliminated: " << work.getEliminations() << std::endl;
+}
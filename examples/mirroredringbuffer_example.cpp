@@ -0,0 +1,61 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include "mirroredringbuffer.h"
+using namespace CommandaStructures;
+
+void runMirroredRingBufferTest() {
+    /* Sample Use Case:
+     * Telemetry frames are variable length ([length byte][payload]) and get encoded straight into the buffer.
+     * A frame that crosses the end of the buffer is still one contiguous range, so the decoder can parse it in place.
+     */
+
+    MirroredRingBuffer<uint8_t> frames(4096); // Rounded up to a whole page (4096 on most systems)
+    std::cout << "Capacity: " << frames.capacity() << " bytes" << std::endl;
+
+    int encoded = 0;
+    int decoded = 0;
+    int wrapped = 0;
+    size_t bytesRead = 0; // Only used to spot the frames that cross the end of the buffer
+    for (int round = 0; round < 200; ++round) {
+        // Encode a few frames in place
+        for (int i = 0; i < 3; ++i) {
+            char payload[64];
+            int length = std::snprintf(payload, sizeof(payload), "pH=%.2f turbidity=%.1f seq=%d", 7.0 + 0.01 * (encoded % 50), 1.5, encoded);
+            if (frames.writable() < static_cast<size_t>(length) + 1) {
+                break;
+            }
+            uint8_t* out = frames.write_ptr();
+            out[0] = static_cast<uint8_t>(length);
+            std::memcpy(out + 1, payload, length); // No need to split this copy at the end of the buffer
+            frames.commit(length + 1);
+            encoded++;
+        }
+        // Decode whatever is there, parsing each frame in place
+        while (!frames.isEmpty()) {
+            const uint8_t* in = frames.read_ptr();
+            size_t frameSize = in[0] + 1u;
+            if (bytesRead % frames.capacity() + frameSize > frames.capacity()) {
+                wrapped++;
+            }
+            if (in[1] != 'p') {
+                std::cout << "Corrupt frame!" << std::endl;
+            }
+            frames.consume(frameSize);
+            bytesRead += frameSize;
+            decoded++;
+        }
+    }
+    std::cout << "Encoded " << encoded << " frames, decoded " << decoded << ", frames that wrapped (read in place anyway): " << wrapped << std::endl;
+
+    // The usual ring buffer calls work too
+    MirroredRingBuffer<int> readings(1, true); // One page worth of ints
+    for (int i = 0; i < 5000; ++i) {
+        readings.push(i);
+    }
+    std::cout << "Overwrite mode kept " << readings.getSize() << " readings, front: " << readings.front() << ", back: " << readings.back() << std::endl;
+    std::cout << "Popped: " << readings.pop() << std::endl;
+}
@@ -0,0 +1,59 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "deque.h"
+#include "queue.h"
+#include "ringbuffer.h"
+#include "stack.h"
+using namespace CommandaStructures;
+
+struct TelemetryFrame {
+    std::string source;
+    std::vector<float> readings;
+    unsigned timestamp;
+
+    TelemetryFrame(std::string source, std::vector<float> readings, unsigned timestamp)
+        : source(std::move(source)), readings(std::move(readings)), timestamp(timestamp) {}
+};
+
+void runMoveSemanticsTest() {
+    /* Sample Use Case:
+     * Telemetry frames carry a source name and a vector of readings. They are built straight inside the uplink queue,
+     * handed between containers by moving, and the whole backlog changes owner in O(1) when the link switches.
+     */
+
+    Queue<TelemetryFrame> uplink;
+    uplink.emplace("ctd-probe", std::vector<float>{12.4f, 35.1f, 1.02f}, 100);  // Built in the node, no temporary
+    uplink.emplace("dvl", std::vector<float>{0.41f, -0.02f, 0.0f}, 101);
+    TelemetryFrame sonar("sonar", std::vector<float>(64, 0.5f), 102);
+    uplink.push(std::move(sonar));                                              // Readings buffer moves, not copied
+    std::cout << "Uplink queue holds " << uplink.getSize() << " frames" << std::endl;
+
+    // The link switches: the backlog changes owner without touching a single frame
+    Queue<TelemetryFrame> backup(std::move(uplink));
+    std::cout << "After the switch: uplink " << uplink.getSize() << ", backup " << backup.getSize() << std::endl;
+
+    // Urgent frames go on a stack, the most recent one is sent first
+    Stack<TelemetryFrame> urgent;
+    urgent.push(backup.pop());                                                  // pop() moves the frame out
+    urgent.emplace("leak-sensor", std::vector<float>{1.0f}, 103);
+    std::cout << "Urgent first: " << urgent.top().source << std::endl;
+
+    // Recent history: a deque for replay, and a small overwriting ring buffer for the last two frames
+    Deque<TelemetryFrame> replay;
+    RingBuffer<TelemetryFrame, 2, OverflowPolicy::Overwrite> lastTwo;
+    while (!backup.isEmpty()) {
+        TelemetryFrame frame = backup.pop();
+        lastTwo.push(frame);                                                    // Keeps a copy
+        replay.push_back(std::move(frame));                                     // The original moves on
+    }
+    replay.emplace_front("mission-start", std::vector<float>{}, 99);
+    for (const TelemetryFrame& frame : replay) {
+        std::cout << "Replay " << frame.timestamp << " " << frame.source << " (" << frame.readings.size() << " readings)" << std::endl;
+    }
+    std::cout << "Last two frames: " << lastTwo.front().source << ", " << lastTwo.back().source << std::endl;
+}
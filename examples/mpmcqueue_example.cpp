@@ -0,0 +1,63 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mpmcqueue.h"
+using namespace CommandaStructures;
+
+void runMpmcQueueTest() {
+    /* Sample Use Case:
+     * The GPS, IMU and pH probe drivers each run on their own thread and feed one shared uplink queue,
+     * two uplink workers drain it. No global lock, and the queue never allocates after construction.
+     */
+
+    struct Packet {
+        int sensorId;   // 0 = GPS, 1 = IMU, 2 = pH
+        int sequence;
+        double reading;
+    };
+
+    MpmcQueue<Packet> uplinkQueue(128);
+    const int packetsPerSensor = 500;
+    const int sensors = 3;
+    std::atomic<int> sent{0};
+    std::atomic<int> perSensor[sensors] = {0, 0, 0};
+
+    std::vector<std::thread> drivers;
+    for (int sensor = 0; sensor < sensors; ++sensor) {
+        drivers.emplace_back([&, sensor] {
+            for (int i = 0; i < packetsPerSensor; ++i) {
+                uplinkQueue.push({sensor, i, 7.0 + 0.001 * i}); // Blocks (spins/yields) while the queue is full
+            }
+        });
+    }
+
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 2; ++worker) {
+        workers.emplace_back([&] {
+            Packet packet{};
+            while (sent.load() < sensors * packetsPerSensor) {
+                if (uplinkQueue.try_pop(packet)) {
+                    perSensor[packet.sensorId]++;
+                    sent++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& driver : drivers) driver.join();
+    for (auto& worker : workers) worker.join();
+
+    const std::string names[sensors] = {"GPS", "IMU", "pH"};
+    for (int sensor = 0; sensor < sensors; ++sensor) {
+        std::cout << names[sensor] << " packets sent: " << perSensor[sensor].load() << std::endl;
+    }
+    std::cout << "Queue size after draining: " << uplinkQueue.getSize() << std::endl;
+    std::cout << "Is queue empty? " << (uplinkQueue.isEmpty() ? "Yes" : "No") << std::endl;
+}
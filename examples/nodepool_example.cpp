@@ -0,0 +1,53 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <memory>
+#include "deque.h"
+#include "queue.h"
+using namespace CommandaStructures;
+
+struct Waypoint {
+    double latitude;
+    double longitude;
+};
+
+void runNodePoolTest() {
+    /* Sample Use Case:
+     * The mission planner keeps up to 64 pending waypoints in a Queue. Reserving the node pool up front means the
+     * mission loop never touches the heap, and the high-water mark shows how deep the queue actually got.
+     */
+
+    Queue<Waypoint> waypoints;
+    waypoints.getAllocator().reserve(64);
+    for (int leg = 0; leg < 10; ++leg) {
+        for (int i = 0; i < 5 + leg; ++i) {
+            waypoints.push({43.0 + 0.001 * i, -79.0 - 0.001 * leg});
+        }
+        while (waypoints.getSize() > 3) {
+            waypoints.pop(); // Reached, the node goes back to the pool
+        }
+    }
+    std::cout << "Waypoints pending: " << waypoints.getSize() << std::endl;
+    std::cout << "Nodes in use: " << waypoints.getAllocator().inUse()
+              << ", high water: " << waypoints.getAllocator().highWater()
+              << ", reserved: " << waypoints.getAllocator().reserved()
+              << ", slabs: " << waypoints.getAllocator().slabCount() << std::endl;
+
+    // After a burst (a survey pattern with hundreds of points) the queue drains again, shrink() hands the empty slabs back
+    for (int i = 0; i < 500; ++i) {
+        waypoints.push({43.1 + 0.0001 * i, -79.1});
+    }
+    while (waypoints.getSize() > 3) {
+        waypoints.pop();
+    }
+    size_t released = waypoints.getAllocator().shrink();
+    std::cout << "Survey done, released " << released << " nodes, reserved: " << waypoints.getAllocator().reserved()
+              << ", slabs: " << waypoints.getAllocator().slabCount() << std::endl;
+
+    // The old behavior (one new/delete per node) is still available by passing std::allocator
+    Deque<int, std::allocator> heapDeque;
+    heapDeque.push_back(1);
+    heapDeque.push_front(0);
+    std::cout << "Heap-allocated deque front: " << heapDeque.front() << ", back: " << heapDeque.back() << std::endl;
+}
@@ -0,0 +1,96 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "priorityqueue.h"
+using namespace CommandaStructures;
+
+void runPriorityQueueTest() {
+    /* Sample Use Case:
+     * The mission planner runs A* over a coarse occupancy grid of the lake; weed beds (~) cost four times as much to
+     * cross as open water. The open set is a PriorityQueue ordered by
+     * estimated total cost; when a cheaper path to a cell already in the open set is found, decrease_key lowers its
+     * cost in place instead of pushing a duplicate.
+     */
+
+    const std::vector<std::string> lake = {
+        "S..#..~..~",
+        ".~........",
+        "~..~..##~.",
+        "~~....~...",
+        ".~.~.~#..~",
+        "~#...~#.~.",
+        "~..#~...~G",
+    };
+    const int width = static_cast<int>(lake[0].size());
+    const int height = static_cast<int>(lake.size());
+    const int start = 0;
+    const int goal = height * width - 1;
+    auto estimate = [&](int cell) { return std::abs(cell % width - goal % width) + std::abs(cell / width - goal / width); };
+
+    struct OpenCell {
+        int cost; // Path so far plus the estimate to the goal
+        int cell;
+        bool operator<(const OpenCell& other) const { return cost < other.cost || (cost == other.cost && cell < other.cell); }
+    };
+    PriorityQueue<OpenCell> open;
+    std::vector<int> pathCost(width * height, -1);
+    std::vector<int> cameFrom(width * height, -1);
+    std::vector<SlotHandle> inOpen(width * height);
+    pathCost[start] = 0;
+    inOpen[start] = open.push({estimate(start), start});
+    int expanded = 0;
+    int lowered = 0;
+    while (!open.isEmpty()) {
+        const int cell = open.pop().cell;
+        if (cell == goal) break;
+        ++expanded;
+        const int x = cell % width;
+        const int y = cell / width;
+        const int dx[] = {1, 0, -1, 0};
+        const int dy[] = {0, 1, 0, -1};
+        for (int d = 0; d < 4; ++d) {
+            const int nx = x + dx[d];
+            const int ny = y + dy[d];
+            if (nx < 0 || ny < 0 || nx >= width || ny >= height || lake[ny][nx] == '#') continue;
+            const int next = ny * width + nx;
+            const int cost = pathCost[cell] + (lake[ny][nx] == '~' ? 4 : 1);
+            if (pathCost[next] != -1 && cost >= pathCost[next]) continue;
+            pathCost[next] = cost;
+            cameFrom[next] = cell;
+            if (open.contains(inOpen[next])) {
+                open.decrease_key(inOpen[next], {cost + estimate(next), next});
+                ++lowered;
+            } else {
+                inOpen[next] = open.push({cost + estimate(next), next});
+            }
+        }
+    }
+
+    std::vector<std::string> route = lake;
+    for (int cell = cameFrom[goal]; cell != start && cell != -1; cell = cameFrom[cell]) route[cell / width][cell % width] = lake[cell / width][cell % width] == '~' ? '@' : '*';
+    for (const std::string& row : route) std::cout << row << std::endl;
+    std::cout << "Route length " << pathCost[goal] << ", cells expanded " << expanded << ", costs lowered in place "
+              << lowered << std::endl;
+
+    /* Sample Use Case:
+     * Waypoint deadlines, heapified in one go when a mission is loaded. One waypoint is cancelled through its handle
+     * before its turn comes.
+     */
+
+    const std::vector<int> deadlines = {540, 120, 300, 90, 720, 260};
+    PriorityQueue<int, 2> schedule;
+    const std::vector<SlotHandle> handles = schedule.assign(deadlines.begin(), deadlines.end());
+    schedule.erase(handles[2]); // The 300 s waypoint is cancelled
+    std::cout << "Deadlines in order:";
+    while (!schedule.isEmpty()) std::cout << " " << schedule.pop();
+    std::cout << std::endl;
+    try {
+        schedule.get(handles[2]);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Cancelled waypoint: " << e.what() << std::endl;
+    }
+}
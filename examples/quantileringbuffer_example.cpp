@@ -0,0 +1,36 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cmath>
+#include <iostream>
+#include "quantileringbuffer.h"
+using namespace CommandaStructures;
+
+void runQuantileRingBufferTest() {
+    /* Sample Use Case:
+     * The turbidity probe throws the odd spike. The despiking filter keeps the last 31 readings and replaces any reading
+     * that lies more than one band width outside the window's 5th..95th percentile band with the running median.
+     */
+
+    QuantileRingBuffer<float> turbidity(31);
+    int replaced = 0;
+    for (int tick = 0; tick < 200; ++tick) {
+        float reading = 12.0f + 0.5f * std::sin(tick * 0.1f);
+        if (tick % 37 == 0) {
+            reading = 80.0f; // Bubble passing the optical window
+        }
+        turbidity.push(reading);
+        const float low = turbidity.percentile(5);
+        const float high = turbidity.percentile(95);
+        if (turbidity.isFull() && (reading < low - (high - low) || reading > high + (high - low))) {
+            reading = turbidity.median();
+            replaced++;
+        }
+    }
+
+    std::cout << "Replaced " << replaced << " readings" << std::endl;
+    std::cout << "Median: " << turbidity.median() << ", 5th: " << turbidity.percentile(5)
+              << ", 95th: " << turbidity.percentile(95) << std::endl;
+    std::cout << "Min: " << turbidity.min() << ", max: " << turbidity.max() << std::endl;
+    std::cout << "Readings below 12 NTU: " << turbidity.countBelow(12.0f) << " of " << turbidity.getSize() << std::endl;
+}
@@ -65,4 +65,66 @@ void runRingBufferTest() {
     tempBuffer.clear();
     std::cout << "Buffer size after clearing: " << tempBuffer.getSize() << std::endl;
     std::cout << "Is buffer empty after clearing? " << (tempBuffer.isEmpty() ? "Yes" : "No") << std::endl;
-}
\ No newline at end of file
+}
+void runRingBufferBulkTest() {
+    /* Sample Use Case:
+     * The LoRa uplink drains a whole window of pH samples at once. The serializer reads them straight out of the
+     * buffer's storage (no per-sample pop) and then commits what it sent with a single consume().
+     */
+
+    RingBuffer<float> pHBuffer(16, true);
+    float burst[20];
+    for (int i = 0; i < 20; ++i) {
+        burst[i] = 7.0f + 0.01f * i;
+    }
+    pHBuffer.push_bulk(burst); // Overwrite mode keeps the newest 16 of the 20 samples
+    std::cout << "Buffer size after bulk push: " << pHBuffer.getSize() << std::endl;
+
+    // Zero-copy read: the data may wrap around the end of the slot array, so it comes back as two segments
+    size_t serialized = 0;
+    for (std::span<float> segment : pHBuffer.peek_contiguous()) {
+        for (float sample : segment) {
+            std::cout << sample << " ";
+        }
+        serialized += segment.size();
+    }
+    std::cout << std::endl;
+    pHBuffer.consume(serialized / 2); // Pretend only half of the packet fit into this LoRa window
+    std::cout << "Buffer size after consume: " << pHBuffer.getSize() << std::endl;
+
+    // Copying drain of whatever is left
+    float packet[16];
+    size_t popped = pHBuffer.pop_bulk(packet);
+    std::cout << "Popped " << popped << " samples, first: " << packet[0] << ", last: " << packet[popped - 1] << std::endl;
+    std::cout << "Is buffer empty? " << (pHBuffer.isEmpty() ? "Yes" : "No") << std::endl;
+}
+
+// Fixed capacity, compile-time policy: the whole buffer is in .bss, nothing is ever allocated
+static RingBuffer<int, 8, OverflowPolicy::Overwrite> watchdogTicks;
+
+void runFixedRingBufferTest() {
+    /* Sample Use Case:
+     * On the safety MCU there is no heap. The last 8 watchdog ticks live in a static buffer, and a small
+     * command history lives on the stack and rejects new commands instead of overwriting when full.
+     */
+
+    for (int tick = 0; tick < 20; ++tick) {
+        watchdogTicks.push(tick); // Overwrite policy: push never fails, the oldest tick is dropped
+    }
+    std::cout << "Watchdog buffer holds " << watchdogTicks.getSize() << " of " << watchdogTicks.capacity() << " ticks: ";
+    for (int tick : watchdogTicks) {
+        std::cout << tick << " ";
+    }
+    std::cout << std::endl;
+
+    RingBuffer<char, 4> commandHistory; // Default policy is Reject
+    for (char command : {'F', 'L', 'R', 'S', 'B'}) {
+        try {
+            commandHistory.push(command);
+        } catch (const std::runtime_error& e) {
+            std::cout << "Rejected '" << command << "': " << e.what() << std::endl;
+        }
+    }
+    std::cout << "Oldest command: " << commandHistory.front() << ", newest command: " << commandHistory.back() << std::endl;
+    std::cout << "Popped: " << commandHistory.pop() << ", size now: " << commandHistory.getSize() << std::endl;
+}
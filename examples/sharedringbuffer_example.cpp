@@ -0,0 +1,70 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "sharedringbuffer.h"
+using namespace CommandaStructures;
+
+void runSharedRingBufferTest() {
+    /* Sample Use Case:
+     * Acquisition and uplink run as separate processes so a crash in one cannot take down the other.
+     * The acquisition process creates the buffer, the uplink process attaches to it by name and reads the samples
+     * in place from shared memory.
+     * fork() stands in for the second process here, a real uplink binary would just use the same name.
+     */
+
+    struct TurbiditySample {
+        double ntu;        // Turbidity in NTU
+        long timestamp;    // Timestamp of the reading
+    };
+
+    const char* name = "/commanda_turbidity_example";
+    const int samples = 500;
+    SharedRingBuffer<TurbiditySample> acquisition(name, 64); // Creates (and later unlinks) the shared-memory object
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        // Uplink process
+        int exitCode = 1;
+        try {
+            SharedRingBuffer<TurbiditySample> uplink(name); // Attach by name
+            int received = 0;
+            long lastTimestamp = 0;
+            while (received < samples) {
+                auto segments = uplink.peek_contiguous();
+                size_t batch = 0;
+                for (const auto& segment : segments) {
+                    for (const TurbiditySample& sample : segment) { // Read straight out of shared memory
+                        lastTimestamp = sample.timestamp;
+                    }
+                    batch += segment.size();
+                }
+                if (batch == 0) {
+                    usleep(100);
+                    continue;
+                }
+                uplink.consume(batch);
+                received += static_cast<int>(batch);
+            }
+            std::cout << "Uplink process received " << received << " samples, last timestamp: " << lastTimestamp << std::endl;
+            exitCode = 0;
+        } catch (const std::exception& e) {
+            std::cout << "Uplink error: " << e.what() << std::endl;
+        }
+        _exit(exitCode); // Skip the parent's destructors (the parent owns the name)
+    }
+
+    // Acquisition process
+    for (int i = 0; i < samples; ++i) {
+        TurbiditySample sample{1.5 + 0.001 * i, 1622547800L + i};
+        while (!acquisition.try_push(sample)) {
+            usleep(100); // Uplink is behind
+        }
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    std::cout << "Uplink process exited with " << (WIFEXITED(status) ? WEXITSTATUS(status) : -1) << std::endl;
+    std::cout << "Is buffer empty? " << (acquisition.isEmpty() ? "Yes" : "No") << std::endl;
+}
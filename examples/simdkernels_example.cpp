@@ -0,0 +1,39 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <vector>
+#include "ringbuffer.h"
+#include "simdkernels.h"
+using namespace CommandaStructures;
+
+void runSimdKernelsTest() {
+    /* Sample Use Case:
+     * The hydrophone front end fills a window of raw ADC counts. Once per frame the whole window is calibrated to
+     * volts, then the RMS level, peak values and a smoothed (FIR) value are taken in one vectorized pass each.
+     */
+
+    static const char* levelNames[] = {"scalar", "SSE2", "AVX2"};
+    std::cout << "Kernels use: " << levelNames[static_cast<int>(Kernels::activeSimdLevel())] << std::endl;
+
+    RingBuffer<float> hydrophone(1000, true);
+    for (int i = 0; i < 1300; ++i) {
+        hydrophone.push(static_cast<float>(2048 + (i % 50) - 25)); // Wraps, so the window is two segments
+    }
+
+    Kernels::scaleOffset(hydrophone, 3.3f / 4096.0f, -1.65f); // ADC counts -> volts, in place
+    auto [low, high] = Kernels::minMax(hydrophone);
+    std::cout << "Mean: " << Kernels::sum(hydrophone) / hydrophone.getSize() << " V, RMS: " << Kernels::rms(hydrophone)
+              << " V, peak-to-peak: " << high - low << " V" << std::endl;
+
+    std::vector<float> taps(hydrophone.getSize(), 0.0f);
+    for (size_t i = taps.size() - 8; i < taps.size(); ++i) {
+        taps[i] = 1.0f / 8.0f; // Moving average over the newest 8 samples
+    }
+    std::cout << "Smoothed latest value: " << Kernels::dot(hydrophone, taps) << " V" << std::endl;
+
+    // Same window through the scalar loops, the results only differ in rounding
+    Kernels::setSimdLevel(Kernels::SimdLevel::Scalar);
+    std::cout << "Scalar RMS: " << Kernels::rms(hydrophone) << " V" << std::endl;
+    Kernels::setSimdLevel(Kernels::detectedSimdLevel());
+}
@@ -0,0 +1,69 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include "doublelinkedlist.h"
+#include "linkedlist.h"
+#include "slotmap.h"
+using namespace CommandaStructures;
+
+void runSlotMapTest() {
+    /* Sample Use Case:
+     * The tracker owns every detected object in one SlotMap. The avoidance planner keeps the objects close to the boat
+     * in one list and the route keeps the buoys it steers around in another; both store handles, not pointers. When
+     * the tracker drops an object, the lists are not told: their handles simply stop resolving.
+     */
+
+    struct TrackedObject {
+        std::string kind;
+        double range; // Metres from the boat
+    };
+
+    SlotMap<TrackedObject> tracker;
+    const SlotHandle buoyA = tracker.insert({"buoy A", 120.0});
+    const SlotHandle buoyB = tracker.insert({"buoy B", 45.0});
+    const SlotHandle kayak = tracker.emplace(TrackedObject{"kayak", 18.0});
+    const SlotHandle debris = tracker.emplace(TrackedObject{"floating debris", 30.0});
+
+    LinkedList<SlotHandle> nearby;       // Avoidance planner: objects closer than 50 m
+    DoubleLinkedList<SlotHandle> route;  // Route: buoys to round, in order
+    for (SlotHandle handle : {buoyB, kayak, debris}) nearby.insert(handle);
+    route.insert(buoyA);
+    route.insert(buoyB);
+
+    auto show = [&](const char* title, auto& list) {
+        std::cout << title << ":";
+        for (SlotHandle handle : list) {
+            if (const TrackedObject* object = tracker.find(handle)) {
+                std::cout << " [" << object->kind << " @ " << object->range << " m]";
+            } else {
+                std::cout << " [gone]";
+            }
+        }
+        std::cout << std::endl;
+    };
+    show("Nearby", nearby);
+    show("Route", route);
+
+    // The kayak leaves the sensor range and the debris is reclassified: both are dropped by the tracker
+    tracker.erase(kayak);
+    tracker.erase(debris);
+    const SlotHandle swimmer = tracker.insert({"swimmer", 12.0}); // Reuses a freed slot with a new generation
+    std::cout << "Swimmer reuses slot " << swimmer.index() << " (kayak had " << kayak.index() << ", debris had " << debris.index()
+              << "), generation " << swimmer.generation() << std::endl;
+    std::cout << "Kayak handle still valid: " << (tracker.contains(kayak) ? "yes" : "no") << std::endl;
+    show("Nearby after the drop", nearby);
+
+    tracker.at(buoyB).range = 38.5; // Updated in place through the handle
+    show("Route after update", route);
+
+    std::cout << "All tracked objects (dense order):";
+    for (const TrackedObject& object : tracker) std::cout << " " << object.kind;
+    std::cout << std::endl;
+    try {
+        tracker.at(kayak);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Stale lookup: " << e.what() << std::endl;
+    }
+}
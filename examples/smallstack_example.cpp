@@ -0,0 +1,72 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "smallstack.h"
+using namespace CommandaStructures;
+
+void runSmallStackTest() {
+    /* Sample Use Case:
+     * The mission script evaluates threshold expressions written in reverse Polish notation. The operand stack is never
+     * more than a handful deep, so SmallStack keeps it inside the evaluator's stack frame and no push allocates.
+     */
+
+    const std::string expression = "3 4 + 2 * 7 -"; // (3 + 4) * 2 - 7
+    SmallStack<double, 8> operands;
+    for (size_t i = 0; i < expression.size(); ++i) {
+        const char c = expression[i];
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            operands.push(c - '0');
+        } else if (c != ' ') {
+            const double right = operands.pop();
+            double& left = operands.top(); // Reference into the array, updated in place
+            if (c == '+') left += right;
+            if (c == '-') left -= right;
+            if (c == '*') left *= right;
+            if (c == '/') left /= right;
+        }
+    }
+    std::cout << expression << " = " << operands.pop() << " (inline: " << (operands.isInline() ? "yes" : "no") << ")" << std::endl;
+
+    /* Sample Use Case:
+     * The path planner backtracks through a 12x12 occupancy grid with a depth-first search. Short detours stay inside
+     * the 16 inline slots, a long corridor spills to the heap once and keeps that buffer for the rest of the search.
+     */
+
+    struct Cell {
+        int x;
+        int y;
+    };
+    const int size = 12;
+    std::vector<std::string> grid(size, std::string(size, '.'));
+    for (int y = 1; y < size - 1; ++y) grid[y][6] = '#'; // A wall with gaps at the top and bottom
+
+    std::vector<bool> visited(size * size, false);
+    SmallStack<Cell, 16> path;
+    path.emplace(Cell{0, 0});
+    visited[0] = true;
+    size_t deepest = 0;
+    while (!path.isEmpty()) {
+        const Cell here = path.top();
+        if (here.x == size - 1 && here.y == size - 1) break;
+        deepest = std::max(deepest, static_cast<size_t>(path.getSize()));
+        bool moved = false;
+        const int dx[] = {1, 0, -1, 0};
+        const int dy[] = {0, 1, 0, -1};
+        for (int d = 0; d < 4 && !moved; ++d) {
+            const int nx = here.x + dx[d];
+            const int ny = here.y + dy[d];
+            if (nx < 0 || ny < 0 || nx >= size || ny >= size || grid[ny][nx] == '#' || visited[ny * size + nx]) continue;
+            visited[ny * size + nx] = true;
+            path.emplace(Cell{nx, ny});
+            moved = true;
+        }
+        if (!moved) path.pop(); // Dead end, backtrack
+    }
+    std::cout << "Path to the goal: " << path.getSize() << " cells, deepest stack " << deepest << ", capacity "
+              << path.capacity() << " (inline: " << (path.isInline() ? "yes" : "no") << ")" << std::endl;
+}
@@ -0,0 +1,62 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <thread>
+#include "spscringbuffer.h"
+using namespace CommandaStructures;
+
+void runSpscRingBufferTest() {
+    /* Sample Use Case:
+     * The sensor acquisition thread hands IMU readings to the logging thread without a mutex.
+     * The acquisition thread is the only producer, the logging thread the only consumer.
+     */
+
+    struct ImuReading {
+        float accelX, accelY, accelZ;
+        int timestamp; // Timestamp of the reading
+    };
+
+    SpscRingBuffer<ImuReading> imuBuffer(64); // Capacity is rounded up to a power of two (64 already is)
+    const int readings = 1000;
+
+    std::thread acquisition([&] {
+        for (int i = 0; i < readings; ++i) {
+            ImuReading reading{0.01f * i, 0.0f, 9.81f, 1622547800 + i};
+            while (!imuBuffer.try_push(reading)) {
+                std::this_thread::yield(); // Logger is behind, let it catch up (a real driver might drop or count the sample)
+            }
+        }
+    });
+
+    std::thread logger([&] {
+        int received = 0;
+        int lastTimestamp = 0;
+        bool inOrder = true;
+        ImuReading reading{};
+        while (received < readings) {
+            if (imuBuffer.try_pop(reading)) {
+                inOrder = inOrder && reading.timestamp > lastTimestamp;
+                lastTimestamp = reading.timestamp;
+                received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        std::cout << "Logger received " << received << " readings, in order? " << (inOrder ? "Yes" : "No") << std::endl;
+        std::cout << "Last timestamp: " << lastTimestamp << std::endl;
+    });
+
+    acquisition.join();
+    logger.join();
+    std::cout << "Is buffer empty? " << (imuBuffer.isEmpty() ? "Yes" : "No") << std::endl;
+
+    // Overwrite mode: the producer never blocks, when the logger falls behind the oldest readings are dropped
+    SpscRingBuffer<ImuReading, OverflowPolicy::Overwrite> latestReadings(8);
+    for (int i = 0; i < 20; ++i) {
+        latestReadings.try_push({0.0f, 0.0f, 9.81f, 1622547800 + i});
+    }
+    ImuReading oldest{};
+    latestReadings.try_pop(oldest);
+    std::cout << "Overwrite mode kept " << latestReadings.getSize() + 1 << " readings, oldest timestamp: " << oldest.timestamp << std::endl;
+}
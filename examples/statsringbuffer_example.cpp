@@ -0,0 +1,36 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cmath>
+#include <iostream>
+#include "statsringbuffer.h"
+using namespace CommandaStructures;
+
+void runStatsRingBufferTest() {
+    /* Sample Use Case:
+     * The dosing controller looks at the last 300 pH samples every tick. Instead of walking the whole window for the
+     * mean, spread and extremes, the buffer keeps them up to date on every push.
+     */
+
+    StatsRingBuffer<float> pHBuffer(300);
+    for (int tick = 0; tick < 1000; ++tick) {
+        float pH = 7.0f + 0.2f * std::sin(tick * 0.05f);
+        if (tick == 900) {
+            pH = 5.5f; // Acid spike from a sensor glitch
+        }
+        pHBuffer.push(pH);
+    }
+
+    std::cout << "Window: " << pHBuffer.getSize() << " of " << pHBuffer.capacity() << " samples" << std::endl;
+    std::cout << "Mean: " << pHBuffer.mean() << ", stddev: " << pHBuffer.stddev() << std::endl;
+    std::cout << "Min: " << pHBuffer.min() << ", max: " << pHBuffer.max() << std::endl;
+
+    // After a long run, re-sum the window from scratch while the controller is idle
+    pHBuffer.resynchronize();
+    std::cout << "Mean after resynchronize: " << pHBuffer.mean() << ", variance: " << pHBuffer.variance() << std::endl;
+
+    for (int tick = 0; tick < 300; ++tick) {
+        pHBuffer.push(7.0f); // The spike ages out of the window
+    }
+    std::cout << "Min once the spike has left the window: " << pHBuffer.min() << ", variance: " << pHBuffer.variance() << std::endl;
+}
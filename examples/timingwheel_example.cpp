@@ -0,0 +1,61 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <string>
+#include "timingwheel.h"
+using namespace CommandaStructures;
+
+void runTimingWheelTest() {
+    /* Sample Use Case:
+     * The control loop runs at 1 kHz, one tick per millisecond. Every sensor has a watchdog that is pushed back each
+     * time a reading arrives; if a sensor goes quiet for 50 ms its watchdog fires. A telemetry packet is retransmitted
+     * with a doubling backoff until it is acknowledged, and the rudder has a deadline to reach its commanded angle.
+     */
+
+    TimingWheel<> timers;
+    const std::string sensors[] = {"pH", "turbidity", "GPS"};
+    SlotHandle watchdogs[3];
+    auto armWatchdog = [&](int sensor) {
+        timers.cancel(watchdogs[sensor]); // Stale or null handles are ignored
+        watchdogs[sensor] = timers.schedule(50, [&, sensor] {
+            std::cout << "  t=" << timers.getNow() << " ms: " << sensors[sensor] << " watchdog fired" << std::endl;
+        });
+    };
+    for (int sensor = 0; sensor < 3; ++sensor) armWatchdog(sensor);
+
+    int attempt = 0;
+    bool acknowledged = false;
+    SlotHandle retransmit;
+    std::function<void()> sendPacket = [&] {
+        std::cout << "  t=" << timers.getNow() << " ms: telemetry packet sent (attempt " << ++attempt << ")" << std::endl;
+        if (!acknowledged) retransmit = timers.schedule(20u << (attempt - 1), sendPacket); // 20, 40, 80 ms ...
+    };
+    sendPacket();
+
+    const SlotHandle rudder = timers.schedule(120, [&] {
+        std::cout << "  t=" << timers.getNow() << " ms: rudder missed its deadline" << std::endl;
+    });
+
+    for (uint64_t ms = 1; ms <= 200; ++ms) {
+        timers.advance(ms);
+        if (ms % 10 == 0) armWatchdog(0);         // pH reports every 10 ms
+        if (ms % 10 == 0 && ms <= 60) armWatchdog(1); // Turbidity goes quiet after 60 ms
+        if (ms % 30 == 0) armWatchdog(2);         // GPS reports every 30 ms
+        if (ms == 70) {
+            acknowledged = true;                  // Ground station acknowledges, stop retransmitting
+            timers.cancel(retransmit);
+            std::cout << "  t=70 ms: telemetry acknowledged" << std::endl;
+        }
+        if (ms == 95) {
+            std::cout << "  t=95 ms: rudder on angle, deadline cancelled: " << (timers.cancel(rudder) ? "yes" : "no") << std::endl;
+        }
+    }
+    std::cout << "Pending timers after 200 ms: " << timers.getSize() << std::endl;
+
+    // A timer far in the future costs the same to schedule and cancel
+    const SlotHandle calibration = timers.schedule(24ull * 60 * 60 * 1000, [] {}); // Daily recalibration
+    std::cout << "Daily calibration pending: " << (timers.isPending(calibration) ? "yes" : "no");
+    timers.cancel(calibration);
+    std::cout << ", after cancel: " << (timers.isPending(calibration) ? "yes" : "no") << std::endl;
+}
@@ -0,0 +1,44 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include "unrolledlist.h"
+using namespace CommandaStructures;
+
+void runUnrolledListTest() {
+    /* Sample Use Case:
+     * A depth log keeps one float per second for the whole dive. Stored in an UnrolledList, 28 readings share one
+     * 128 byte node, so summarizing the log at the end of the dive streams through memory instead of chasing a pointer
+     * per reading.
+     */
+
+    UnrolledList<float> depthLog;
+    for (int second = 0; second < 100; ++second) {
+        depthLog.insert(0.5f * static_cast<float>(second % 40));
+    }
+    std::cout << "Depth log: " << depthLog.getSize() << " readings in " << depthLog.getNodeCount() << " nodes of "
+              << UnrolledList<float>::nodeCapacity << std::endl;
+
+    float deepest = 0.0f;
+    float total = 0.0f;
+    for (float depth : depthLog) {
+        deepest = depth > deepest ? depth : deepest;
+        total += depth;
+    }
+    std::cout << "Deepest " << deepest << " m, average " << total / static_cast<float>(depthLog.getSize()) << " m" << std::endl;
+
+    // A correction at the start of the dive, a bad reading dropped, and a marker in the middle (splits a full node)
+    depthLog.insert(-1.0f, UnrolledList<float>::HEAD);
+    depthLog.remove(19.5f);
+    depthLog.insert(99.0f, 50);
+    std::cout << "After edits: " << depthLog.getSize() << " readings in " << depthLog.getNodeCount() << " nodes, "
+              << "marker found: " << (depthLog.contains(99.0f) ? "yes" : "no") << std::endl;
+
+    depthLog.reverse();
+    std::cout << "Newest first, first 10: ";
+    int shown = 0;
+    for (auto it = depthLog.cbegin(); it != depthLog.cend() && shown < 10; ++it, ++shown) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,123 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "threadpool.h"
+#include "workstealingdeque.h"
+using namespace CommandaStructures;
+
+void runWorkStealingTest() {
+    /* Sample Use Case:
+     * The camera delivers a 1280x720 grayscale frame. Every 64x64 tile is thresholded and its bright pixels counted,
+     * one pool task per tile, and the per-tile counts are compared against a plain single-threaded pass.
+     */
+
+    const int width = 1280;
+    const int height = 720;
+    const int tile = 64;
+    std::vector<uint8_t> frame(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<uint8_t>((i * 2654435761u) >> 24); // Deterministic noise
+    }
+
+    const int tilesX = (width + tile - 1) / tile;
+    const int tilesY = (height + tile - 1) / tile;
+    auto countBright = [&](int tx, int ty) {
+        int count = 0;
+        for (int y = ty * tile; y < std::min(height, (ty + 1) * tile); ++y) {
+            for (int x = tx * tile; x < std::min(width, (tx + 1) * tile); ++x) {
+                count += frame[static_cast<size_t>(y) * width + x] > 200;
+            }
+        }
+        return count;
+    };
+
+    std::vector<int> expected(static_cast<size_t>(tilesX) * tilesY);
+    for (int ty = 0; ty < tilesY; ++ty) {
+        for (int tx = 0; tx < tilesX; ++tx) {
+            expected[static_cast<size_t>(ty) * tilesX + tx] = countBright(tx, ty);
+        }
+    }
+
+    ThreadPool pool(4);
+    std::vector<int> counts(expected.size(), -1);
+    for (int ty = 0; ty < tilesY; ++ty) {
+        for (int tx = 0; tx < tilesX; ++tx) {
+            pool.submit([&, tx, ty] { counts[static_cast<size_t>(ty) * tilesX + tx] = countBright(tx, ty); });
+        }
+    }
+    pool.wait();
+    std::cout << "Tiles processed: " << counts.size() << ", match the serial pass: " << (counts == expected ? "yes" : "NO") << std::endl;
+
+    /* Sample Use Case:
+     * A batch of 100000 IMU samples is integrated by splitting it in halves until the pieces are small. The halves
+     * are submitted from inside the tasks, so they land on the splitting worker's own deque and idle workers steal
+     * the big halves from the front.
+     */
+
+    std::vector<int> samples(100000);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = static_cast<int>(i % 97) - 48;
+    }
+    std::atomic<long> total{0};
+    std::function<void(size_t, size_t)> integrate = [&](size_t begin, size_t end) {
+        if (end - begin > 2048) {
+            const size_t middle = begin + (end - begin) / 2;
+            pool.submit([&, begin, middle] { integrate(begin, middle); });
+            pool.submit([&, middle, end] { integrate(middle, end); });
+            return;
+        }
+        long sum = 0;
+        for (size_t i = begin; i < end; ++i) sum += samples[i];
+        total += sum;
+    };
+    pool.submit([&] { integrate(0, samples.size()); });
+    pool.wait();
+    long serial = 0;
+    for (int sample : samples) serial += sample;
+    std::cout << "Batch sum: " << total.load() << " (serial " << serial << "), tasks stolen so far: " << pool.getSteals() << std::endl;
+
+    pool.submit([] { throw std::runtime_error("sensor batch corrupt"); });
+    try {
+        pool.wait();
+    } catch (const std::runtime_error& e) {
+        std::cout << "Task exception surfaced by wait(): " << e.what() << std::endl;
+    }
+
+    /* The deque on its own: one owner pushes and pops at the back while three thieves steal from the front. Every
+     * item must come out exactly once, whether the owner or a thief got it, and the array grows when thieves fall behind.
+     */
+
+    const int items = 50000;
+    WorkStealingDeque<int> deque(64);
+    std::vector<std::atomic<int>> seen(items);
+    std::atomic<bool> ownerDone{false};
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            int item = 0;
+            while (!ownerDone.load() || !deque.isEmpty()) {
+                if (deque.steal(item)) seen[item]++;
+                else std::this_thread::yield();
+            }
+        });
+    }
+    int item = 0;
+    for (int i = 0; i < items; ++i) {
+        deque.push_back(i);
+        if (i % 3 == 0 && deque.pop_back(item)) seen[item]++;
+    }
+    while (deque.pop_back(item)) seen[item]++;
+    ownerDone = true;
+    for (auto& thief : thieves) thief.join();
+    int exactlyOnce = 0;
+    for (auto& count : seen) exactlyOnce += count.load() == 1;
+    std::cout << "Deque items taken exactly once: " << exactlyOnce << " of " << items << ", final capacity " << deque.capacity() << std::endl;
+}
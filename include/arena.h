@@ -0,0 +1,254 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+/* Notes:
+ * Monotonic (bump pointer) arena for scratch containers. Allocation is a pointer bump, freeing a single object does
+ * nothing, and the whole arena is given back at once with reset() or rolled back to a checkpoint with rollback().
+ *
+ * Functions in the arena class:
+ * allocate - Returns memory for bytes bytes with the given alignment.
+ * checkpoint - Marks the current fill level.
+ * rollback - Drops everything allocated since a checkpoint, in O(1).
+ * canRollback - Checks if a checkpoint is still valid (not ahead of the fill level, not from before a reset).
+ * reset - Drops everything, in O(1). The blocks are kept for reuse.
+ * release - Drops everything and frees the blocks.
+ * bytesUsed - Returns the number of bytes handed out (alignment padding included).
+ * bytesReserved - Returns the number of bytes in all blocks.
+ * highWater - Returns the largest bytesUsed seen so far.
+ *
+ * Containers:
+ * ArenaAllocator plugs an arena into LinkedList / DoubleLinkedList / Queue / Stack / Deque through their allocator
+ * parameter, e.g. Deque<Sample, ArenaAllocator> scratch(arena). Its deallocate() is a no-op and it says so through
+ * releasesInBulk, so for trivially destructible T the containers' clear() and destructor skip the node walk entirely.
+ * ArenaScope takes a checkpoint when it is created and rolls back when it goes out of scope (per-frame scratch).
+ * Every checkpoint carries the arena's reset count, so one taken before a reset() or release() is recognized as stale:
+ * rollback() throws for it, and ArenaScope just skips its rollback (a destructor must not throw).
+ *
+ * Rules:
+ * Memory handed out after a checkpoint is gone after rollback(), so containers using it must be destroyed (or cleared)
+ * first. Declaring them after the ArenaScope does exactly that. The arena is not thread-safe.
+ */
+
+namespace CommandaStructures {
+
+    class Arena {
+    public:
+        // Fill level returned by checkpoint(), only meaningful for the arena that made it
+        struct Checkpoint {
+            size_t block;     // Index of the block that was being filled
+            size_t offset;    // Fill level of that block
+            size_t bytesUsed; // bytesUsed() at that point
+            size_t epoch;     // Number of reset() / release() calls before it, a later reset makes it stale
+        };
+
+        explicit Arena(size_t blockSize = 64 * 1024);
+        ~Arena() { release(); }
+        Arena(const Arena&) = delete;                    // Owns the blocks, cannot be copied
+        Arena& operator=(const Arena&) = delete;
+        void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)); // Bump allocation
+        [[nodiscard]] Checkpoint checkpoint() const { return {current, offset, used, epoch}; } // Marks the current fill level
+        void rollback(const Checkpoint& mark);           // Drops everything allocated since mark
+        [[nodiscard]] bool canRollback(const Checkpoint& mark) const noexcept; // Checks if rollback(mark) would succeed
+        void reset();                                    // Drops everything, keeps the blocks
+        void release();                                  // Drops everything and frees the blocks
+        [[nodiscard]] size_t bytesUsed() const { return used; }          // Bytes handed out so far
+        [[nodiscard]] size_t bytesReserved() const;                      // Bytes in all blocks
+        [[nodiscard]] size_t highWater() const { return peak; }          // Largest bytesUsed() seen
+
+    private:
+        struct Block {
+            std::byte* data;
+            size_t size;
+        };
+
+        std::vector<Block> blocks; // Blocks in fill order, the ones after current are empty and waiting for reuse
+        size_t current;            // Index of the block being filled
+        size_t offset;             // Fill level of the current block
+        size_t blockSize;          // Default size of a new block
+        size_t used;               // Bytes handed out (including padding)
+        size_t peak;               // High-water mark of used
+        size_t epoch;              // Number of reset() / release() calls so far, stamped into every checkpoint
+    };
+
+    /*
+     * Name: Arena constructor
+     * Description: Initializes an empty arena, the first block is allocated on first use.
+     * Parameters: blockSize - Size of each block in bytes (default is 64 KiB), larger requests get a block of their own.
+     * Returns: void - No return value.
+     */
+    inline Arena::Arena(size_t blockSize) : current(0), offset(0), blockSize(blockSize), used(0), peak(0), epoch(0) {
+        if (blockSize == 0) {
+            throw std::invalid_argument("Arena block size must be greater than zero");
+        }
+    }
+
+    /*
+     * Name: Arena.allocate
+     * Description: Bumps the fill pointer of the current block, moving on to the next (or a new) block if it does not fit.
+     * Parameters: bytes - Number of bytes needed.
+     *             alignment - Required alignment, a power of two (default is alignof(std::max_align_t)).
+     * Returns: void* - The memory, valid until reset(), release() or a rollback() past this point.
+     */
+    inline void* Arena::allocate(size_t bytes, size_t alignment) {
+        if (!std::has_single_bit(alignment)) {
+            throw std::invalid_argument("Arena alignment must be a power of two"); // The mask below would silently misalign
+        }
+        while (current < blocks.size()) {
+            const Block& block = blocks[current];
+            const auto base = reinterpret_cast<uintptr_t>(block.data);
+            const size_t aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+            if (aligned + bytes <= block.size) {
+                used += aligned - offset + bytes;
+                peak = std::max(peak, used);
+                offset = aligned + bytes;
+                return block.data + aligned;
+            }
+            if (current + 1 == blocks.size() || blocks[current + 1].size < bytes + alignment) {
+                break; // No block after this one is big enough, add one
+            }
+            used += block.size - offset; // The unused tail of this block counts as used until rollback
+            current++;
+            offset = 0;
+        }
+        // Slot the new block in right after the current one, so blocks before it keep their index (checkpoints stay valid)
+        const size_t size = std::max(blockSize, bytes + alignment);
+        const size_t position = blocks.empty() ? 0 : current + 1;
+        if (blocks.size() == blocks.capacity()) {
+            blocks.reserve(blocks.size() * 2 + 4); // Grow the bookkeeping first so insert below cannot throw and leak the block
+        }
+        Block block{std::allocator<std::byte>().allocate(size), size};
+        if (!blocks.empty()) {
+            used += blocks[current].size - offset;
+        }
+        blocks.insert(blocks.begin() + static_cast<std::ptrdiff_t>(position), block);
+        current = position;
+        offset = 0;
+        return allocate(bytes, alignment);
+    }
+
+    /*
+     * Name: Arena.rollback
+     * Description: Moves the fill level back to a checkpoint. Nothing is freed, the memory is simply reused.
+     * Parameters: mark - A checkpoint taken earlier from this arena (and not rolled back past since).
+     * Returns: void - No return value.
+     */
+    inline void Arena::rollback(const Checkpoint& mark) {
+        if (mark.epoch != epoch) {
+            throw std::logic_error("Arena checkpoint was taken before the last reset");
+        }
+        if (mark.block > current || (mark.block == current && mark.offset > offset)) {
+            throw std::out_of_range("Arena checkpoint is ahead of the current fill level");
+        }
+        current = mark.block;
+        offset = mark.offset;
+        used = mark.bytesUsed;
+    }
+
+    /*
+     * Name: Arena.canRollback
+     * Description: Checks the same conditions as rollback() without throwing, for callers that must not throw (ArenaScope).
+     * Parameters: mark - A checkpoint taken earlier from this arena.
+     * Returns: bool - True if rollback(mark) would succeed.
+     */
+    inline bool Arena::canRollback(const Checkpoint& mark) const noexcept {
+        return mark.epoch == epoch && (mark.block < current || (mark.block == current && mark.offset <= offset));
+    }
+
+    /*
+     * Name: Arena.reset
+     * Description: Drops everything and starts filling the first block again. The blocks are kept, every earlier
+     *              checkpoint becomes stale.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline void Arena::reset() {
+        current = 0;
+        offset = 0;
+        used = 0;
+        epoch++;
+    }
+
+    /*
+     * Name: Arena.release
+     * Description: Drops everything and gives every block back to the heap.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline void Arena::release() {
+        for (const Block& block : blocks) {
+            std::allocator<std::byte>().deallocate(block.data, block.size);
+        }
+        blocks.clear();
+        current = 0;
+        offset = 0;
+        used = 0;
+        epoch++;
+    }
+
+    /*
+     * Name: Arena.bytesReserved
+     * Description: Returns the total size of all blocks the arena holds.
+     * Parameters: None
+     * Returns: size_t - The number of bytes.
+     */
+    inline size_t Arena::bytesReserved() const {
+        size_t total = 0;
+        for (const Block& block : blocks) total += block.size;
+        return total;
+    }
+
+    /* Allocator for the containers' allocator parameter: LinkedList<T, ArenaAllocator> list(arena) */
+    template<typename Node>
+    class ArenaAllocator {
+    public:
+        using value_type = Node;
+        static constexpr bool releasesInBulk = true;  // deallocate() is a no-op, the arena frees everything at once
+
+        ArenaAllocator(Arena& arena) : arena(&arena) {} // Implicit, so a container can be constructed straight from an arena
+        ArenaAllocator() : arena(nullptr) {}            // Unbound, allocate() throws until a bound allocator is assigned
+        Node* allocate(size_t n = 1) {
+            if (!arena) {
+                throw std::logic_error("ArenaAllocator is not bound to an arena");
+            }
+            return static_cast<Node*>(arena->allocate(n * sizeof(Node), alignof(Node)));
+        }
+        void deallocate(Node*, size_t = 1) {}           // Memory comes back with reset() / rollback()
+        [[nodiscard]] Arena* getArena() const { return arena; }
+        bool operator==(const ArenaAllocator& other) const { return arena == other.arena; } // Same arena, nodes can move between lists
+
+    private:
+        Arena* arena;
+    };
+
+    /* Takes a checkpoint on construction and rolls back to it on destruction */
+    class ArenaScope {
+    public:
+        explicit ArenaScope(Arena& arena) : arena(arena), mark(arena.checkpoint()) {}
+        ~ArenaScope() {
+            if (arena.canRollback(mark)) { // Skip if the arena was reset() or released inside the scope
+                arena.rollback(mark);
+            }
+        }
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        Arena& arena;
+        Arena::Checkpoint mark;
+    };
+
+}
+
+#endif //ARENA_H
@@ -0,0 +1,497 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef BLOCKDEQUE_H
+#define BLOCKDEQUE_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+/* Notes:
+ * Deque stored in fixed-size chunks of elements instead of list nodes, a drop-in alternative to Deque<T> (same
+ * push / pop / emplace / front / back / getSize / isEmpty / clear interface). Deque<T> pays one node allocation and two
+ * pointers per element and can only be walked node by node; BlockDeque keeps the elements packed in chunks, so it
+ * adds random access by index and hands out each chunk as a contiguous span (for the SIMD kernels, memcpy, etc.).
+ *
+ * Functions in the block deque class:
+ * push_front / push_back - Adds a new element at the front / back (copies, or moves an rvalue). O(1).
+ * emplace_front / emplace_back - Constructs a new element in place at the front / back. O(1).
+ * pop_front / pop_back - Removes and returns the front / back element (moved out). O(1).
+ * front / back - Returns the first / last element without removing it.
+ * operator[] - Returns the element at an index, unchecked. O(1).
+ * at - Same, but throws std::out_of_range for a bad index.
+ * getSize / isEmpty - Number of elements, empty check.
+ * clear - Removes every element (keeps one chunk for reuse).
+ * chunkCount - Number of chunks holding elements.
+ * chunk - Returns the elements of chunk k as one contiguous span, front to back.
+ * Iterators are random access, begin() is the front. Copying copies every element, moving hands the chunks over in O(1).
+ *
+ * Layout:
+ * ChunkBytes (default 512) is the size each chunk aims for; a chunk holds ChunkBytes / sizeof(T) elements rounded down
+ * to a power of two (at least one), so locating element i is a shift and a mask. The chunk map is a circular array of
+ * chunk pointers, so a chunk can be added at either end in O(1); the map doubles when it is full, which only copies
+ * pointers. Element i lives at position offset + i of the chunks laid end to end, offset being the free slots in front
+ * of the first element in the first chunk. A chunk that empties at either end is released, the most recent one is kept
+ * as a spare so a deque going back and forth over a chunk boundary does not allocate every time.
+ * Push and pop never move elements (the chunk map may move, the chunks do not), so pointers and references to an element
+ * stay valid until it is popped. Iterators hold an index from the front, so a push_front or pop_front shifts them.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, size_t ChunkBytes = 512>
+    class BlockDeque {
+    public:
+        // Elements per chunk
+        static constexpr size_t chunkCapacity = std::bit_floor(std::max<size_t>(1, ChunkBytes / sizeof(T)));
+
+        BlockDeque() = default;
+        BlockDeque(const BlockDeque& other);                   // Deep copy of the elements
+        BlockDeque(BlockDeque&& other) noexcept;               // Takes over the chunks, O(1)
+        BlockDeque& operator=(const BlockDeque& other);
+        BlockDeque& operator=(BlockDeque&& other) noexcept;
+        ~BlockDeque();
+        void push_front(const T& value) { emplace_front(value); }            // Adds a new element to the front
+        void push_front(T&& value) { emplace_front(std::move(value)); }      // Same, but moves the value in
+        void push_back(const T& value) { emplace_back(value); }              // Adds a new element to the back
+        void push_back(T&& value) { emplace_back(std::move(value)); }        // Same, but moves the value in
+        template<typename... Args>
+        T& emplace_front(Args&&... args);                      // Constructs a new element in place at the front
+        template<typename... Args>
+        T& emplace_back(Args&&... args);                       // Constructs a new element in place at the back
+        T pop_front();                                         // Removes and returns the front element
+        T pop_back();                                          // Removes and returns the back element
+        T& front() const;                                      // Returns the first element without removing it
+        T& back() const;                                       // Returns the last element without removing it
+        T& operator[](size_t index) const { return *slot(offset + index); } // Element at index, unchecked
+        T& at(size_t index) const;                             // Element at index, throws std::out_of_range
+        [[nodiscard]] int getSize() const { return static_cast<int>(count); } // Returns the number of elements
+        [[nodiscard]] bool isEmpty() const { return count == 0; }            // Checks if the deque is empty
+        void clear();                                          // Removes all elements
+        [[nodiscard]] size_t chunkCount() const { return chunks; }           // Number of chunks holding elements
+        std::span<T> chunk(size_t k) const;                    // Elements of chunk k, contiguous
+
+        template<typename Value>
+        class BasicIterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<Value>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            BasicIterator() : deque(nullptr), index(0) {}
+            BasicIterator(const BlockDeque* deque, size_t index) : deque(deque), index(index) {}
+            reference operator*() const { return (*deque)[index]; }
+            pointer operator->() const { return &(*deque)[index]; }
+            reference operator[](difference_type n) const { return (*deque)[index + n]; }
+            BasicIterator& operator++() { ++index; return *this; }
+            BasicIterator operator++(int) { BasicIterator old = *this; ++index; return old; }
+            BasicIterator& operator--() { --index; return *this; }
+            BasicIterator operator--(int) { BasicIterator old = *this; --index; return old; }
+            BasicIterator& operator+=(difference_type n) { index += n; return *this; }
+            BasicIterator& operator-=(difference_type n) { index -= n; return *this; }
+            BasicIterator operator+(difference_type n) const { return BasicIterator(deque, index + n); }
+            BasicIterator operator-(difference_type n) const { return BasicIterator(deque, index - n); }
+            friend BasicIterator operator+(difference_type n, const BasicIterator& it) { return it + n; }
+            difference_type operator-(const BasicIterator& other) const { return static_cast<difference_type>(index) - static_cast<difference_type>(other.index); }
+            bool operator==(const BasicIterator& other) const { return index == other.index; }
+            auto operator<=>(const BasicIterator& other) const { return index <=> other.index; }
+
+        private:
+            const BlockDeque* deque;
+            size_t index;
+        };
+        using Iterator = BasicIterator<T>;
+        using ConstIterator = BasicIterator<const T>;
+
+        // Forward iterator support
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, count); }
+        ConstIterator cbegin() const { return ConstIterator(this, 0); }
+        ConstIterator cend() const { return ConstIterator(this, count); }
+
+        // Reverse iterator support
+        auto rbegin() const { return std::reverse_iterator<Iterator>(end()); }
+        auto rend() const { return std::reverse_iterator<Iterator>(begin()); }
+
+    private:
+        static constexpr size_t chunkShift = std::countr_zero(chunkCapacity);
+        static constexpr size_t minimumMapSize = 8;
+
+        T** map = nullptr;              // Circular array of chunk pointers
+        size_t mapSize = 0;             // Length of map, a power of two (or 0 before the first push)
+        size_t mapHead = 0;             // Map index of the first chunk
+        size_t chunks = 0;              // Chunks in use, starting at mapHead
+        size_t offset = 0;              // Free slots in front of the first element, in the first chunk
+        size_t count = 0;               // Number of elements
+        T* spare = nullptr;             // Last released chunk, reused before allocating a new one
+
+        T*& chunkAt(size_t k) const { return map[(mapHead + k) & (mapSize - 1)]; }       // Chunk k, counted from the front
+        T* slot(size_t position) const { return chunkAt(position >> chunkShift) + (position & (chunkCapacity - 1)); } // Slot at a position of the chunks laid end to end
+        T* acquireChunk();              // The spare chunk, or a newly allocated one
+        void releaseChunk(T* chunk);    // Keeps a chunk as the spare, or frees it
+        void growMap();                 // Doubles the chunk map
+        void destroyAll();              // Destroys every element and frees every chunk and the map
+    };
+
+    /*
+     * Name: BlockDeque copy constructor
+     * Description: Copies every element of another deque, front to back, into freshly packed chunks.
+     * Parameters: other - The deque to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    BlockDeque<T, ChunkBytes>::BlockDeque(const BlockDeque& other) : BlockDeque() {
+        for (const T& value : other) {
+            emplace_back(value);
+        }
+    }
+
+    /*
+     * Name: BlockDeque move constructor
+     * Description: Takes over the chunks and the map of another deque, which is left empty.
+     * Parameters: other - The deque to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    BlockDeque<T, ChunkBytes>::BlockDeque(BlockDeque&& other) noexcept
+        : map(std::exchange(other.map, nullptr)), mapSize(std::exchange(other.mapSize, 0)), mapHead(std::exchange(other.mapHead, 0)),
+          chunks(std::exchange(other.chunks, 0)), offset(std::exchange(other.offset, 0)), count(std::exchange(other.count, 0)),
+          spare(std::exchange(other.spare, nullptr)) {}
+
+    /*
+     * Name: BlockDeque copy assignment
+     * Description: Replaces the elements with copies of another deque's elements.
+     * Parameters: other - The deque to copy.
+     * Returns: BlockDeque& - This deque.
+     */
+    template<typename T, size_t ChunkBytes>
+    BlockDeque<T, ChunkBytes>& BlockDeque<T, ChunkBytes>::operator=(const BlockDeque& other) {
+        if (this != &other) {
+            BlockDeque copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: BlockDeque move assignment
+     * Description: Frees this deque's elements and takes over another deque's chunks, which is left empty.
+     * Parameters: other - The deque to move from.
+     * Returns: BlockDeque& - This deque.
+     */
+    template<typename T, size_t ChunkBytes>
+    BlockDeque<T, ChunkBytes>& BlockDeque<T, ChunkBytes>::operator=(BlockDeque&& other) noexcept {
+        if (this != &other) {
+            destroyAll();
+            map = std::exchange(other.map, nullptr);
+            mapSize = std::exchange(other.mapSize, 0);
+            mapHead = std::exchange(other.mapHead, 0);
+            chunks = std::exchange(other.chunks, 0);
+            offset = std::exchange(other.offset, 0);
+            count = std::exchange(other.count, 0);
+            spare = std::exchange(other.spare, nullptr);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: BlockDeque destructor
+     * Description: Destroys every element and frees the chunks and the map.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    BlockDeque<T, ChunkBytes>::~BlockDeque() {
+        destroyAll();
+    }
+
+    /*
+     * Name: BlockDeque.emplace_front
+     * Description: Constructs a new element in place at the front. If the first chunk has no free slot in front, a chunk
+     *              is added in front of it; the element is constructed before the chunk is linked in, so a throwing
+     *              constructor leaves the deque unchanged.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, size_t ChunkBytes>
+    template<typename... Args>
+    T& BlockDeque<T, ChunkBytes>::emplace_front(Args&&... args) {
+        if (offset > 0) {
+            T* element = std::construct_at(slot(offset - 1), std::forward<Args>(args)...);
+            offset--;
+            count++;
+            return *element;
+        }
+        if (chunks == mapSize) {
+            growMap();
+        }
+        T* chunk = acquireChunk();
+        T* element;
+        try {
+            element = std::construct_at(chunk + chunkCapacity - 1, std::forward<Args>(args)...);
+        } catch (...) {
+            releaseChunk(chunk);
+            throw;
+        }
+        mapHead = (mapHead - 1) & (mapSize - 1);
+        map[mapHead] = chunk;
+        chunks++;
+        offset = chunkCapacity - 1;
+        count++;
+        return *element;
+    }
+
+    /*
+     * Name: BlockDeque.emplace_back
+     * Description: Constructs a new element in place at the back, adding a chunk behind the last one if it is full.
+     *              A throwing constructor leaves the deque unchanged.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, size_t ChunkBytes>
+    template<typename... Args>
+    T& BlockDeque<T, ChunkBytes>::emplace_back(Args&&... args) {
+        const size_t position = offset + count;
+        if (position < (chunks << chunkShift)) {
+            T* element = std::construct_at(slot(position), std::forward<Args>(args)...);
+            count++;
+            return *element;
+        }
+        if (chunks == mapSize) {
+            growMap();
+        }
+        T* chunk = acquireChunk();
+        T* element;
+        try {
+            element = std::construct_at(chunk, std::forward<Args>(args)...);
+        } catch (...) {
+            releaseChunk(chunk);
+            throw;
+        }
+        chunkAt(chunks) = chunk;
+        chunks++;
+        count++;
+        return *element;
+    }
+
+    /*
+     * Name: BlockDeque.pop_front
+     * Description: Removes and returns the front element. The first chunk is released once its last element is gone,
+     *              so every chunk in use holds at least one element.
+     * Parameters: None
+     * Returns: T - The removed element (moved out).
+     */
+    template<typename T, size_t ChunkBytes>
+    T BlockDeque<T, ChunkBytes>::pop_front() {
+        if (count == 0) {
+            throw std::out_of_range("BlockDeque is empty");
+        }
+        T* element = slot(offset);
+        T value = std::move(*element);
+        std::destroy_at(element);
+        offset++;
+        count--;
+        if (count == 0) {
+            releaseChunk(map[mapHead]); // Start over at offset 0 rather than keep an empty chunk
+            chunks = 0;
+            offset = 0;
+        } else if (offset == chunkCapacity) {
+            releaseChunk(map[mapHead]);
+            mapHead = (mapHead + 1) & (mapSize - 1);
+            chunks--;
+            offset = 0;
+        }
+        return value;
+    }
+
+    /*
+     * Name: BlockDeque.pop_back
+     * Description: Removes and returns the back element. The last chunk is released once its last element is gone.
+     * Parameters: None
+     * Returns: T - The removed element (moved out).
+     */
+    template<typename T, size_t ChunkBytes>
+    T BlockDeque<T, ChunkBytes>::pop_back() {
+        if (count == 0) {
+            throw std::out_of_range("BlockDeque is empty");
+        }
+        const size_t position = offset + count - 1;
+        T* element = slot(position);
+        T value = std::move(*element);
+        std::destroy_at(element);
+        count--;
+        if (count == 0) {
+            releaseChunk(map[mapHead]);
+            chunks = 0;
+            offset = 0;
+        } else if (position == ((chunks - 1) << chunkShift)) { // Was the first slot of the last chunk
+            releaseChunk(chunkAt(chunks - 1));
+            chunks--;
+        }
+        return value;
+    }
+
+    /*
+     * Name: BlockDeque.front
+     * Description: Returns the first element without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the first element.
+     */
+    template<typename T, size_t ChunkBytes>
+    T& BlockDeque<T, ChunkBytes>::front() const {
+        if (count == 0) {
+            throw std::out_of_range("BlockDeque is empty");
+        }
+        return *slot(offset);
+    }
+
+    /*
+     * Name: BlockDeque.back
+     * Description: Returns the last element without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the last element.
+     */
+    template<typename T, size_t ChunkBytes>
+    T& BlockDeque<T, ChunkBytes>::back() const {
+        if (count == 0) {
+            throw std::out_of_range("BlockDeque is empty");
+        }
+        return *slot(offset + count - 1);
+    }
+
+    /*
+     * Name: BlockDeque.at
+     * Description: Returns the element at an index, counted from the front.
+     * Parameters: index - The index, 0 is the front.
+     * Returns: T& - Reference to the element.
+     */
+    template<typename T, size_t ChunkBytes>
+    T& BlockDeque<T, ChunkBytes>::at(size_t index) const {
+        if (index >= count) {
+            throw std::out_of_range("BlockDeque index out of range");
+        }
+        return *slot(offset + index);
+    }
+
+    /*
+     * Name: BlockDeque.clear
+     * Description: Destroys every element and releases the chunks (one is kept as the spare). The map is kept.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    void BlockDeque<T, ChunkBytes>::clear() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; i++) {
+                std::destroy_at(slot(offset + i));
+            }
+        }
+        for (size_t k = 0; k < chunks; k++) {
+            releaseChunk(chunkAt(k));
+        }
+        mapHead = 0;
+        chunks = 0;
+        offset = 0;
+        count = 0;
+    }
+
+    /*
+     * Name: BlockDeque.chunk
+     * Description: Returns the elements stored in chunk k as a contiguous span. The first and last chunk may be partly
+     *              filled, every chunk in between is full. Walking chunk(0) ... chunk(chunkCount() - 1) visits every
+     *              element front to back.
+     * Parameters: k - The chunk, 0 is the one holding the front element.
+     * Returns: std::span<T> - The elements of the chunk.
+     */
+    template<typename T, size_t ChunkBytes>
+    std::span<T> BlockDeque<T, ChunkBytes>::chunk(size_t k) const {
+        if (k >= chunks) {
+            throw std::out_of_range("BlockDeque chunk index out of range");
+        }
+        const size_t first = k == 0 ? offset : 0;
+        const size_t last = std::min(chunkCapacity, offset + count - (k << chunkShift)); // One past the last element in the chunk
+        return std::span<T>(chunkAt(k) + first, last > first ? last - first : 0);
+    }
+
+    /*
+     * Name: BlockDeque.acquireChunk
+     * Description: Returns raw memory for one chunk, the spare if there is one.
+     * Parameters: None
+     * Returns: T* - Uninitialized storage for chunkCapacity elements.
+     */
+    template<typename T, size_t ChunkBytes>
+    T* BlockDeque<T, ChunkBytes>::acquireChunk() {
+        if (spare) {
+            return std::exchange(spare, nullptr);
+        }
+        return std::allocator<T>().allocate(chunkCapacity);
+    }
+
+    /*
+     * Name: BlockDeque.releaseChunk
+     * Description: Keeps an empty chunk as the spare, or frees it if there already is one.
+     * Parameters: chunk - The chunk, holding no elements.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    void BlockDeque<T, ChunkBytes>::releaseChunk(T* chunk) {
+        if (!spare) {
+            spare = chunk;
+        } else {
+            std::allocator<T>().deallocate(chunk, chunkCapacity);
+        }
+    }
+
+    /*
+     * Name: BlockDeque.growMap
+     * Description: Doubles the chunk map, copying the chunk pointers (not the elements) so the first chunk is at index 0.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    void BlockDeque<T, ChunkBytes>::growMap() {
+        const size_t newSize = std::max(minimumMapSize, mapSize * 2);
+        T** newMap = std::allocator<T*>().allocate(newSize);
+        for (size_t k = 0; k < chunks; k++) {
+            newMap[k] = chunkAt(k);
+        }
+        if (map) {
+            std::allocator<T*>().deallocate(map, mapSize);
+        }
+        map = newMap;
+        mapSize = newSize;
+        mapHead = 0;
+    }
+
+    /*
+     * Name: BlockDeque.destroyAll
+     * Description: Destroys every element, frees every chunk (the spare too) and the map.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t ChunkBytes>
+    void BlockDeque<T, ChunkBytes>::destroyAll() {
+        clear();
+        if (spare) {
+            std::allocator<T>().deallocate(spare, chunkCapacity);
+            spare = nullptr;
+        }
+        if (map) {
+            std::allocator<T*>().deallocate(map, mapSize);
+            map = nullptr;
+            mapSize = 0;
+        }
+    }
+
+}
+
+#endif //BLOCKDEQUE_H
@@ -0,0 +1,717 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "doublelinkedlist.h"
+/* Notes:
+ * Bounded key/value cache for things that are expensive to load and reused for a while (map tiles by tile ID, sensor
+ * calibrations by sensor key). get, put and erase are O(1); when the cache is full, put evicts one entry first:
+ * Cache<Key, Value> (or LruCache) evicts the least recently used entry, Cache<Key, Value,
+ * EvictionPolicy::LeastFrequentlyUsed> (or LfuCache) the least frequently used one, the least recently used of those
+ * on a tie.
+ *
+ * Functions in the cache class:
+ * get - Returns a pointer to the value and marks it used (hit), or nullptr (miss). Counts hits and misses.
+ * peek - Same, but does not mark the entry used or count anything.
+ * contains - Checks if a key is cached, without marking it used.
+ * put - Inserts or replaces the value for a key and marks it used, evicting an entry first if the cache is full.
+ * erase - Removes a key, returns false if it was not cached. Not an eviction: the eviction callback is not called.
+ * clear - Removes every entry (no callbacks).
+ * setEvictionCallback - Function called with (key, value) for every entry evicted to make room, before it is destroyed.
+ * getHits / getMisses / getEvictions / resetStats - Counters.
+ * getSize / isEmpty / capacity - Number of entries, empty check, maximum number of entries.
+ *
+ * How it works:
+ * The entries live in a DoubleLinkedList (nodes come from its NodePool, so an eviction followed by an insert reuses
+ * the node instead of allocating). An open-addressing hash index (linear probing, backward-shift deletion, sized for
+ * twice the capacity so it never grows) maps a key to its node. Marking an entry used relinks its node with
+ * DoubleLinkedList::moveBefore / moveToFront, it is never copied or reallocated, so the index stays valid.
+ * LRU: the list is in recency order, most recent at the head; a hit moves the node to the head, the tail is evicted.
+ * LFU: every entry counts its uses. The list is ordered by count, highest at the head, and within one count the most
+ *      recently used entry is last. A second index maps each count to the first node with that count. A hit moves the
+ *      node from its count's group to the end of the next group, which is always just before the first node of its
+ *      old group, so this is O(1) as well. The victim is the first node of the tail's group.
+ * A Cache is not thread safe and get() writes (it relinks the node), so even readers need exclusive access.
+ * ShardedCache splits the capacity over several Caches, each behind its own mutex, and picks one by the key's hash,
+ * so threads looking up different keys rarely wait on each other. Eviction is per shard, so it is only approximately
+ * LRU/LFU over the whole cache.
+ */
+
+namespace CommandaStructures {
+
+    enum class EvictionPolicy {
+        LeastRecentlyUsed,  // Evict the entry that was used longest ago
+        LeastFrequentlyUsed // Evict the entry used the fewest times (least recently used on a tie)
+    };
+
+    namespace Detail {
+
+        /*
+         * Name: mixHash
+         * Description: Scrambles a hash (splitmix64 finalizer). std::hash of an integer is often the integer itself, and
+         *              linear probing on the low bits of sequential tile IDs would cluster badly.
+         * Parameters: hash - The hash to mix.
+         * Returns: size_t - The mixed hash.
+         */
+        inline size_t mixHash(size_t hash) {
+            uint64_t x = hash;
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ULL;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebULL;
+            x ^= x >> 31;
+            return static_cast<size_t>(x);
+        }
+
+        // Fixed-size open-addressing index from a key to a list node; the key is read from the node through KeyOf
+        template<typename Node, typename Key, typename KeyOf, typename Hash>
+        class NodeIndex {
+        public:
+            explicit NodeIndex(size_t maxEntries);
+            NodeIndex(const NodeIndex&) = delete;        // Holds pointers to one list's nodes
+            NodeIndex& operator=(const NodeIndex&) = delete;
+            NodeIndex(NodeIndex&& other) noexcept;       // Takes the table, other is left empty and allocates again on insert
+            NodeIndex& operator=(NodeIndex&& other) noexcept;
+            Node* find(const Key& key) const;            // The node stored for key, or nullptr
+            void insert(Node* node);                     // Adds a node, its key must not be in the index yet
+            void update(const Key& key, Node* node);     // Stores another node (with the same key) for a key that is in the index
+            bool erase(const Key& key);                  // Removes a key, false if it was not in the index
+            void clear();                                // Removes every key
+
+        private:
+            struct Slot {
+                size_t hash;                             // Mixed hash of the node's key
+                Node* node;                              // nullptr while the slot is empty
+            };
+
+            std::vector<Slot> slots;                     // Power of two, at least twice maxEntries, so probes stay short (empty after a move)
+            size_t mask;
+            size_t tableSize;                            // Size slots is (re)allocated with
+            [[no_unique_address]] Hash hasher;
+            [[no_unique_address]] KeyOf keyOf;
+
+            size_t position(const Key& key, size_t hash) const; // Slot holding key, or the empty slot that ends its probe
+        };
+
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy = EvictionPolicy::LeastRecentlyUsed, typename Hash = std::hash<Key>>
+    class Cache {
+    public:
+        using EvictionCallback = std::function<void(const Key&, Value&)>;
+
+        explicit Cache(size_t capacity);                 // Holds at most capacity entries, throws std::invalid_argument for 0
+        Cache(const Cache&) = delete;                    // The index points into the list's nodes
+        Cache& operator=(const Cache&) = delete;
+        Cache(Cache&& other) noexcept;                   // Takes the entries and the index, other is left empty with the same capacity
+        Cache& operator=(Cache&& other) noexcept;
+        Value* get(const Key& key);                      // The value (marked used, counted as a hit) or nullptr (a miss)
+        const Value* peek(const Key& key) const;         // The value or nullptr, not marked used or counted
+        [[nodiscard]] bool contains(const Key& key) const { return peek(key) != nullptr; } // Checks if a key is cached
+        Value& put(const Key& key, Value value);         // Inserts or replaces a value, evicts first if full
+        bool erase(const Key& key);                      // Removes a key, false if it was not cached
+        void clear();                                    // Removes every entry
+        void setEvictionCallback(EvictionCallback callback) { onEvict = std::move(callback); } // Called for each evicted entry
+        [[nodiscard]] size_t getHits() const { return hits; }           // Number of get() calls that found their key
+        [[nodiscard]] size_t getMisses() const { return misses; }       // Number of get() calls that did not
+        [[nodiscard]] size_t getEvictions() const { return evictions; } // Number of entries evicted to make room
+        void resetStats() { hits = misses = evictions = 0; }            // Sets the counters back to 0
+        [[nodiscard]] size_t getSize() const { return entries.getSize(); } // Returns the number of entries
+        [[nodiscard]] bool isEmpty() const { return entries.getSize() == 0; } // Checks if the cache is empty
+        [[nodiscard]] size_t capacity() const { return maxEntries; }    // Maximum number of entries
+
+    private:
+        struct Entry {
+            Key key;
+            Value value;
+            uint32_t frequency;                          // Number of uses (LFU only)
+        };
+        using Node = DoubleNode<Entry>;
+        struct KeyOfEntry {
+            const Key& operator()(const Node* node) const { return node->getData().key; }
+        };
+        struct FrequencyOfEntry {
+            uint32_t operator()(const Node* node) const { return node->getData().frequency; }
+        };
+        static constexpr bool lfu = Policy == EvictionPolicy::LeastFrequentlyUsed;
+
+        DoubleLinkedList<Entry> entries;                 // Eviction order, the victim is at (LFU: near) the tail
+        Detail::NodeIndex<Node, Key, KeyOfEntry, Hash> index;                                  // Key -> node
+        Detail::NodeIndex<Node, uint32_t, FrequencyOfEntry, std::hash<uint32_t>> groups;       // LFU: use count -> first node with it
+        size_t maxEntries;
+        EvictionCallback onEvict;
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+
+        void touch(Node* node);                          // Marks an entry used
+        Node* leaveGroup(Node* node);                    // LFU: takes a node out of its count's group, returns the group's first node
+        void unlink(Node* node);                         // Removes an entry from the index (and its group) and frees its node
+        void evict();                                    // Evicts one entry
+    };
+
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    using LruCache = Cache<Key, Value, EvictionPolicy::LeastRecentlyUsed, Hash>;
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    using LfuCache = Cache<Key, Value, EvictionPolicy::LeastFrequentlyUsed, Hash>;
+
+    template<typename Key, typename Value, EvictionPolicy Policy = EvictionPolicy::LeastRecentlyUsed, typename Hash = std::hash<Key>>
+    class ShardedCache {
+    public:
+        using EvictionCallback = typename Cache<Key, Value, Policy, Hash>::EvictionCallback;
+
+        explicit ShardedCache(size_t capacity, size_t shardCount = 16); // Splits capacity over shardCount locked caches
+        bool get(const Key& key, Value& out);            // Copies the value to out (marked used), false on a miss
+        [[nodiscard]] bool contains(const Key& key) const; // Checks if a key is cached, without marking it used
+        void put(const Key& key, Value value);           // Inserts or replaces a value, evicts from its shard first if full
+        bool erase(const Key& key);                      // Removes a key, false if it was not cached
+        void clear();                                    // Removes every entry
+        void setEvictionCallback(const EvictionCallback& callback); // Called for each evicted entry, under its shard's lock
+        [[nodiscard]] size_t getHits() const;            // Sums over the shards; a snapshot while other threads run
+        [[nodiscard]] size_t getMisses() const;
+        [[nodiscard]] size_t getEvictions() const;
+        [[nodiscard]] size_t getSize() const;
+        [[nodiscard]] size_t capacity() const;           // Per-shard capacity times the number of shards
+        [[nodiscard]] size_t getShardCount() const { return shards.size(); }
+
+    private:
+        struct alignas(64) Shard {                       // Own cache line, so one shard's lock does not slow its neighbour
+            mutable std::mutex mutex;
+            Cache<Key, Value, Policy, Hash> cache;
+            explicit Shard(size_t capacity) : cache(capacity) {}
+        };
+
+        std::vector<std::unique_ptr<Shard>> shards;
+        [[no_unique_address]] Hash hasher;
+
+        Shard& shardFor(const Key& key) const;           // The shard a key belongs to
+        template<typename Func>
+        size_t sum(Func func) const;                     // Adds func(cache) over all shards, one lock at a time
+    };
+
+    /*
+     * Name: NodeIndex constructor
+     * Description: Allocates an empty table with at least twice as many slots as entries it will ever hold, rounded up to
+     *              a power of two, so the table never needs to grow and linear probes stay short.
+     * Parameters: maxEntries - The most entries the index will hold at once.
+     * Returns: void - No return value.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    Detail::NodeIndex<Node, Key, KeyOf, Hash>::NodeIndex(size_t maxEntries)
+        : slots(std::bit_ceil(std::max<size_t>(8, maxEntries * 2)), Slot{0, nullptr}), mask(slots.size() - 1), tableSize(slots.size()) {}
+
+    /*
+     * Name: NodeIndex move constructor
+     * Description: Takes over another index's table. The moved-from index has no table: find and erase see it as empty
+     *              and the next insert allocates a new table of the same size.
+     * Parameters: other - The index to take over.
+     * Returns: void - No return value.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    Detail::NodeIndex<Node, Key, KeyOf, Hash>::NodeIndex(NodeIndex&& other) noexcept
+        : slots(std::move(other.slots)), mask(std::exchange(other.mask, 0)), tableSize(other.tableSize),
+          hasher(std::move(other.hasher)), keyOf(std::move(other.keyOf)) {
+        other.slots.clear();
+    }
+
+    /*
+     * Name: NodeIndex move assignment
+     * Description: Drops this index's table and takes over other's, leaving other without a table (see the move constructor).
+     * Parameters: other - The index to take over.
+     * Returns: NodeIndex& - This index.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    Detail::NodeIndex<Node, Key, KeyOf, Hash>& Detail::NodeIndex<Node, Key, KeyOf, Hash>::operator=(NodeIndex&& other) noexcept {
+        if (this != &other) {
+            slots = std::move(other.slots);
+            other.slots.clear();
+            mask = std::exchange(other.mask, 0);
+            tableSize = other.tableSize;
+            hasher = std::move(other.hasher);
+            keyOf = std::move(other.keyOf);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: NodeIndex.position
+     * Description: Walks the probe sequence of a key, starting at its home slot (hash & mask).
+     * Parameters: key - The key to look for.
+     *             hash - The key's mixed hash.
+     * Returns: size_t - The slot holding the key, or the empty slot where the probe ended.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    size_t Detail::NodeIndex<Node, Key, KeyOf, Hash>::position(const Key& key, size_t hash) const {
+        size_t i = hash & mask;
+        while (slots[i].node && (slots[i].hash != hash || !(keyOf(slots[i].node) == key))) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    /*
+     * Name: NodeIndex.find
+     * Description: Looks up the node stored for a key.
+     * Parameters: key - The key to look for.
+     * Returns: Node* - The node, or nullptr if the key is not in the index.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    Node* Detail::NodeIndex<Node, Key, KeyOf, Hash>::find(const Key& key) const {
+        if (slots.empty()) {
+            return nullptr; // Moved from, nothing stored
+        }
+        return slots[position(key, mixHash(hasher(key)))].node;
+    }
+
+    /*
+     * Name: NodeIndex.insert
+     * Description: Stores a node under its key, in the empty slot that ends the key's probe sequence. An index that was
+     *              moved from allocates its table again first.
+     * Parameters: node - The node, its key must not be in the index yet.
+     * Returns: void - No return value.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    void Detail::NodeIndex<Node, Key, KeyOf, Hash>::insert(Node* node) {
+        if (slots.empty()) {
+            slots.assign(tableSize, Slot{0, nullptr});
+            mask = tableSize - 1;
+        }
+        const size_t hash = mixHash(hasher(keyOf(node)));
+        slots[position(keyOf(node), hash)] = Slot{hash, node};
+    }
+
+    /*
+     * Name: NodeIndex.update
+     * Description: Replaces the node stored for a key with another node that has the same key.
+     * Parameters: key - The key, must be in the index.
+     *             node - The new node.
+     * Returns: void - No return value.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    void Detail::NodeIndex<Node, Key, KeyOf, Hash>::update(const Key& key, Node* node) {
+        slots[position(key, mixHash(hasher(key)))].node = node;
+    }
+
+    /*
+     * Name: NodeIndex.erase
+     * Description: Removes a key with backward-shift deletion: the entries after the hole in the same run are moved back
+     *              into it when their home slot allows it, so no tombstones are left and later probes stay short.
+     * Parameters: key - The key to remove.
+     * Returns: bool - True if the key was removed, false if it was not in the index.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    bool Detail::NodeIndex<Node, Key, KeyOf, Hash>::erase(const Key& key) {
+        if (slots.empty()) {
+            return false;
+        }
+        size_t hole = position(key, mixHash(hasher(key)));
+        if (!slots[hole].node) {
+            return false;
+        }
+        for (size_t i = (hole + 1) & mask; slots[i].node; i = (i + 1) & mask) {
+            const size_t home = slots[i].hash & mask;
+            if (((i - home) & mask) >= ((i - hole) & mask)) { // The hole lies on this entry's probe path
+                slots[hole] = slots[i];
+                hole = i;
+            }
+        }
+        slots[hole].node = nullptr;
+        return true;
+    }
+
+    /*
+     * Name: NodeIndex.clear
+     * Description: Empties every slot, the table keeps its size.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Node, typename Key, typename KeyOf, typename Hash>
+    void Detail::NodeIndex<Node, Key, KeyOf, Hash>::clear() {
+        for (Slot& slot : slots) {
+            slot.node = nullptr;
+        }
+    }
+
+    /*
+     * Name: Cache constructor
+     * Description: Creates an empty cache. The hash index (and for LFU the count index) is allocated here at its final
+     *              size; list nodes are allocated as the cache fills and recycled after that.
+     * Parameters: capacity - The most entries the cache holds, at least 1.
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    Cache<Key, Value, Policy, Hash>::Cache(size_t capacity)
+        : index(capacity), groups(lfu ? capacity : 0), maxEntries(capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Cache capacity must be at least 1");
+        }
+    }
+
+    /*
+     * Name: Cache move constructor
+     * Description: Takes over another cache's entries, index, callback and counters in O(1). The nodes move with the
+     *              list, so the index stays valid. The moved-from cache is empty, keeps its capacity and can be used again.
+     * Parameters: other - The cache to take over.
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    Cache<Key, Value, Policy, Hash>::Cache(Cache&& other) noexcept
+        : entries(std::move(other.entries)), index(std::move(other.index)), groups(std::move(other.groups)),
+          maxEntries(other.maxEntries), onEvict(std::move(other.onEvict)), hits(std::exchange(other.hits, 0)),
+          misses(std::exchange(other.misses, 0)), evictions(std::exchange(other.evictions, 0)) {}
+
+    /*
+     * Name: Cache move assignment
+     * Description: Drops this cache's entries (no callbacks) and takes over other's, see the move constructor.
+     * Parameters: other - The cache to take over.
+     * Returns: Cache& - This cache.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    Cache<Key, Value, Policy, Hash>& Cache<Key, Value, Policy, Hash>::operator=(Cache&& other) noexcept {
+        if (this != &other) {
+            entries = std::move(other.entries);
+            index = std::move(other.index);
+            groups = std::move(other.groups);
+            maxEntries = other.maxEntries;
+            onEvict = std::move(other.onEvict);
+            hits = std::exchange(other.hits, 0);
+            misses = std::exchange(other.misses, 0);
+            evictions = std::exchange(other.evictions, 0);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: Cache.get
+     * Description: Looks up a key. On a hit the entry is marked used (LRU: moved to the front, LFU: its count goes up).
+     * Parameters: key - The key to look up.
+     * Returns: Value* - The cached value, or nullptr on a miss. Valid until the entry is evicted or erased.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    Value* Cache<Key, Value, Policy, Hash>::get(const Key& key) {
+        Node* node = index.find(key);
+        if (!node) {
+            misses++;
+            return nullptr;
+        }
+        hits++;
+        touch(node);
+        return &node->getData().value;
+    }
+
+    /*
+     * Name: Cache.peek
+     * Description: Looks up a key without marking the entry used or counting a hit or miss.
+     * Parameters: key - The key to look up.
+     * Returns: const Value* - The cached value, or nullptr.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    const Value* Cache<Key, Value, Policy, Hash>::peek(const Key& key) const {
+        const Node* node = index.find(key);
+        return node ? &node->getData().value : nullptr;
+    }
+
+    /*
+     * Name: Cache.put
+     * Description: Replaces the value of a cached key, or inserts a new entry, evicting one entry first if the cache is
+     *              full. Either way the entry is marked used. If the eviction callback throws, nothing is evicted or
+     *              inserted.
+     * Parameters: key - The key.
+     *             value - The value, moved into the cache.
+     * Returns: Value& - The cached value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    Value& Cache<Key, Value, Policy, Hash>::put(const Key& key, Value value) {
+        if (Node* node = index.find(key)) {
+            node->getData().value = std::move(value);
+            touch(node);
+            return node->getData().value;
+        }
+        if (entries.getSize() >= maxEntries) {
+            evict();
+        }
+        Node* node;
+        if constexpr (lfu) {
+            entries.emplace_back(Entry{key, std::move(value), 1}); // Count 1 is the lowest group, newest is last
+            node = entries.getTail();
+            if (!groups.find(1)) {
+                groups.insert(node);
+            }
+        } else {
+            entries.emplace_front(Entry{key, std::move(value), 1});
+            node = entries.getHead();
+        }
+        index.insert(node);
+        return node->getData().value;
+    }
+
+    /*
+     * Name: Cache.erase
+     * Description: Removes a key. This is not an eviction, so the eviction callback is not called.
+     * Parameters: key - The key to remove.
+     * Returns: bool - True if the key was removed, false if it was not cached.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    bool Cache<Key, Value, Policy, Hash>::erase(const Key& key) {
+        Node* node = index.find(key);
+        if (!node) {
+            return false;
+        }
+        unlink(node);
+        return true;
+    }
+
+    /*
+     * Name: Cache.clear
+     * Description: Removes every entry without calling the eviction callback. The counters are kept.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void Cache<Key, Value, Policy, Hash>::clear() {
+        index.clear();
+        groups.clear();
+        entries.clear();
+    }
+
+    /*
+     * Name: Cache.touch
+     * Description: Marks an entry used. LRU: relinks it at the head. LFU: moves it from its count's group to the end of
+     *              the next group, which is just before the first node left in its old group (or where it already is,
+     *              if it was alone in that group), and bumps its count.
+     * Parameters: node - The entry's node.
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void Cache<Key, Value, Policy, Hash>::touch(Node* node) {
+        if constexpr (lfu) {
+            Entry& entry = node->getData();
+            if (entry.frequency == UINT32_MAX) {
+                return; // Saturated, stays in the top group
+            }
+            if (Node* oldGroup = leaveGroup(node)) {
+                entries.moveBefore(node, oldGroup);
+            }
+            entry.frequency++;
+            if (!groups.find(entry.frequency)) {
+                groups.insert(node);
+            }
+        } else {
+            entries.moveToFront(node);
+        }
+    }
+
+    /*
+     * Name: Cache.leaveGroup
+     * Description: LFU only. Takes a node out of its count's group in the count index: if it was the group's first node,
+     *              the next node takes over, or the group is removed if that node has another count.
+     * Parameters: node - The node, still linked in the list.
+     * Returns: Node* - The first node of the group after the node left, or nullptr if the group is now empty.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    typename Cache<Key, Value, Policy, Hash>::Node* Cache<Key, Value, Policy, Hash>::leaveGroup(Node* node) {
+        const uint32_t frequency = node->getData().frequency;
+        Node* first = groups.find(frequency);
+        if (first != node) {
+            return first;
+        }
+        Node* next = node->next;
+        if (next && next->getData().frequency == frequency) {
+            groups.update(frequency, next);
+            return next;
+        }
+        groups.erase(frequency);
+        return nullptr;
+    }
+
+    /*
+     * Name: Cache.unlink
+     * Description: Removes an entry from the hash index (and for LFU from its group), then frees its node.
+     * Parameters: node - The entry's node.
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void Cache<Key, Value, Policy, Hash>::unlink(Node* node) {
+        if constexpr (lfu) {
+            leaveGroup(node);
+        }
+        index.erase(node->getData().key);
+        entries.removeNode(node);
+    }
+
+    /*
+     * Name: Cache.evict
+     * Description: Evicts one entry: the tail for LRU, the first node of the tail's group (fewest uses, least recently
+     *              used among those) for LFU. The callback sees the entry before it is removed.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void Cache<Key, Value, Policy, Hash>::evict() {
+        Node* victim = entries.getTail();
+        if constexpr (lfu) {
+            victim = groups.find(victim->getData().frequency);
+        }
+        if (onEvict) {
+            onEvict(victim->getData().key, victim->getData().value);
+        }
+        unlink(victim);
+        evictions++;
+    }
+
+    /*
+     * Name: ShardedCache constructor
+     * Description: Creates shardCount caches of capacity / shardCount entries each (rounded up). There are never more
+     *              shards than entries.
+     * Parameters: capacity - The total number of entries, at least 1.
+     *             shardCount - The number of independently locked caches (default is 16).
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    ShardedCache<Key, Value, Policy, Hash>::ShardedCache(size_t capacity, size_t shardCount) {
+        if (capacity == 0 || shardCount == 0) {
+            throw std::invalid_argument("ShardedCache capacity and shard count must be at least 1");
+        }
+        shardCount = std::min(shardCount, capacity);
+        const size_t perShard = (capacity + shardCount - 1) / shardCount;
+        shards.reserve(shardCount);
+        for (size_t i = 0; i < shardCount; i++) {
+            shards.push_back(std::make_unique<Shard>(perShard));
+        }
+    }
+
+    /*
+     * Name: ShardedCache.get
+     * Description: Looks up a key in its shard and copies the value out while the shard is locked, so the caller never
+     *              holds a pointer into an entry another thread could evict.
+     * Parameters: key - The key to look up.
+     *             out - Receives a copy of the value on a hit.
+     * Returns: bool - True on a hit, false on a miss.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    bool ShardedCache<Key, Value, Policy, Hash>::get(const Key& key, Value& out) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (const Value* value = shard.cache.get(key)) {
+            out = *value;
+            return true;
+        }
+        return false;
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    bool ShardedCache<Key, Value, Policy, Hash>::contains(const Key& key) const {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.contains(key);
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void ShardedCache<Key, Value, Policy, Hash>::put(const Key& key, Value value) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, std::move(value));
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    bool ShardedCache<Key, Value, Policy, Hash>::erase(const Key& key) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.erase(key);
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void ShardedCache<Key, Value, Policy, Hash>::clear() {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.clear();
+        }
+    }
+
+    /*
+     * Name: ShardedCache.setEvictionCallback
+     * Description: Installs the same eviction callback in every shard. It runs with the evicting shard locked, so it
+     *              must not call back into this cache for a key of the same shard.
+     * Parameters: callback - The function called with (key, value) for each evicted entry.
+     * Returns: void - No return value.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    void ShardedCache<Key, Value, Policy, Hash>::setEvictionCallback(const EvictionCallback& callback) {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.setEvictionCallback(callback);
+        }
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    size_t ShardedCache<Key, Value, Policy, Hash>::getHits() const {
+        return sum([](const auto& cache) { return cache.getHits(); });
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    size_t ShardedCache<Key, Value, Policy, Hash>::getMisses() const {
+        return sum([](const auto& cache) { return cache.getMisses(); });
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    size_t ShardedCache<Key, Value, Policy, Hash>::getEvictions() const {
+        return sum([](const auto& cache) { return cache.getEvictions(); });
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    size_t ShardedCache<Key, Value, Policy, Hash>::getSize() const {
+        return sum([](const auto& cache) { return cache.getSize(); });
+    }
+
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    size_t ShardedCache<Key, Value, Policy, Hash>::capacity() const {
+        return shards.size() * shards.front()->cache.capacity();
+    }
+
+    /*
+     * Name: ShardedCache.shardFor
+     * Description: Picks a key's shard from its mixed hash with the high half folded onto the low half, so the choice
+     *              does not just repeat the low bits the shard's own index probes with. The shift is half the width of
+     *              size_t, which keeps it meaningful on 32-bit targets.
+     * Parameters: key - The key.
+     * Returns: Shard& - The key's shard.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    typename ShardedCache<Key, Value, Policy, Hash>::Shard& ShardedCache<Key, Value, Policy, Hash>::shardFor(const Key& key) const {
+        const size_t hash = Detail::mixHash(hasher(key));
+        return *shards[(hash ^ (hash >> (sizeof(size_t) * 4))) % shards.size()];
+    }
+
+    /*
+     * Name: ShardedCache.sum
+     * Description: Adds up a counter over all shards, locking one shard at a time.
+     * Parameters: func - Returns the counter of one cache.
+     * Returns: size_t - The sum.
+     */
+    template<typename Key, typename Value, EvictionPolicy Policy, typename Hash>
+    template<typename Func>
+    size_t ShardedCache<Key, Value, Policy, Hash>::sum(Func func) const {
+        size_t total = 0;
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            total += func(shard->cache);
+        }
+        return total;
+    }
+
+}
+
+#endif //CACHE_H
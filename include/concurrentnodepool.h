@@ -0,0 +1,227 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef CONCURRENTNODEPOOL_H
+#define CONCURRENTNODEPOOL_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+/* Notes:
+ * Thread-safe version of NodePool for the lock-free node containers. Any number of threads may allocate and
+ * deallocate at the same time, and a node may be freed by a different thread than the one that allocated it.
+ * Like NodePool, nodes are carved out of slabs and recycled through a free list, so once the pool has grown to the
+ * container's high-water mark, allocate / deallocate never call malloc or free again.
+ *
+ * Functions in the concurrent node pool class:
+ * allocate - Returns raw memory for one node (std::allocator style, n must be 1). Lock-free unless a slab is added.
+ * deallocate - Puts a node's memory back on the free list. Lock-free.
+ * reserve - Carves slabs up front so the first nodes do not allocate either.
+ * reserved - Returns the number of nodes the current slabs can hold.
+ * slabCount - Returns the number of slabs allocated so far.
+ *
+ * How it works:
+ * The free list is a Treiber stack of slot indices. Its head packs a 32-bit slot index and a 32-bit tag into one 64-bit
+ * atomic, and every successful CAS bumps the tag, so a pop that read a stale next link (ABA) fails its CAS instead of
+ * corrupting the list. Slots are addressed by index because slab k holds nodesPerSlab << k slots (the slab table
+ * has a fixed size and never moves), and slab memory is never freed before the pool is, so reading the next link of a
+ * slot that another thread just popped is harmless. Adding a slab takes a mutex, which only happens while the pool grows.
+ */
+
+namespace CommandaStructures {
+
+    template<typename Node>
+    class ConcurrentNodePool {
+    public:
+        using value_type = Node;
+
+        explicit ConcurrentNodePool(size_t nodesPerSlab = 256);
+        ~ConcurrentNodePool();
+        ConcurrentNodePool(const ConcurrentNodePool&) = delete; // Shared between threads and owns the slabs
+        ConcurrentNodePool& operator=(const ConcurrentNodePool&) = delete;
+        Node* allocate(size_t n = 1);                    // Raw memory for one node, the caller constructs it
+        void deallocate(Node* node, size_t n = 1);       // Returns a node (already destroyed) to the free list
+        void reserve(size_t nodes);                      // Makes sure nodes can be handed out without allocating
+        [[nodiscard]] size_t reserved() const { return capacityOf(slabs.load(std::memory_order_acquire)); } // Nodes the slabs can hold
+        [[nodiscard]] size_t slabCount() const { return slabs.load(std::memory_order_acquire); }           // Number of slabs allocated so far
+
+    private:
+        static constexpr uint32_t none = UINT32_MAX;     // Empty free list / end of the chain
+        static constexpr size_t maxSlabs = 24;           // Slab k holds nodesPerSlab << k slots
+
+        struct Slot {
+            alignas(Node) unsigned char storage[sizeof(Node)]; // First, so a Node* and its Slot* are the same address
+            std::atomic<uint32_t> nextFree;              // Free-list link, only meaningful while the slot is free
+            uint32_t index;                              // This slot's index, set once when the slab is carved
+        };
+
+        std::atomic<uint64_t> freeHead;                  // Low 32 bits: index of the first free slot, high 32 bits: ABA tag
+        std::atomic<Slot*> slabTable[maxSlabs];          // Slab k, or nullptr
+        std::atomic<size_t> slabs;                       // Number of slabs in slabTable
+        size_t slabShift;                                // log2(nodesPerSlab)
+        std::mutex growMutex;                            // Serializes addSlab()
+
+        [[nodiscard]] size_t capacityOf(size_t slabCount) const { return ((size_t{1} << slabCount) - 1) << slabShift; }
+        Slot* slotAt(uint32_t index) const;              // Finds the slot with the given index
+        void pushChain(Slot* first, Slot* last);         // Pushes a linked chain of free slots in one CAS
+        void addSlab(bool onlyIfEmpty);                  // Carves the next slab and frees all of its slots
+
+        static uint64_t pack(uint32_t index, uint32_t tag) { return (static_cast<uint64_t>(tag) << 32) | index; }
+        static uint32_t indexOf(uint64_t head) { return static_cast<uint32_t>(head); }
+        static uint32_t tagOf(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+    };
+
+    /*
+     * Name: ConcurrentNodePool constructor
+     * Description: Initializes an empty pool. No memory is allocated until the first node is needed (or reserve() is called).
+     * Parameters: nodesPerSlab - Size of the first slab, rounded up to a power of two (default is 256). Every slab is twice the previous one.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    ConcurrentNodePool<Node>::ConcurrentNodePool(size_t nodesPerSlab) : freeHead(pack(none, 0)), slabs(0), slabShift(0) {
+        if (nodesPerSlab == 0) {
+            throw std::invalid_argument("ConcurrentNodePool slab size must be greater than zero");
+        }
+        slabShift = std::countr_zero(std::bit_ceil(nodesPerSlab));
+        for (auto& slab : slabTable) {
+            slab.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /*
+     * Name: ConcurrentNodePool destructor
+     * Description: Frees every slab. No thread may be using the pool anymore and every node must already be destroyed.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    ConcurrentNodePool<Node>::~ConcurrentNodePool() {
+        const size_t count = slabs.load(std::memory_order_acquire);
+        for (size_t k = 0; k < count; k++) {
+            const size_t size = size_t{1} << (slabShift + k);
+            Slot* slab = slabTable[k].load(std::memory_order_relaxed);
+            std::destroy(slab, slab + size);
+            std::allocator<Slot>().deallocate(slab, size);
+        }
+    }
+
+    /*
+     * Name: ConcurrentNodePool.allocate
+     * Description: Pops a slot off the free list, adding a slab first if the list is empty.
+     * Parameters: n - Number of nodes, must be 1 (the parameter exists for the std::allocator interface).
+     * Returns: Node* - Raw, uninitialized memory for one node.
+     */
+    template<typename Node>
+    Node* ConcurrentNodePool<Node>::allocate(size_t n) {
+        if (n != 1) {
+            throw std::invalid_argument("ConcurrentNodePool only hands out one node at a time");
+        }
+        uint64_t head = freeHead.load(std::memory_order_acquire);
+        while (true) {
+            if (indexOf(head) == none) {
+                addSlab(true);
+                head = freeHead.load(std::memory_order_acquire);
+                continue;
+            }
+            Slot* slot = slotAt(indexOf(head));
+            const uint32_t next = slot->nextFree.load(std::memory_order_relaxed); // May be stale, the tag catches that
+            if (freeHead.compare_exchange_weak(head, pack(next, tagOf(head) + 1), std::memory_order_acquire, std::memory_order_acquire)) {
+                return reinterpret_cast<Node*>(slot->storage);
+            }
+        }
+    }
+
+    /*
+     * Name: ConcurrentNodePool.deallocate
+     * Description: Pushes a node's slot back on the free list, from any thread.
+     * Parameters: node - The node, already destroyed.
+     *             n - Number of nodes, must be 1.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void ConcurrentNodePool<Node>::deallocate(Node* node, size_t) {
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        pushChain(slot, slot);
+    }
+
+    /*
+     * Name: ConcurrentNodePool.reserve
+     * Description: Adds slabs until the pool can hold at least nodes nodes.
+     * Parameters: nodes - The number of nodes that should be available without growing.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void ConcurrentNodePool<Node>::reserve(size_t nodes) {
+        while (reserved() < nodes) {
+            addSlab(false);
+        }
+    }
+
+    /*
+     * Name: ConcurrentNodePool.slotAt
+     * Description: Maps a slot index to its slot. Slab k starts at index capacityOf(k).
+     * Parameters: index - A slot index handed out by this pool.
+     * Returns: Slot* - The slot.
+     */
+    template<typename Node>
+    typename ConcurrentNodePool<Node>::Slot* ConcurrentNodePool<Node>::slotAt(uint32_t index) const {
+        const size_t scaled = (static_cast<size_t>(index) >> slabShift) + 1;
+        const size_t k = std::bit_width(scaled) - 1;
+        return slabTable[k].load(std::memory_order_acquire) + (index - capacityOf(k));
+    }
+
+    /*
+     * Name: ConcurrentNodePool.pushChain
+     * Description: Pushes the free slots first ... last (already linked through nextFree) onto the free list in one CAS.
+     * Parameters: first - The first slot of the chain, becomes the new head.
+     *             last - The last slot of the chain, linked to the old head.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void ConcurrentNodePool<Node>::pushChain(Slot* first, Slot* last) {
+        uint64_t head = freeHead.load(std::memory_order_relaxed);
+        do {
+            last->nextFree.store(indexOf(head), std::memory_order_relaxed);
+        } while (!freeHead.compare_exchange_weak(head, pack(first->index, tagOf(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /*
+     * Name: ConcurrentNodePool.addSlab
+     * Description: Allocates the next slab (twice the size of the previous one) and pushes all of its slots on the
+     *              free list.
+     * Parameters: onlyIfEmpty - Skip it if the free list is no longer empty once the mutex is held (allocate() sets
+     *                           this, so threads that all found the list empty add one slab, not one each).
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void ConcurrentNodePool<Node>::addSlab(bool onlyIfEmpty) {
+        std::lock_guard<std::mutex> lock(growMutex);
+        const size_t k = slabs.load(std::memory_order_relaxed);
+        if (onlyIfEmpty && indexOf(freeHead.load(std::memory_order_acquire)) != none) {
+            return; // Someone else grew the pool (or nodes came back) in the meantime
+        }
+        if (k == maxSlabs || capacityOf(k + 1) >= none) {
+            throw std::length_error("ConcurrentNodePool cannot grow any further");
+        }
+        const size_t size = size_t{1} << (slabShift + k);
+        Slot* slab = std::allocator<Slot>().allocate(size);
+        const auto base = static_cast<uint32_t>(capacityOf(k));
+        for (size_t i = 0; i < size; i++) {
+            Slot* slot = std::construct_at(slab + i);
+            slot->index = base + static_cast<uint32_t>(i);
+            slot->nextFree.store(i + 1 < size ? slot->index + 1 : none, std::memory_order_relaxed);
+        }
+        slabTable[k].store(slab, std::memory_order_release);
+        slabs.store(k + 1, std::memory_order_release);
+        pushChain(slab, slab + size - 1);
+    }
+
+}
+
+#endif //CONCURRENTNODEPOOL_H
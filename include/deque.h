@@ -5,35 +5,56 @@
 #ifndef DEQUE_H
 #define DEQUE_H
 
+#include <utility>
 #include "doublelinkedlist.h"
 /* Notes:
  * Functions in the deque class:
  * push_front - Adds a new element to the front of the deque.
  * push_back - Adds a new element to the back of the deque.
- * pop_front - Removes and returns the front element of the deque.
- * pop_back - Removes and returns the back element of the deque.
+ * emplace_front / emplace_back - Constructs a new element in place at the front / back.
+ * pop_front - Removes and returns the front element of the deque (moved out of the node, not copied).
+ * pop_back - Removes and returns the back element of the deque (moved out of the node, not copied).
  * back - Returns the last element of the deque without removing it.
  * front - Returns the first element of the deque without removing it.
  * getSize - Returns the number of elements in the deque.
  * isEmpty - Checks if the deque is empty.
+ * clear - Removes all elements (O(1) for trivially destructible T on an ArenaAllocator).
+ * getAllocator - Returns the node allocator (a NodePool by default) of the underlying list.
+ *
+ * BlockDeque (blockdeque.h) has the same interface but stores the elements in fixed-size chunks instead of list nodes,
+ * which adds random access by index and contiguous spans per chunk. Use it instead of Deque for indexed or contiguous
+ * access; Deque stays list-backed because its allocator parameter (node pool, arena) only makes sense for nodes.
  */
 
 
 namespace CommandaStructures {
 
-    template<typename T>
+    template<typename T, template<typename> class Allocator = NodePool>
     class Deque {
     public:
         Deque();
+        explicit Deque(Allocator<DoubleNode<T>> nodeAllocator) : list(std::move(nodeAllocator)) {} // Nodes come from the given allocator (e.g. an arena)
+        Deque(const Deque&) = default;                         // Deep copy of the elements
+        Deque(Deque&&) = default;                              // Takes over the nodes, O(1)
+        Deque& operator=(const Deque&) = default;
+        Deque& operator=(Deque&&) = default;
         ~Deque();
         void push_front(const T& value);                       // Adds a new element to the front of the deque
+        void push_front(T&& value);                            // Same, but moves the value in
         void push_back(const T& value);                        // Adds a new element to the back of the deque
+        void push_back(T&& value);                             // Same, but moves the value in
+        template<typename... Args>
+        T& emplace_front(Args&&... args);                      // Constructs a new element in place at the front
+        template<typename... Args>
+        T& emplace_back(Args&&... args);                       // Constructs a new element in place at the back
         T pop_front();                                         // Removes and returns the front element of the deque
         T pop_back();                                          // Removes and returns the back element of the deque
         T& front() const;                                      // Returns the first element without removing it
         T& back() const;                                       // Returns the last element without removing it
         [[nodiscard]] int getSize() const {return list.getSize();};             // Returns the number of elements in the deque
         [[nodiscard]] bool isEmpty() const;                                  // Checks if the deque is empty
+        void clear() { list.clear(); }                              // Removes all elements
+        auto& getAllocator() { return list.getAllocator(); }         // Node allocator of the underlying list (reserve(), highWater())
         // Forward iterator support
         auto begin()       { return list.begin(); }
         auto end()         { return list.end(); }
@@ -45,7 +66,7 @@ namespace CommandaStructures {
         auto rend()        { return list.rend(); }
 
     private:                                                   
-        DoubleLinkedList<T> list;                              // Double linked list to store the elements of the deque
+        DoubleLinkedList<T, Allocator> list;                              // Double linked list to store the elements of the deque
     };
 
 
@@ -55,8 +76,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    Deque<T>::Deque() : list() {
+    template<typename T, template<typename> class Allocator>
+    Deque<T, Allocator>::Deque() : list() {
         // The size is implicitly managed by the DoubleLinkedList class
     }
 
@@ -66,8 +87,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    Deque<T>::~Deque() = default; // Use the default destructor (no need for custom cleanup since DoubleLinkedList handles its own memory)
+    template<typename T, template<typename> class Allocator>
+    Deque<T, Allocator>::~Deque() = default; // Use the default destructor (no need for custom cleanup since DoubleLinkedList handles its own memory)
 
 
     /*
@@ -76,9 +97,9 @@ namespace CommandaStructures {
      * Parameters: value - The value to be added to the front of the deque.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void Deque<T>::push_front(const T& value) {
-        list.insert(value, DoubleLinkedList<T>::HEAD); // Insert at the head of the double linked list
+    template<typename T, template<typename> class Allocator>
+    void Deque<T, Allocator>::push_front(const T& value) {
+        list.insert(value, DoubleLinkedList<T, Allocator>::HEAD); // Insert at the head of the double linked list
     }
 
     /*
@@ -87,9 +108,55 @@ namespace CommandaStructures {
      * Parameters: value - The value to be added to the back of the deque.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void Deque<T>::push_back(const T& value) {
-        list.insert(value, DoubleLinkedList<T>::TAIL); // Insert at the tail of the double linked list
+    template<typename T, template<typename> class Allocator>
+    void Deque<T, Allocator>::push_back(const T& value) {
+        list.insert(value, DoubleLinkedList<T, Allocator>::TAIL); // Insert at the tail of the double linked list
+    }
+
+    /*
+     * Name: Deque.push_front (move)
+     * Description: Adds a new element to the front of the deque, moving the value in instead of copying it.
+     * Parameters: value - The value to be moved into the deque.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void Deque<T, Allocator>::push_front(T&& value) {
+        list.insert(std::move(value), DoubleLinkedList<T, Allocator>::HEAD);
+    }
+
+    /*
+     * Name: Deque.push_back (move)
+     * Description: Adds a new element to the back of the deque, moving the value in instead of copying it.
+     * Parameters: value - The value to be moved into the deque.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void Deque<T, Allocator>::push_back(T&& value) {
+        list.insert(std::move(value), DoubleLinkedList<T, Allocator>::TAIL);
+    }
+
+    /*
+     * Name: Deque.emplace_front
+     * Description: Constructs a new element in place at the front of the deque.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& Deque<T, Allocator>::emplace_front(Args&&... args) {
+        return list.emplace_front(std::forward<Args>(args)...);
+    }
+
+    /*
+     * Name: Deque.emplace_back
+     * Description: Constructs a new element in place at the back of the deque.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& Deque<T, Allocator>::emplace_back(Args&&... args) {
+        return list.emplace_back(std::forward<Args>(args)...);
     }
 
     /*
@@ -98,13 +165,13 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T - The value of the removed front element.
      */
-    template<typename T>
-    T Deque<T>::pop_front() {
+    template<typename T, template<typename> class Allocator>
+    T Deque<T, Allocator>::pop_front() {
         if (isEmpty()) {
             throw std::out_of_range("Deque is empty");
         }
-        T value = list.getHead()->getData(); // Get the data from the head node
-        list.remove(value); // Remove the head node
+        T value = std::move(list.getHead()->getData()); // Move the data out of the head node, it is destroyed next
+        list.removeNode(list.getHead()); // Remove the head node
         return value; // Return the removed value
     }
 
@@ -114,13 +181,13 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T - The value of the removed back element.
      */
-    template<typename T>
-    T Deque<T>::pop_back() {
+    template<typename T, template<typename> class Allocator>
+    T Deque<T, Allocator>::pop_back() {
         if (isEmpty()) {
             throw std::out_of_range("Deque is empty");
         }
-        T value = list.getTail()->getData(); // Get the data from the tail node
-        list.remove(value); // Remove the tail node
+        T value = std::move(list.getTail()->getData()); // Move the data out of the tail node, it is destroyed next
+        list.removeNode(list.getTail()); // Remove the tail node (remove(value) would search from the head)
         return value; // Return the removed value
     }
 
@@ -130,8 +197,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T& - Reference to the first element.
      */
-    template<typename T>
-    T& Deque<T>::front() const {
+    template<typename T, template<typename> class Allocator>
+    T& Deque<T, Allocator>::front() const {
         if (isEmpty()) {
             throw std::out_of_range("Deque is empty");
         }
@@ -144,8 +211,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T& - Reference to the last element.
      */
-    template<typename T>
-    T& Deque<T>::back() const {
+    template<typename T, template<typename> class Allocator>
+    T& Deque<T, Allocator>::back() const {
         if (isEmpty()) {
             throw std::out_of_range("Deque is empty");
         }
@@ -158,8 +225,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: bool - True if the deque is empty, false otherwise.
      */
-    template<typename T>
-    bool Deque<T>::isEmpty() const {
+    template<typename T, template<typename> class Allocator>
+    bool Deque<T, Allocator>::isEmpty() const {
         return list.getSize() == 0; // Return true if size is zero, false otherwise
     }
 
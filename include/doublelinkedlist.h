@@ -5,19 +5,37 @@
 #ifndef DOUBLELINKEDLIST_H
 #define DOUBLELINKEDLIST_H
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "nodepool.h" // Default node allocator
 #include "nodes.h" // Include the Node class definition
 using namespace CommandaStructures::Double;
 
 namespace CommandaStructures {
 
-    /* Double Linked List Class */
-    template<typename T>
+    /* Double Linked List Class
+     * Nodes come from Allocator<DoubleNode<T>>, a NodePool by default (see nodepool.h), so steady-state insert/remove
+     * recycles nodes instead of calling new/delete. DoubleLinkedList<T, std::allocator> allocates every node on the heap.
+     */
+    template<typename T, template<typename> class Allocator = NodePool>
     class DoubleLinkedList {
     public:
 
         DoubleLinkedList();
+        explicit DoubleLinkedList(Allocator<DoubleNode<T>> nodeAllocator); // Uses the given allocator, e.g. an ArenaAllocator bound to an arena
+        DoubleLinkedList(const DoubleLinkedList& other); // Deep copy, the copy gets its own allocator (same arena for ArenaAllocator)
+        DoubleLinkedList(DoubleLinkedList&& other) noexcept(std::is_nothrow_move_constructible_v<Allocator<DoubleNode<T>>>); // Takes over the nodes, O(1)
+        DoubleLinkedList& operator=(const DoubleLinkedList& other); // Replaces the contents with a deep copy of other
+        DoubleLinkedList& operator=(DoubleLinkedList&& other) noexcept(std::is_nothrow_move_assignable_v<Allocator<DoubleNode<T>>>); // Frees this list's nodes, takes over other's
         ~DoubleLinkedList();
         void insert(const T& value, int spot = TAIL); // Append a new DoubleNode with the given value to the end of the list (spot is optional)
+        void insert(T&& value, int spot = TAIL);      // Same, but moves the value into the node
+        template<typename... Args>
+        T& emplace_front(Args&&... args);             // Constructs a new value in place at the head of the list
+        template<typename... Args>
+        T& emplace_back(Args&&... args);              // Constructs a new value in place at the end of the list
         void remove(const T& value);                  // Remove the first DoubleNode with the given value from the list
         template<typename Func>                       // Function to display the contents of the linked list using a custom function
         void display(Func func) const;                // Display the contents using a custom function
@@ -31,6 +49,12 @@ namespace CommandaStructures {
         void reverse(); // Reverse the double linked list in place
         void insertAfter(DoubleNode<T>* node, const T& value); // Insert a new node with the given value after the specified node
         void insertBefore(DoubleNode<T>* node, const T& value); // Insert a new node with the given value before the specified node
+        void moveBefore(DoubleNode<T>* node, DoubleNode<T>* position); // Relinks a node of this list before position (nullptr = to the tail), no allocation
+        void moveToFront(DoubleNode<T>* node) { moveBefore(node, head); } // Relinks a node of this list to the head, no allocation
+        void splice(DoubleLinkedList& other, DoubleNode<T>* node); // Moves a node of other to this list's tail, no allocation
+        void splice(DoubleLinkedList& other);         // Moves all of other's nodes to this list's tail, O(1)
+        Allocator<DoubleNode<T>>& getAllocator() { return allocator; } // Node allocator, e.g. for reserve() / highWater()
+        const Allocator<DoubleNode<T>>& getAllocator() const { return allocator; }
         enum Spot {
             HEAD = 0, // Enum to define positions for appending nodes
             TAIL = -1 // TAIL is used to append at the end of the list (default behavior)
@@ -98,8 +122,15 @@ namespace CommandaStructures {
         size_t size;   // Size of the double linked list
         DoubleNode<T>* head; // Pointer to the first node in the list
         DoubleNode<T>* tail; // Pointer to the last node in the list
+        Allocator<DoubleNode<T>> allocator; // Where the nodes come from
         // Enum to define positions for appending nodes
 
+        template<typename... Args>
+        DoubleNode<T>* createNode(Args&&... args);   // Allocates a node and constructs its value from args
+        void linkNode(DoubleNode<T>* newNode, int spot); // Links a new node in at spot (the position logic of insert)
+        static Allocator<DoubleNode<T>> copyAllocator(const Allocator<DoubleNode<T>>& source); // Allocator for a copy of the list
+        void destroyNode(DoubleNode<T>* node);       // Destroys a node and gives its memory back to the allocator
+
         static void setNext(DoubleNode<T>* node, DoubleNode<T>* nextNode) {
             if (node) {
                 node->next = nextNode; // Set the next pointer of the current node
@@ -118,8 +149,81 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    DoubleLinkedList<T>::DoubleLinkedList() : size(0), head(nullptr), tail(nullptr) {}
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>::DoubleLinkedList() : size(0), head(nullptr), tail(nullptr) {}
+
+    /*
+     * Name: DoubleLinkedList constructor (allocator)
+     * Description: Initializes an empty list that gets its nodes from the given allocator.
+     * Parameters: nodeAllocator - The allocator to use, e.g. ArenaAllocator (constructible straight from an Arena).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>::DoubleLinkedList(Allocator<DoubleNode<T>> nodeAllocator)
+        : size(0), head(nullptr), tail(nullptr), allocator(std::move(nodeAllocator)) {}
+
+    /*
+     * Name: DoubleLinkedList copy constructor
+     * Description: Initializes a list holding copies of other's values, in the same order.
+     *              A copyable allocator (ArenaAllocator, std::allocator) is copied, a NodePool is not shared: the copy gets its own.
+     * Parameters: other - The list to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>::DoubleLinkedList(const DoubleLinkedList& other)
+        : size(0), head(nullptr), tail(nullptr), allocator(copyAllocator(other.allocator)) {
+        try {
+            for (const DoubleNode<T>* current = other.head; current; current = current->next) {
+                linkNode(createNode(current->data), TAIL);
+            }
+        } catch (...) {
+            clear(); // The destructor does not run for a half-built object
+            throw;
+        }
+    }
+
+    /*
+     * Name: DoubleLinkedList move constructor
+     * Description: Takes over other's nodes and allocator without touching a single node. other is left empty.
+     * Parameters: other - The list to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>::DoubleLinkedList(DoubleLinkedList&& other) noexcept(std::is_nothrow_move_constructible_v<Allocator<DoubleNode<T>>>)
+        : size(std::exchange(other.size, 0)), head(std::exchange(other.head, nullptr)), tail(std::exchange(other.tail, nullptr)),
+          allocator(std::move(other.allocator)) {}
+
+    /*
+     * Name: DoubleLinkedList copy assignment
+     * Description: Replaces the contents with copies of other's values (copy, then move into place).
+     * Parameters: other - The list to copy.
+     * Returns: DoubleLinkedList& - This list.
+     */
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>& DoubleLinkedList<T, Allocator>::operator=(const DoubleLinkedList& other) {
+        if (this != &other) {
+            *this = DoubleLinkedList(other); // If copying throws, this list is untouched
+        }
+        return *this;
+    }
+
+    /*
+     * Name: DoubleLinkedList move assignment
+     * Description: Destroys this list's nodes, then takes over other's nodes and allocator. other is left empty.
+     * Parameters: other - The list to move from.
+     * Returns: DoubleLinkedList& - This list.
+     */
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>& DoubleLinkedList<T, Allocator>::operator=(DoubleLinkedList&& other) noexcept(std::is_nothrow_move_assignable_v<Allocator<DoubleNode<T>>>) {
+        if (this != &other) {
+            clear(); // Our nodes go back to our allocator before it is replaced
+            allocator = std::move(other.allocator);
+            head = std::exchange(other.head, nullptr);
+            tail = std::exchange(other.tail, nullptr);
+            size = std::exchange(other.size, 0);
+        }
+        return *this;
+    }
 
     /*
  * Name: DoubleLinkedList destructor
@@ -127,17 +231,9 @@ namespace CommandaStructures {
  * Parameters: None
  * Returns: void - No return value.
  */
-    template<typename T>
-    DoubleLinkedList<T>::~DoubleLinkedList() {
-        DoubleNode<T>* current = head;
-        while (current) {
-            DoubleNode<T>* nextNode = current->next; // Store the next node
-            delete current; // Delete the current node
-            current = nextNode; // Move to the next node
-        }
-        size = 0; // Reset size to zero
-        head = nullptr; // Set head to nullptr after deletion
-        tail = nullptr; // Set tail to nullptr after deletion
+    template<typename T, template<typename> class Allocator>
+    DoubleLinkedList<T, Allocator>::~DoubleLinkedList() {
+        clear(); // Destroys every node (or, for an allocator that releases in bulk, just forgets them)
     }
 
     /*
@@ -147,9 +243,60 @@ namespace CommandaStructures {
      *             spot - The position where the new node should be inserted (default is TAIL, which appends to the end).
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::insert(const T &value, int spot) {
-        DoubleNode<T>* newNode = new DoubleNode<T>(value);
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::insert(const T &value, int spot) {
+        linkNode(createNode(value), spot);
+    }
+
+    /*
+     * Name: DoubleLinkedList.insert (move)
+     * Description: Same as insert, but the value is moved into the new node instead of copied.
+     * Parameters: value - The value to be moved into the list.
+     *             spot - The position where the new node should be inserted (default is TAIL, which appends to the end).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::insert(T&& value, int spot) {
+        linkNode(createNode(std::move(value)), spot);
+    }
+
+    /*
+     * Name: DoubleLinkedList.emplace_front
+     * Description: Constructs a new value in place in a node at the head of the list, no temporary T is made.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new value.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& DoubleLinkedList<T, Allocator>::emplace_front(Args&&... args) {
+        DoubleNode<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNode(newNode, HEAD);
+        return newNode->data;
+    }
+
+    /*
+     * Name: DoubleLinkedList.emplace_back
+     * Description: Constructs a new value in place in a node at the end of the list, no temporary T is made.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new value.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& DoubleLinkedList<T, Allocator>::emplace_back(Args&&... args) {
+        DoubleNode<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNode(newNode, TAIL);
+        return newNode->data;
+    }
+
+    /*
+     * Name: DoubleLinkedList.linkNode
+     * Description: Links a freshly created node into the list at the given position.
+     * Parameters: newNode - The node to link in (next and prev are nullptr).
+     *             spot - The position where the node should be inserted (HEAD, TAIL or an index).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::linkNode(DoubleNode<T>* newNode, int spot) {
         // If the spot is 0, insert at the head
         if (spot == HEAD) {
             setNext(newNode, head); // Set the next pointer of the new node to the current head
@@ -200,8 +347,8 @@ namespace CommandaStructures {
      * Parameters: value - The value of the node to be removed.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::remove(const T &value) {
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::remove(const T &value) {
         if (!head) return; // If the list is empty, do nothing
         DoubleNode<T>* current = getHead();
         // Traverse the list to find the node with the given value
@@ -217,7 +364,7 @@ namespace CommandaStructures {
                 } else { // If it is the tail node
                     tail = current->prev; // Update tail to the previous node
                 }
-                delete current; // Delete the current node
+                destroyNode(current); // Delete the current node
                 size--; // Decrement the size of the double linked list
                 return; // Exit after removing the first occurrence
             }
@@ -231,9 +378,9 @@ namespace CommandaStructures {
      * Parameters: func - A function that takes a const reference to T and returns void.
      * Returns: void - No return value.
      */
-    template<typename T>
+    template<typename T, template<typename> class Allocator>
     template<typename Func>
-    void DoubleLinkedList<T>::display(Func func) const {
+    void DoubleLinkedList<T, Allocator>::display(Func func) const {
         DoubleNode<T>* current = getHead(); // Start from the head of the list
         while (current) { // Traverse through each node
             func(current->getData()); // Call the provided function with the data of the current node
@@ -247,8 +394,8 @@ namespace CommandaStructures {
      * Parameters: node - Pointer to the node to be removed.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::removeNode(DoubleNode<T>* node) {
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::removeNode(DoubleNode<T>* node) {
         if (!node) return;
         if (node->prev) node->prev->next = node->next; // If the node is not the head, set the next pointer of the previous node
         else head = node->next; // If it is the head, update head to the next node
@@ -256,21 +403,30 @@ namespace CommandaStructures {
         if (node->next) node->next->prev = node->prev; // If the node is not the tail, set the previous pointer of the next node
         else tail = node->prev; // If it is the tail, update tail to the previous node
 
-        delete node;
+        destroyNode(node);
         size--;
     }
 
     /* Name: DoubleLinkedList.clear
      * Description: Clears the double linked list by deleting all nodes.
+     *              With an allocator that releases in bulk (ArenaAllocator) and a trivially destructible T, the nodes are
+     *              just forgotten in O(1), the arena takes the memory back on reset() / rollback().
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::clear() {
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::clear() {
+        if constexpr (allocatorReleasesInBulk<Allocator<DoubleNode<T>>> && std::is_trivially_destructible_v<T>) {
+            // Nothing to destroy and nothing to give back: the allocator's owner frees all nodes at once
+            head = nullptr;
+            tail = nullptr;
+            size = 0;
+            return;
+        }
         DoubleNode<T>* current = head; // Start from the head of the list
         while (current) {
             DoubleNode<T>* nextNode = current->next; // Store the next node
-            delete current; // Delete the current node
+            destroyNode(current); // Delete the current node
             current = nextNode; // Move to the next node
         }
         head = nullptr; // Set head to nullptr after deletion
@@ -284,8 +440,8 @@ namespace CommandaStructures {
      * Parameters: value - The value to search for in the list.
      * Returns: DoubleNode<T>* - A pointer to the node containing the value, or nullptr if not found.
      */
-    template<typename T>
-    DoubleNode<T>* DoubleLinkedList<T>::findNode(const T &value) const {
+    template<typename T, template<typename> class Allocator>
+    DoubleNode<T>* DoubleLinkedList<T, Allocator>::findNode(const T &value) const {
         DoubleNode<T>* current = getHead(); // Start from the head of the list
         // Traverse the list to find the node with the given value
         while (current) {
@@ -303,8 +459,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::reverse() {
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::reverse() {
         DoubleNode<T>* current = head; // Start from the head of the list
         DoubleNode<T>* temp = nullptr; // Temporary pointer to hold the next node
         tail = head; // Set tail to the current head
@@ -319,6 +475,54 @@ namespace CommandaStructures {
         }
     }
 
+    /*
+     * Name: DoubleLinkedList.createNode
+     * Description: Gets memory for a node from the allocator and constructs the node's value in it from args
+     *              (a const T& copies, a T&& moves, anything else goes to T's constructor).
+     * Parameters: args - The value, or the arguments for T's constructor.
+     * Returns: DoubleNode<T>* - The new node (next and prev are nullptr).
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    DoubleNode<T>* DoubleLinkedList<T, Allocator>::createNode(Args&&... args) {
+        DoubleNode<T>* node = allocator.allocate(1);
+        try {
+            std::construct_at(node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            allocator.deallocate(node, 1); // Constructing the value threw, do not lose the memory
+            throw;
+        }
+        return node;
+    }
+
+    /*
+     * Name: DoubleLinkedList.copyAllocator
+     * Description: Picks the allocator for a copy of the list: a copy of source if the allocator can be copied
+     *              (ArenaAllocator keeps using the same arena), else a fresh one (every list owns its own NodePool).
+     * Parameters: source - The allocator of the list being copied.
+     * Returns: Allocator<DoubleNode<T>> - The allocator for the copy.
+     */
+    template<typename T, template<typename> class Allocator>
+    Allocator<DoubleNode<T>> DoubleLinkedList<T, Allocator>::copyAllocator(const Allocator<DoubleNode<T>>& source) {
+        if constexpr (std::is_copy_constructible_v<Allocator<DoubleNode<T>>>) {
+            return source;
+        } else {
+            return Allocator<DoubleNode<T>>();
+        }
+    }
+
+    /*
+     * Name: DoubleLinkedList.destroyNode
+     * Description: Destroys a node and returns its memory to the allocator.
+     * Parameters: node - The node to destroy (already unlinked).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::destroyNode(DoubleNode<T>* node) {
+        std::destroy_at(node);
+        allocator.deallocate(node, 1);
+    }
+
     /*
      * Name: DoubleLinkedList.insertAfter
      * Description: Inserts a new node with the given value after the specified node.
@@ -326,10 +530,10 @@ namespace CommandaStructures {
      *             value - The value to be inserted into the list.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::insertAfter(DoubleNode<T>* node, const T &value) {
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::insertAfter(DoubleNode<T>* node, const T &value) {
         if (!node) return; // If the node is null, do nothing
-        DoubleNode<T>* newNode = new DoubleNode<T>(value); // Create a new node with the given value
+        DoubleNode<T>* newNode = createNode(value); // Create a new node with the given value
         setNext(newNode, node->next); // Set the next pointer of the new node to the next node of the specified node
         setPrev(newNode, node); // Set the previous pointer of the new node to the specified node
         if (node->next) { // If there is a next node, update its previous pointer
@@ -348,10 +552,10 @@ namespace CommandaStructures {
      *             value - The value to be inserted into the list.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void DoubleLinkedList<T>::insertBefore(DoubleNode<T>* node, const T &value) {
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::insertBefore(DoubleNode<T>* node, const T &value) {
         if (!node) return; // If the node is null, do nothing
-        DoubleNode<T>* newNode = new DoubleNode<T>(value); // Create a new node with the given value
+        DoubleNode<T>* newNode = createNode(value); // Create a new node with the given value
         setPrev(newNode, node->prev); // Set the previous pointer of the new node to the previous node of the specified node
         setNext(newNode, node); // Set the next pointer of the new node to the specified node
         if (node->prev) { // If there is a previous node, update its next pointer
@@ -363,6 +567,113 @@ namespace CommandaStructures {
         size++; // Increment the size of the double linked list
     }
 
+    /*
+     * Name: DoubleLinkedList.moveBefore
+     * Description: Unlinks a node of this list and links it back in before position, in O(1). The node is not freed or
+     *              copied, so pointers to it (and to its value) stay valid; this is the splice an LRU list uses to move
+     *              an entry to the front on every hit.
+     * Parameters: node - The node to move, must belong to this list.
+     *             position - The node to move it before (must belong to this list), or nullptr to move it to the tail.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::moveBefore(DoubleNode<T>* node, DoubleNode<T>* position) {
+        if (!node || node == position || node->next == position) return; // Already in place
+        // Unlink
+        if (node->prev) {
+            setNext(node->prev, node->next);
+        } else {
+            head = node->next;
+        }
+        if (node->next) {
+            setPrev(node->next, node->prev);
+        } else {
+            tail = node->prev;
+        }
+        // Link back in before position
+        DoubleNode<T>* before = position ? position->prev : tail;
+        setPrev(node, before);
+        setNext(node, position);
+        if (before) {
+            setNext(before, node);
+        } else {
+            head = node;
+        }
+        if (position) {
+            setPrev(position, node);
+        } else {
+            tail = node;
+        }
+    }
+
+    /*
+     * Name: DoubleLinkedList.splice
+     * Description: Unlinks a node from another list and links it in at this list's tail, in O(1). The node keeps its
+     *              address and value. Both lists must get their nodes from the same memory: allocators that compare
+     *              equal (NodePoolRef to one pool, ArenaAllocator to one arena, std::allocator). Lists with their own
+     *              NodePool (the default) cannot splice, that does not compile.
+     * Parameters: other - The list the node is in now.
+     *             node - The node to move.
+     * Returns: void - No return value. Throws std::invalid_argument if the allocators compare unequal.
+     */
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::splice(DoubleLinkedList& other, DoubleNode<T>* node) {
+        if (!node) return;
+        static_assert(requires { allocator == other.allocator; },
+                      "splice needs allocators that compare equal (e.g. NodePoolRef), every NodePool owns its own nodes");
+        if (!(allocator == other.allocator)) {
+            throw std::invalid_argument("DoubleLinkedList splice between lists with different allocators");
+        }
+        if (node->prev) {
+            setNext(node->prev, node->next);
+        } else {
+            other.head = node->next;
+        }
+        if (node->next) {
+            setPrev(node->next, node->prev);
+        } else {
+            other.tail = node->prev;
+        }
+        other.size--;
+        setPrev(node, tail);
+        setNext(node, nullptr);
+        if (tail) {
+            setNext(tail, node);
+        } else {
+            head = node;
+        }
+        tail = node;
+        size++;
+    }
+
+    /*
+     * Name: DoubleLinkedList.splice (all)
+     * Description: Moves every node of another list to this list's tail in O(1), other is left empty. Same allocator
+     *              rule as splice of one node.
+     * Parameters: other - The list to take the nodes from.
+     * Returns: void - No return value. Throws std::invalid_argument if the allocators compare unequal.
+     */
+    template<typename T, template<typename> class Allocator>
+    void DoubleLinkedList<T, Allocator>::splice(DoubleLinkedList& other) {
+        if (&other == this || !other.head) return;
+        static_assert(requires { allocator == other.allocator; },
+                      "splice needs allocators that compare equal (e.g. NodePoolRef), every NodePool owns its own nodes");
+        if (!(allocator == other.allocator)) {
+            throw std::invalid_argument("DoubleLinkedList splice between lists with different allocators");
+        }
+        setPrev(other.head, tail);
+        if (tail) {
+            setNext(tail, other.head);
+        } else {
+            head = other.head;
+        }
+        tail = other.tail;
+        size += other.size;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+    }
+
 }
 
 #endif //DOUBLELINKEDLIST_H
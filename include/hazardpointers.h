@@ -0,0 +1,270 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef HAZARDPOINTERS_H
+#define HAZARDPOINTERS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+/* Notes:
+ * Hazard pointers (Maged Michael) for the lock-free node containers. Before a thread dereferences a shared node it
+ * publishes the pointer in one of its hazard slots, and a node that has been unlinked is retired instead of deleted:
+ * it is only freed once no hazard slot points at it. So a popped node can be freed while other threads are still
+ * looking at it, and a CAS on a node pointer cannot suffer ABA: a protected node is never freed, so its address
+ * cannot come back as a different node while the CAS is pending.
+ *
+ * Functions in the hazard domain class:
+ * instance - Returns the process-wide domain the containers share.
+ * protect - Publishes the current value of an atomic pointer in one of the thread's slots and returns it, validated.
+ * clear - Empties one of the thread's hazard slots.
+ * clearAll - Empties all of the thread's hazard slots.
+ * retire - Hands over an unlinked node, it is deleted (or passed to a custom deleter) once no hazard slot points at it.
+ * reclaim - Frees the thread's retired nodes that are no longer protected, right now.
+ * retiredCount - Number of nodes the thread has retired that are not freed yet.
+ *
+ * Rules:
+ * Every thread gets slotsPerThread hazard slots, from a record it claims on first use and hands back when it exits
+ * (records are reused, never freed before the end of the program). Retired nodes are scanned in batches, once a thread
+ * holds about twice as many as there are hazard slots in total, so freeing is O(1) amortized per node. Nodes a thread
+ * still holds when it exits go to the domain and are picked up by the next scan of another thread.
+ */
+
+namespace CommandaStructures {
+
+    class HazardDomain {
+    public:
+        static constexpr size_t slotsPerThread = 2;      // Enough for the stack (1) and the Michael-Scott queue (2)
+
+        static HazardDomain& instance();                 // Process-wide domain
+        ~HazardDomain();
+        HazardDomain(const HazardDomain&) = delete;      // Shared by every thread, copying makes no sense
+        HazardDomain& operator=(const HazardDomain&) = delete;
+        template<typename T>
+        T* protect(size_t slot, const std::atomic<T*>& source); // Publishes source's pointer in slot and returns it
+        void clear(size_t slot) { local().record->hazards[slot].store(nullptr, std::memory_order_release); } // Empties one slot
+        void clearAll();                                 // Empties all of this thread's slots
+        template<typename T>
+        void retire(T* node) { retire(node, [](void* pointer, void*) { delete static_cast<T*>(pointer); }); } // Deletes node once unprotected
+        void retire(void* node, void (*deleter)(void*, void*), void* context = nullptr); // Calls deleter(node, context) once node is unprotected
+        void reclaim();                                  // Frees this thread's unprotected retired nodes now
+        [[nodiscard]] size_t retiredCount() { return local().retired.size(); } // Retired by this thread, not freed yet
+
+    private:
+        static constexpr size_t cacheLineSize = 64;
+
+        // One thread's hazard slots, on a cache line of their own since the owner writes them on every operation
+        struct alignas(cacheLineSize) Record {
+            std::atomic<void*> hazards[slotsPerThread];
+            std::atomic<bool> active;                    // Claimed by a live thread
+            Record* next;                                // Records form a push-only list
+        };
+
+        struct Retired {
+            void* node;
+            void (*deleter)(void*, void*);
+            void* context;                               // Second argument of deleter, e.g. the pool the node goes back to
+        };
+
+        struct ThreadState {
+            Record* record;                              // This thread's slots
+            std::vector<Retired> retired;                // Nodes this thread retired that are not freed yet
+            explicit ThreadState(HazardDomain& domain) : record(domain.acquireRecord()) {}
+            ~ThreadState();                              // Hands the leftovers to the domain and frees the record
+        };
+
+        HazardDomain() = default;
+        std::atomic<Record*> records{nullptr};           // Every record ever created
+        std::atomic<size_t> recordCount{0};              // Length of records, sets the scan threshold
+        std::mutex orphanMutex;                          // Guards orphans
+        std::vector<Retired> orphans;                    // Nodes left behind by threads that exited
+
+        ThreadState& local();                            // The calling thread's state, created on first use
+        Record* acquireRecord();                         // Reuses a free record or pushes a new one
+        void scan(std::vector<Retired>& retired);        // Frees every node in retired that no hazard slot points at
+    };
+
+    /*
+     * Name: HazardDomain.instance
+     * Description: Returns the process-wide domain, created on first use. Containers share it, so a thread only ever
+     *              needs one record no matter how many lock-free containers it touches.
+     * Parameters: None
+     * Returns: HazardDomain& - The domain.
+     */
+    inline HazardDomain& HazardDomain::instance() {
+        static HazardDomain domain;
+        return domain;
+    }
+
+    /*
+     * Name: HazardDomain destructor
+     * Description: Frees the orphaned nodes and the records. Runs at program exit, after every thread is gone.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline HazardDomain::~HazardDomain() {
+        for (const Retired& retired : orphans) {
+            retired.deleter(retired.node, retired.context);
+        }
+        Record* record = records.load(std::memory_order_acquire);
+        while (record) {
+            Record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    /*
+     * Name: HazardDomain.protect
+     * Description: Loads source, publishes the pointer in one of this thread's hazard slots and loads source again
+     *              until both loads agree. From then on the node cannot be freed until the slot is cleared or reused.
+     * Parameters: slot - Which of the thread's slots to use (0 to slotsPerThread - 1).
+     *             source - The atomic pointer to read, e.g. a stack head.
+     * Returns: T* - The protected pointer (may be nullptr).
+     */
+    template<typename T>
+    T* HazardDomain::protect(size_t slot, const std::atomic<T*>& source) {
+        std::atomic<void*>& hazard = local().record->hazards[slot];
+        T* pointer = source.load(std::memory_order_relaxed);
+        while (true) {
+            hazard.store(pointer, std::memory_order_seq_cst); // Must be visible before the re-check below
+            T* current = source.load(std::memory_order_seq_cst);
+            if (current == pointer) {
+                return pointer;
+            }
+            pointer = current;
+        }
+    }
+
+    /*
+     * Name: HazardDomain.clearAll
+     * Description: Empties all of this thread's hazard slots.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline void HazardDomain::clearAll() {
+        Record* record = local().record;
+        for (auto& hazard : record->hazards) {
+            hazard.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    /*
+     * Name: HazardDomain.retire
+     * Description: Takes over a node that has been unlinked from its container. It is freed by a later scan once no
+     *              hazard slot points at it; a scan runs when this thread's list reaches the threshold.
+     * Parameters: node - The unlinked node, no new references to it may be created.
+     *             deleter - Frees the node, called as deleter(node, context).
+     *             context - Passed through to deleter (default is nullptr).
+     * Returns: void - No return value.
+     */
+    inline void HazardDomain::retire(void* node, void (*deleter)(void*, void*), void* context) {
+        ThreadState& state = local();
+        state.retired.push_back({node, deleter, context});
+        if (state.retired.size() >= 2 * slotsPerThread * recordCount.load(std::memory_order_relaxed) + 32) {
+            scan(state.retired);
+        }
+    }
+
+    /*
+     * Name: HazardDomain.reclaim
+     * Description: Scans now instead of waiting for the threshold, freeing every node of this thread that is not protected.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline void HazardDomain::reclaim() {
+        scan(local().retired);
+    }
+
+    /*
+     * Name: HazardDomain.local
+     * Description: Returns the calling thread's state, claiming a record on the first call.
+     * Parameters: None
+     * Returns: ThreadState& - The state.
+     */
+    inline HazardDomain::ThreadState& HazardDomain::local() {
+        thread_local ThreadState state(instance());
+        return state;
+    }
+
+    /*
+     * Name: HazardDomain.acquireRecord
+     * Description: Claims a record left by a thread that has exited, or pushes a new one onto the record list.
+     * Parameters: None
+     * Returns: Record* - The claimed record, all slots empty.
+     */
+    inline HazardDomain::Record* HazardDomain::acquireRecord() {
+        for (Record* record = records.load(std::memory_order_acquire); record; record = record->next) {
+            if (!record->active.load(std::memory_order_relaxed) && !record->active.exchange(true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+        auto* record = new Record();  // Value-initialized: every slot empty
+        record->active.store(true, std::memory_order_relaxed);
+        record->next = records.load(std::memory_order_relaxed);
+        while (!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        recordCount.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    /*
+     * Name: HazardDomain.scan
+     * Description: Collects every published hazard pointer, then frees the retired nodes that are not among them and
+     *              keeps the rest. Also adopts the orphans of exited threads if no other thread is doing so.
+     * Parameters: retired - The list to scan, protected nodes stay in it.
+     * Returns: void - No return value.
+     */
+    inline void HazardDomain::scan(std::vector<Retired>& retired) {
+        if (orphanMutex.try_lock()) {
+            retired.insert(retired.end(), orphans.begin(), orphans.end());
+            orphans.clear();
+            orphanMutex.unlock();
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst); // Pairs with the store / re-load in protect()
+        std::vector<void*> hazards;
+        for (Record* record = records.load(std::memory_order_acquire); record; record = record->next) {
+            for (const auto& hazard : record->hazards) {
+                if (void* pointer = hazard.load(std::memory_order_seq_cst)) {
+                    hazards.push_back(pointer);
+                }
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+        size_t kept = 0;
+        for (const Retired& node : retired) {
+            if (std::binary_search(hazards.begin(), hazards.end(), node.node)) {
+                retired[kept++] = node;  // Still in use somewhere, try again next scan
+            } else {
+                node.deleter(node.node, node.context);
+            }
+        }
+        retired.resize(kept);
+    }
+
+    /*
+     * Name: HazardDomain.ThreadState destructor
+     * Description: Runs when a thread exits: clears its slots, frees what it can, hands the rest to the domain and
+     *              releases the record for the next thread.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline HazardDomain::ThreadState::~ThreadState() {
+        HazardDomain& domain = instance();
+        for (auto& hazard : record->hazards) {
+            hazard.store(nullptr, std::memory_order_release);
+        }
+        domain.scan(retired);
+        if (!retired.empty()) {
+            std::lock_guard<std::mutex> lock(domain.orphanMutex);
+            domain.orphans.insert(domain.orphans.end(), retired.begin(), retired.end());
+        }
+        record->active.store(false, std::memory_order_release);
+    }
+
+}
+
+#endif //HAZARDPOINTERS_H
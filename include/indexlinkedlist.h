@@ -0,0 +1,464 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef INDEXLINKEDLIST_H
+#define INDEXLINKEDLIST_H
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "nodes.h" // Include the IndexNode class definition
+using namespace CommandaStructures::Indexed;
+/* Notes:
+ * Double linked list whose nodes all live in one contiguous vector and link to each other by 32-bit slot index.
+ * Compared to DoubleLinkedList on a 64-bit host the links take 8 bytes instead of 16, the nodes sit next to each other,
+ * and because no node stores an address the list can be copied, moved or (for trivially copyable T) written out and
+ * read back byte for byte without fixing up a single link. Removed slots go on a free list and are reused first.
+ *
+ * Functions in the index linked list class:
+ * insert - Inserts a value at a position (HEAD, TAIL or an index) and returns its handle.
+ * insertAfter / insertBefore - Inserts a value next to the node with the given handle and returns the new handle.
+ * remove - Removes the first node with the given value.
+ * removeNode - Removes the node with the given handle.
+ * findNode - Returns the handle of the first node with the given value, or none.
+ * contains - Checks if the list holds the given value.
+ * get / next / prev - Value and neighbours of the node with the given handle.
+ * getHead / getTail - Handles of the first / last node (none if the list is empty).
+ * reverse - Reverses the list in place.
+ * compact - Renumbers the nodes into list order and drops the free slots (invalidates handles).
+ * reserve / capacity - Slot vector capacity.
+ * getSlots / getFreeHead / restore - Raw slot array and free list head, and adopting a saved slot array.
+ * clear / display / getSize / isEmpty / iterators - Same as DoubleLinkedList.
+ *
+ * Handles:
+ * A handle (Handle, a uint32_t slot index) replaces the DoubleNode<T>* of DoubleLinkedList. It stays valid until its
+ * node is removed; after that the slot may be handed out again. Handles survive growth of the vector, iterators and
+ * references to values do not. Removing a slot that is already free throws std::invalid_argument.
+ * Saving: getSlots() with getHead() / getTail() / getFreeHead() is the complete state. For trivially copyable T the
+ * slot array can be written out with one memcpy and handed back to restore() on load.
+ * A removed slot's value is moved out and destroyed when T has a destructor to run, so whatever it owns is released
+ * right away; the moved-from value stays in the slot until the slot is reused. T does not need a default constructor.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class IndexLinkedList {
+    public:
+        using Handle = uint32_t;
+        using Node = IndexNode<T>;
+        static constexpr Handle none = UINT32_MAX;    // "No node", like nullptr for DoubleLinkedList
+
+        IndexLinkedList();
+        Handle insert(const T& value, int spot = TAIL);       // Inserts a value at spot (default is TAIL, which appends to the end)
+        Handle insertAfter(Handle node, const T& value);      // Inserts a value after the given node
+        Handle insertBefore(Handle node, const T& value);     // Inserts a value before the given node
+        void remove(const T& value);                          // Removes the first node with the given value
+        void removeNode(Handle node);                         // Removes the given node
+        [[nodiscard]] Handle findNode(const T& value) const;  // Handle of the first node with the given value, or none
+        bool contains(const T& value) const { return findNode(value) != none; } // Checks if the list holds the value
+        T& get(Handle node) { return slot(node).data; }       // Value of a node
+        const T& get(Handle node) const { return slot(node).data; }
+        [[nodiscard]] Handle next(Handle node) const { return slot(node).next; } // Handle of the next node, or none
+        [[nodiscard]] Handle prev(Handle node) const { return slot(node).prev; } // Handle of the previous node, or none
+        [[nodiscard]] Handle getHead() const { return head; }           // Handle of the first node
+        [[nodiscard]] Handle getTail() const { return tail; }           // Handle of the last node
+        [[nodiscard]] size_t getSize() const { return size; }           // Number of nodes
+        [[nodiscard]] bool isEmpty() const { return size == 0; }        // Checks if the list is empty
+        void reverse();                                       // Reverses the list in place
+        void compact();                                       // Puts the nodes in list order, handles change
+        void reserve(size_t nodes) { slots.reserve(nodes); }  // Makes room for nodes slots without reallocating
+        [[nodiscard]] size_t capacity() const { return slots.capacity(); } // Slots the vector can hold without growing
+        [[nodiscard]] const std::vector<Node>& getSlots() const { return slots; } // Raw slot array, live and free slots
+        [[nodiscard]] Handle getFreeHead() const { return freeHead; }   // First free slot, or none
+        void restore(std::vector<Node> savedSlots, Handle savedHead, Handle savedTail, Handle savedFreeHead); // Adopts a saved slot array
+        void clear();                                         // Removes every node
+        template<typename Func>
+        void display(Func func) const;                        // Calls func on every value, in order
+
+        enum Spot {
+            HEAD = 0, // Insert at the front
+            TAIL = -1 // Insert at the end (default behavior)
+        };
+
+        class Iterator {
+        public:
+            Iterator(Node* nodes, Handle current) : nodes(nodes), current(current) {}
+            T& operator*() const { return nodes[current].data; }
+            Iterator& operator++() { current = nodes[current].next; return *this; }
+            bool operator!=(const Iterator& other) const { return current != other.current; }
+            bool operator==(const Iterator& other) const { return current == other.current; }
+            [[nodiscard]] Handle handle() const { return current; } // Handle of the node the iterator is on
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+        private:
+            Node* nodes;
+            Handle current;
+        };
+
+        Iterator begin() const { return Iterator(const_cast<Node*>(slots.data()), head); }
+        Iterator end() const { return Iterator(const_cast<Node*>(slots.data()), none); }
+
+        class ReverseIterator {
+        public:
+            ReverseIterator(Node* nodes, Handle current) : nodes(nodes), current(current) {}
+            T& operator*() const { return nodes[current].data; }
+            ReverseIterator& operator++() { current = nodes[current].prev; return *this; }
+            bool operator!=(const ReverseIterator& other) const { return current != other.current; }
+            bool operator==(const ReverseIterator& other) const { return current == other.current; }
+
+        private:
+            Node* nodes;
+            Handle current;
+        };
+
+        ReverseIterator rbegin() const { return ReverseIterator(const_cast<Node*>(slots.data()), tail); }
+        ReverseIterator rend() const { return ReverseIterator(const_cast<Node*>(slots.data()), none); }
+
+        class ConstIterator {
+        public:
+            ConstIterator(const Node* nodes, Handle current) : nodes(nodes), current(current) {}
+            const T& operator*() const { return nodes[current].data; }
+            ConstIterator& operator++() { current = nodes[current].next; return *this; }
+            bool operator!=(const ConstIterator& other) const { return current != other.current; }
+            bool operator==(const ConstIterator& other) const { return current == other.current; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+        private:
+            const Node* nodes;
+            Handle current;
+        };
+        ConstIterator cbegin() const { return ConstIterator(slots.data(), head); }
+        ConstIterator cend() const { return ConstIterator(slots.data(), none); }
+
+    private:
+        static constexpr Handle freeMark = none - 1;  // prev of a slot on the free list
+
+        std::vector<Node> slots; // Every slot ever used, live nodes and free ones
+        Handle head;             // First node
+        Handle tail;             // Last node
+        Handle freeHead;         // First free slot, free slots are chained through next
+        size_t size;             // Number of live nodes
+
+        Node& slot(Handle node);                        // Checked access to a live node
+        const Node& slot(Handle node) const;
+        Handle createNode(const T& value, Handle next, Handle prev); // Takes a free slot (or a new one) and fills it in
+        void link(Handle node);                         // Points the neighbours of a filled-in node at it
+    };
+
+    /*
+     * Name: IndexLinkedList constructor
+     * Description: Initializes an empty list with no slots allocated.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    IndexLinkedList<T>::IndexLinkedList() : head(none), tail(none), freeHead(none), size(0) {}
+
+    /*
+     * Name: IndexLinkedList.insert
+     * Description: Inserts a new node with the given value at the specified position in the list.
+     * Parameters: value - The value to be inserted into the list.
+     *             spot - HEAD (0) for the front, TAIL (-1, default) or any index past the end for the back,
+     *                    otherwise the index the value will have.
+     * Returns: Handle - The handle of the new node.
+     */
+    template<typename T>
+    typename IndexLinkedList<T>::Handle IndexLinkedList<T>::insert(const T& value, int spot) {
+        if (spot == HEAD) {
+            Handle node = createNode(value, head, none);
+            link(node);
+            return node;
+        }
+        if (spot < 0 || static_cast<size_t>(spot) >= size) {
+            Handle node = createNode(value, none, tail);
+            link(node);
+            return node;
+        }
+        Handle current = head;
+        for (int i = 0; i < spot; ++i) {
+            current = slots[current].next; // Walk to the node that will follow the new one
+        }
+        return insertBefore(current, value);
+    }
+
+    /*
+     * Name: IndexLinkedList.insertAfter
+     * Description: Inserts a new node with the given value after the specified node.
+     * Parameters: node - Handle of the node after which the new node should be inserted (none does nothing).
+     *             value - The value to be inserted into the list.
+     * Returns: Handle - The handle of the new node, or none if node was none.
+     */
+    template<typename T>
+    typename IndexLinkedList<T>::Handle IndexLinkedList<T>::insertAfter(Handle node, const T& value) {
+        if (node == none) return none;
+        Handle newNode = createNode(value, slot(node).next, node);
+        link(newNode);
+        return newNode;
+    }
+
+    /*
+     * Name: IndexLinkedList.insertBefore
+     * Description: Inserts a new node with the given value before the specified node.
+     * Parameters: node - Handle of the node before which the new node should be inserted (none does nothing).
+     *             value - The value to be inserted into the list.
+     * Returns: Handle - The handle of the new node, or none if node was none.
+     */
+    template<typename T>
+    typename IndexLinkedList<T>::Handle IndexLinkedList<T>::insertBefore(Handle node, const T& value) {
+        if (node == none) return none;
+        Handle newNode = createNode(value, node, slot(node).prev);
+        link(newNode);
+        return newNode;
+    }
+
+    /*
+     * Name: IndexLinkedList.remove
+     * Description: Removes the first node with the given value from the list.
+     * Parameters: value - The value of the node to be removed.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::remove(const T& value) {
+        Handle node = findNode(value);
+        if (node != none) {
+            removeNode(node);
+        }
+    }
+
+    /*
+     * Name: IndexLinkedList.removeNode
+     * Description: Releases the node's value, then unlinks the node and puts its slot on the free list.
+     * Parameters: node - Handle of the node to be removed (none does nothing).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::removeNode(Handle node) {
+        if (node == none) return;
+        Node& removed = slot(node);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            // Let go of what the value owns now rather than when the slot is reused. This runs before anything is
+            // unlinked, so a throwing move leaves the list as it was.
+            T released(std::move(removed.data));
+        }
+        if (removed.prev != none) slots[removed.prev].next = removed.next; // Not the head
+        else head = removed.next;
+        if (removed.next != none) slots[removed.next].prev = removed.prev; // Not the tail
+        else tail = removed.prev;
+
+        removed.next = freeHead;
+        removed.prev = freeMark;
+        freeHead = node;
+        size--;
+    }
+
+    /*
+     * Name: IndexLinkedList.findNode
+     * Description: Finds the first node with the given value.
+     * Parameters: value - The value to search for in the list.
+     * Returns: Handle - The handle of the node, or none if not found.
+     */
+    template<typename T>
+    typename IndexLinkedList<T>::Handle IndexLinkedList<T>::findNode(const T& value) const {
+        for (Handle current = head; current != none; current = slots[current].next) {
+            if (slots[current].data == value) {
+                return current;
+            }
+        }
+        return none;
+    }
+
+    /*
+     * Name: IndexLinkedList.reverse
+     * Description: Reverses the list in place by swapping every node's links.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::reverse() {
+        for (Handle current = head; current != none;) {
+            Node& node = slots[current];
+            std::swap(node.next, node.prev);
+            current = node.prev; // The old next
+        }
+        std::swap(head, tail);
+    }
+
+    /*
+     * Name: IndexLinkedList.compact
+     * Description: Rebuilds the slot vector with the nodes in list order and no free slots, so a traversal reads the
+     *              vector front to back. Every handle changes: node i of the list ends up in slot i.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::compact() {
+        std::vector<Node> ordered;
+        ordered.reserve(size);
+        for (Handle current = head; current != none; current = slots[current].next) {
+            const Handle index = static_cast<Handle>(ordered.size());
+            ordered.emplace_back(std::move(slots[current].data), index + 1, index == 0 ? none : index - 1);
+        }
+        if (!ordered.empty()) {
+            ordered.back().next = none;
+        }
+        slots = std::move(ordered);
+        head = size ? 0 : none;
+        tail = size ? static_cast<Handle>(size - 1) : none;
+        freeHead = none;
+    }
+
+    /*
+     * Name: IndexLinkedList.restore
+     * Description: Replaces the list with a slot array saved earlier (getSlots() and the three handles that go with it).
+     *              The chain from savedHead is walked once to count the nodes and check the links, and the free chain from
+     *              savedFreeHead to check that every free slot is marked free and that live and free slots add up to the
+     *              whole array (so neither chain can loop).
+     * Parameters: savedSlots - The slot array.
+     *             savedHead - getHead() at the time of saving.
+     *             savedTail - getTail() at the time of saving.
+     *             savedFreeHead - getFreeHead() at the time of saving.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::restore(std::vector<Node> savedSlots, Handle savedHead, Handle savedTail, Handle savedFreeHead) {
+        size_t count = 0;
+        Handle last = none;
+        for (Handle current = savedHead; current != none; current = savedSlots[current].next) {
+            if (current >= savedSlots.size() || savedSlots[current].prev != last || count == savedSlots.size()) {
+                throw std::invalid_argument("IndexLinkedList saved slots are not a valid list");
+            }
+            last = current;
+            count++;
+        }
+        if (last != savedTail) {
+            throw std::invalid_argument("IndexLinkedList saved slots are not a valid list");
+        }
+        size_t freeCount = 0;
+        for (Handle current = savedFreeHead; current != none; current = savedSlots[current].next) {
+            if (current >= savedSlots.size() || savedSlots[current].prev != freeMark || count + freeCount == savedSlots.size()) {
+                throw std::invalid_argument("IndexLinkedList saved free list is not valid");
+            }
+            freeCount++;
+        }
+        if (count + freeCount != savedSlots.size()) {
+            throw std::invalid_argument("IndexLinkedList saved slots are neither in the list nor on the free list");
+        }
+        slots = std::move(savedSlots);
+        head = savedHead;
+        tail = savedTail;
+        freeHead = savedFreeHead;
+        size = count;
+    }
+
+    /*
+     * Name: IndexLinkedList.clear
+     * Description: Removes every node and every free slot, the vector keeps its capacity.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::clear() {
+        slots.clear();
+        head = none;
+        tail = none;
+        freeHead = none;
+        size = 0;
+    }
+
+    /*
+     * Name: IndexLinkedList.display
+     * Description: Displays the contents of the list using a custom function.
+     * Parameters: func - A function that takes a const reference to T and returns void.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    template<typename Func>
+    void IndexLinkedList<T>::display(Func func) const {
+        for (Handle current = head; current != none; current = slots[current].next) {
+            func(slots[current].data);
+        }
+    }
+
+    /*
+     * Name: IndexLinkedList.slot
+     * Description: Returns the node behind a handle, checking that the handle names a live node.
+     * Parameters: node - The handle.
+     * Returns: Node& - The node.
+     */
+    template<typename T>
+    typename IndexLinkedList<T>::Node& IndexLinkedList<T>::slot(Handle node) {
+        return const_cast<Node&>(static_cast<const IndexLinkedList<T>*>(this)->slot(node));
+    }
+
+    template<typename T>
+    const typename IndexLinkedList<T>::Node& IndexLinkedList<T>::slot(Handle node) const {
+        if (node >= slots.size()) {
+            throw std::out_of_range("IndexLinkedList handle out of range");
+        }
+        if (slots[node].prev == freeMark) {
+            throw std::invalid_argument("IndexLinkedList handle refers to a removed node");
+        }
+        return slots[node];
+    }
+
+    /*
+     * Name: IndexLinkedList.createNode
+     * Description: Stores a value in the most recently freed slot, or in a new slot at the end of the vector.
+     *              The neighbours are not touched yet, see link().
+     * Parameters: value - The value to be stored.
+     *             next - Handle of the node that will follow it.
+     *             prev - Handle of the node that will precede it.
+     * Returns: Handle - The slot used.
+     */
+    template<typename T>
+    typename IndexLinkedList<T>::Handle IndexLinkedList<T>::createNode(const T& value, Handle next, Handle prev) {
+        if (freeHead != none) {
+            Handle node = freeHead;
+            Node& reused = slots[node];
+            reused.data = value; // If this throws, the slot is still on the free list
+            freeHead = reused.next;
+            reused.next = next;
+            reused.prev = prev;
+            return node;
+        }
+        if (slots.size() >= freeMark) {
+            throw std::length_error("IndexLinkedList is limited to 2^32 - 2 nodes");
+        }
+        slots.emplace_back(value, next, prev);
+        return static_cast<Handle>(slots.size() - 1);
+    }
+
+    /*
+     * Name: IndexLinkedList.link
+     * Description: Points the neighbours named by a new node's next / prev at it, updating head and tail at the ends.
+     * Parameters: node - Handle of the new node.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void IndexLinkedList<T>::link(Handle node) {
+        const Node& linked = slots[node];
+        if (linked.prev != none) slots[linked.prev].next = node;
+        else head = node;
+        if (linked.next != none) slots[linked.next].prev = node;
+        else tail = node;
+        size++;
+    }
+
+}
+
+#endif //INDEXLINKEDLIST_H
@@ -0,0 +1,392 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef INTRUSIVEDOUBLELIST_H
+#define INTRUSIVEDOUBLELIST_H
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "nodes.h" // Include the DoubleHook class definition
+using namespace CommandaStructures::Intrusive;
+/* Notes:
+ * Intrusive double linked list: the objects carry their own links (a DoubleHook<T> member) and the list never allocates
+ * or copies them, it only splices pointers. Any object can be unlinked in O(1), wherever it is in the list.
+ *
+ * Functions in the intrusive double list class:
+ * insert - Links an object in at a position (HEAD, TAIL or an index), same as DoubleLinkedList::insert. O(1) at the ends.
+ * insertAfter / insertBefore - Links an object in next to one that is already in the list. O(1).
+ * remove - Unlinks a given object. O(1).
+ * pop_front / pop_back - Unlinks and returns the first / last object. O(1).
+ * contains - Checks if an object is in this list (O(1) with checks on, else a walk).
+ * front / back / getSize / isEmpty / clear / reverse / display / iterators - Same as DoubleLinkedList.
+ *
+ * Rules:
+ * Same as IntrusiveList: objects must outlive their time in the list, and with COMMANDA_INTRUSIVE_CHECKS on (the default
+ * unless NDEBUG) double insertion or removal from the wrong list throws std::logic_error.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, DoubleHook<T> T::*Hook>
+    class IntrusiveDoubleList {
+    public:
+        IntrusiveDoubleList();
+        ~IntrusiveDoubleList();
+        IntrusiveDoubleList(const IntrusiveDoubleList&) = delete; // The objects point at each other, not at a copy
+        IntrusiveDoubleList& operator=(const IntrusiveDoubleList&) = delete;
+        void insert(T& item, int spot = TAIL);         // Links item in at spot (default is TAIL, which appends to the end)
+        void insertAfter(T& position, T& item);        // Links item in right after position
+        void insertBefore(T& position, T& item);       // Links item in right before position
+        void remove(T& item);                          // Unlinks item
+        T& pop_front();                                // Unlinks and returns the first object
+        T& pop_back();                                 // Unlinks and returns the last object
+        bool contains(const T& item) const;            // Checks if item is in this list
+        T& front() const;                              // First object
+        T& back() const;                               // Last object
+        [[nodiscard]] size_t getSize() const { return size; }    // Number of objects
+        [[nodiscard]] bool isEmpty() const { return size == 0; } // Checks if the list is empty
+        void clear();                                  // Unlinks every object
+        void reverse();                                // Reverses the list in place
+        template<typename Func>
+        void display(Func func) const;                 // Calls func on every object, in order
+
+        enum Spot {
+            HEAD = 0, // Link in at the front
+            TAIL = -1 // Link in at the end (default behavior)
+        };
+
+        class Iterator {
+        public:
+            explicit Iterator(T* ptr) : current(ptr) {}
+            T& operator*() const { return *current; }
+            T* operator->() const { return current; }
+            Iterator& operator++() { current = ((*current).*Hook).next; return *this; }
+            bool operator!=(const Iterator& other) const { return current != other.current; }
+            bool operator==(const Iterator& other) const { return current == other.current; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+        private:
+            T* current;
+        };
+
+        Iterator begin() const { return Iterator(head); }
+        Iterator end() const { return Iterator(nullptr); }
+
+        class ReverseIterator {
+        public:
+            explicit ReverseIterator(T* ptr) : current(ptr) {}
+            T& operator*() const { return *current; }
+            ReverseIterator& operator++() { current = ((*current).*Hook).prev; return *this; }
+            bool operator!=(const ReverseIterator& other) const { return current != other.current; }
+            bool operator==(const ReverseIterator& other) const { return current == other.current; }
+
+        private:
+            T* current;
+        };
+
+        ReverseIterator rbegin() const { return ReverseIterator(tail); }
+        ReverseIterator rend() const { return ReverseIterator(nullptr); }
+
+        class ConstIterator {
+        public:
+            explicit ConstIterator(const T* ptr) : current(ptr) {}
+            const T& operator*() const { return *current; }
+            const T* operator->() const { return current; }
+            ConstIterator& operator++() { current = ((*current).*Hook).next; return *this; }
+            bool operator!=(const ConstIterator& other) const { return current != other.current; }
+            bool operator==(const ConstIterator& other) const { return current == other.current; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+        private:
+            const T* current;
+        };
+        ConstIterator cbegin() const { return ConstIterator(head); }
+        ConstIterator cend() const { return ConstIterator(nullptr); }
+
+    private:
+        size_t size; // Number of objects
+        T* head;     // First object
+        T* tail;     // Last object
+
+        static DoubleHook<T>& hook(T& item) { return item.*Hook; }
+        void link(T& item, T* prev, T* next);          // Claims item and splices it in between prev and next
+        void checkOwned(const T& item) const;          // Checks item is in this list
+    };
+
+    /*
+     * Name: IntrusiveDoubleList constructor
+     * Description: Initializes an empty list with the head and tail pointer set to nullptr.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    IntrusiveDoubleList<T, Hook>::IntrusiveDoubleList() : size(0), head(nullptr), tail(nullptr) {}
+
+    /*
+     * Name: IntrusiveDoubleList destructor
+     * Description: Unlinks every object, so they can go into another list later. Nothing is destroyed.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    IntrusiveDoubleList<T, Hook>::~IntrusiveDoubleList() {
+        clear();
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.insert
+     * Description: Links an object into the list at the given position.
+     * Parameters: item - The object to link in (not in any list through this hook).
+     *             spot - HEAD (0) for the front, TAIL (-1, default) or any index past the end for the back,
+     *                    otherwise the index the object will have.
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::insert(T& item, int spot) {
+        if (spot == HEAD) {
+            link(item, nullptr, head);
+            return;
+        }
+        if (spot < 0 || static_cast<size_t>(spot) >= size) {
+            link(item, tail, nullptr);
+            return;
+        }
+        T* current = head;
+        for (int i = 0; i < spot; i++) {
+            current = hook(*current).next; // Walk to the object that will follow item
+        }
+        link(item, hook(*current).prev, current);
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.insertAfter
+     * Description: Links an object in right after one that is already in the list.
+     * Parameters: position - An object in this list.
+     *             item - The object to link in (not in any list through this hook).
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::insertAfter(T& position, T& item) {
+        checkOwned(position);
+        link(item, &position, hook(position).next);
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.insertBefore
+     * Description: Links an object in right before one that is already in the list.
+     * Parameters: position - An object in this list.
+     *             item - The object to link in (not in any list through this hook).
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::insertBefore(T& position, T& item) {
+        checkOwned(position);
+        link(item, hook(position).prev, &position);
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.remove
+     * Description: Unlinks a given object from wherever it is in the list, in O(1).
+     * Parameters: item - An object in this list.
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::remove(T& item) {
+        checkOwned(item);
+        DoubleHook<T>& links = hook(item);
+        if (links.prev) hook(*links.prev).next = links.next; // Not the head
+        else head = links.next;
+        if (links.next) hook(*links.next).prev = links.prev; // Not the tail
+        else tail = links.prev;
+        links.next = nullptr;
+        links.prev = nullptr;
+#if COMMANDA_INTRUSIVE_CHECKS
+        links.owner = nullptr;
+#endif
+        size--;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.pop_front
+     * Description: Unlinks the first object and returns it.
+     * Parameters: None
+     * Returns: T& - The object that was first.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    T& IntrusiveDoubleList<T, Hook>::pop_front() {
+        T& item = front();
+        remove(item);
+        return item;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.pop_back
+     * Description: Unlinks the last object and returns it.
+     * Parameters: None
+     * Returns: T& - The object that was last.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    T& IntrusiveDoubleList<T, Hook>::pop_back() {
+        T& item = back();
+        remove(item);
+        return item;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.contains
+     * Description: Checks if an object is in this list. O(1) with COMMANDA_INTRUSIVE_CHECKS on, else a walk.
+     * Parameters: item - The object to look for.
+     * Returns: bool - True if item is in this list.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    bool IntrusiveDoubleList<T, Hook>::contains(const T& item) const {
+#if COMMANDA_INTRUSIVE_CHECKS
+        return (item.*Hook).owner == this;
+#else
+        for (const T* current = head; current; current = (current->*Hook).next) {
+            if (current == &item) return true;
+        }
+        return false;
+#endif
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.front
+     * Description: Returns the first object in the list.
+     * Parameters: None
+     * Returns: T& - Reference to the first object.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    T& IntrusiveDoubleList<T, Hook>::front() const {
+        if (!head) {
+            throw std::out_of_range("IntrusiveDoubleList is empty");
+        }
+        return *head;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.back
+     * Description: Returns the last object in the list.
+     * Parameters: None
+     * Returns: T& - Reference to the last object.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    T& IntrusiveDoubleList<T, Hook>::back() const {
+        if (!tail) {
+            throw std::out_of_range("IntrusiveDoubleList is empty");
+        }
+        return *tail;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.clear
+     * Description: Unlinks every object and resets its hook. The objects themselves are untouched.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::clear() {
+        T* current = head;
+        while (current) {
+            DoubleHook<T>& links = hook(*current);
+            current = links.next;
+            links.next = nullptr;
+            links.prev = nullptr;
+#if COMMANDA_INTRUSIVE_CHECKS
+            links.owner = nullptr;
+#endif
+        }
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.reverse
+     * Description: Reverses the list in place by swapping every object's links.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::reverse() {
+        for (T* current = head; current;) {
+            DoubleHook<T>& links = hook(*current);
+            std::swap(links.next, links.prev);
+            current = links.prev; // The old next
+        }
+        std::swap(head, tail);
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.display
+     * Description: Calls a function for every object in the list, in order.
+     * Parameters: func - A function that takes a const reference to T and returns void.
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    template<typename Func>
+    void IntrusiveDoubleList<T, Hook>::display(Func func) const {
+        for (const T* current = head; current; current = (current->*Hook).next) {
+            func(*current);
+        }
+        std::cout << std::endl;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.link
+     * Description: Checks the object is unlinked (with checks on), then splices it in between two neighbours.
+     * Parameters: item - The object to link in.
+     *             prev - The object that will precede it (nullptr for the front).
+     *             next - The object that will follow it (nullptr for the back).
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::link(T& item, T* prev, T* next) {
+        DoubleHook<T>& links = hook(item);
+#if COMMANDA_INTRUSIVE_CHECKS
+        if (links.owner) {
+            throw std::logic_error("IntrusiveDoubleList: object is already in a list");
+        }
+        links.owner = this;
+#endif
+        links.prev = prev;
+        links.next = next;
+        if (prev) hook(*prev).next = &item;
+        else head = &item;
+        if (next) hook(*next).prev = &item;
+        else tail = &item;
+        size++;
+    }
+
+    /*
+     * Name: IntrusiveDoubleList.checkOwned
+     * Description: With checks on, makes sure the object is in this list.
+     * Parameters: item - The object.
+     * Returns: void - No return value.
+     */
+    template<typename T, DoubleHook<T> T::*Hook>
+    void IntrusiveDoubleList<T, Hook>::checkOwned(const T& item) const {
+#if COMMANDA_INTRUSIVE_CHECKS
+        if ((item.*Hook).owner != this) {
+            throw std::logic_error("IntrusiveDoubleList: object is not in this list");
+        }
+#else
+        (void)item;
+#endif
+    }
+
+}
+
+#endif //INTRUSIVEDOUBLELIST_H
@@ -0,0 +1,396 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include "nodes.h" // Include the SingleHook class definition
+using namespace CommandaStructures::Intrusive;
+/* Notes:
+ * Intrusive singly linked list: the objects carry their own link (a SingleHook<T> member) and the list never allocates
+ * or copies them, it only splices pointers. Meant for objects that already live in static or long-lived storage
+ * (actuator commands, scheduled tasks) and move between lists.
+ *
+ * Functions in the intrusive list class:
+ * insert - Links an object in at a position (HEAD, TAIL or an index), same as LinkedList::insert. O(1) at the ends.
+ * insertAfter - Links an object in after one that is already in the list. O(1).
+ * pop_front - Unlinks and returns the first object. O(1).
+ * removeAfter - Unlinks and returns the object after a given one. O(1).
+ * remove - Unlinks a given object. O(n), it has to find the one before it (IntrusiveDoubleList does this in O(1)).
+ * contains - Checks if an object is in this list (O(1) with checks on, else a walk).
+ * front / back / getSize / isEmpty / clear / reverse / display / iterators - Same as LinkedList.
+ *
+ * Rules:
+ * An object must outlive its time in the list and must not be in two lists through the same hook. With
+ * COMMANDA_INTRUSIVE_CHECKS on (the default unless NDEBUG), inserting an object that is already linked, or removing one
+ * that is not in this list, throws std::logic_error; with it off those are undefined behavior.
+ * clear() and the destructor unlink every object, they do not destroy anything.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, SingleHook<T> T::*Hook>
+    class IntrusiveList {
+    public:
+        IntrusiveList();
+        ~IntrusiveList();
+        IntrusiveList(const IntrusiveList&) = delete;            // The objects point at each other, not at a copy
+        IntrusiveList& operator=(const IntrusiveList&) = delete;
+        void insert(T& item, int spot = TAIL);         // Links item in at spot (default is TAIL, which appends to the end)
+        void insertAfter(T& position, T& item);        // Links item in right after position
+        T& pop_front();                                // Unlinks and returns the first object
+        T* removeAfter(T& position);                   // Unlinks and returns the object after position (nullptr if none)
+        void remove(T& item);                          // Unlinks item
+        bool contains(const T& item) const;            // Checks if item is in this list
+        T& front() const;                              // First object
+        T& back() const;                               // Last object
+        [[nodiscard]] size_t getSize() const { return size; }    // Number of objects
+        [[nodiscard]] bool isEmpty() const { return size == 0; } // Checks if the list is empty
+        void clear();                                  // Unlinks every object
+        void reverse();                                // Reverses the list in place
+        template<typename Func>
+        void display(Func func) const;                 // Calls func on every object, in order
+
+        enum Spot {
+            HEAD = 0, // Link in at the front
+            TAIL = -1 // Link in at the end (default behavior)
+        };
+
+        class Iterator {
+        public:
+            explicit Iterator(T* ptr) : current(ptr) {}
+            T& operator*() const { return *current; }
+            T* operator->() const { return current; }
+            Iterator& operator++() { current = ((*current).*Hook).next; return *this; }
+            bool operator!=(const Iterator& other) const { return current != other.current; }
+            bool operator==(const Iterator& other) const { return current == other.current; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+        private:
+            T* current;
+        };
+
+        Iterator begin() const { return Iterator(head); }
+        Iterator end() const { return Iterator(nullptr); }
+
+        class ConstIterator {
+        public:
+            explicit ConstIterator(const T* ptr) : current(ptr) {}
+            const T& operator*() const { return *current; }
+            const T* operator->() const { return current; }
+            ConstIterator& operator++() { current = ((*current).*Hook).next; return *this; }
+            bool operator!=(const ConstIterator& other) const { return current != other.current; }
+            bool operator==(const ConstIterator& other) const { return current == other.current; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+        private:
+            const T* current;
+        };
+        ConstIterator cbegin() const { return ConstIterator(head); }
+        ConstIterator cend() const { return ConstIterator(nullptr); }
+
+    private:
+        size_t size; // Number of objects
+        T* head;     // First object
+        T* tail;     // Last object
+
+        static SingleHook<T>& hook(T& item) { return item.*Hook; }
+        void claim(T& item);                           // Checks item is unlinked and marks it as ours
+        void release(T& item);                         // Resets item's hook after it was unlinked
+        void checkOwned(const T& item) const;          // Checks item is in this list
+    };
+
+    /*
+     * Name: IntrusiveList constructor
+     * Description: Initializes an empty list with the head and tail pointer set to nullptr.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    IntrusiveList<T, Hook>::IntrusiveList() : size(0), head(nullptr), tail(nullptr) {}
+
+    /*
+     * Name: IntrusiveList destructor
+     * Description: Unlinks every object, so they can go into another list later. Nothing is destroyed.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    IntrusiveList<T, Hook>::~IntrusiveList() {
+        clear();
+    }
+
+    /*
+     * Name: IntrusiveList.insert
+     * Description: Links an object into the list at the given position.
+     * Parameters: item - The object to link in (not in any list through this hook).
+     *             spot - HEAD (0) for the front, TAIL (-1, default) or any index past the end for the back,
+     *                    otherwise the index the object will have.
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::insert(T& item, int spot) {
+        if (spot == HEAD) {
+            claim(item);
+            hook(item).next = head;
+            head = &item;
+            if (!tail) tail = &item; // If the list was empty, set tail
+            size++;
+            return;
+        }
+        if (spot < 0 || static_cast<size_t>(spot) >= size) {
+            claim(item);
+            if (tail) hook(*tail).next = &item;
+            else head = &item;
+            tail = &item;
+            size++;
+            return;
+        }
+        T* current = head;
+        for (int i = 0; i < spot - 1; i++) {
+            current = hook(*current).next; // Walk to the object before the spot
+        }
+        insertAfter(*current, item);
+    }
+
+    /*
+     * Name: IntrusiveList.insertAfter
+     * Description: Links an object in right after one that is already in the list.
+     * Parameters: position - An object in this list.
+     *             item - The object to link in (not in any list through this hook).
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::insertAfter(T& position, T& item) {
+        checkOwned(position);
+        claim(item);
+        hook(item).next = hook(position).next;
+        hook(position).next = &item;
+        if (tail == &position) tail = &item;
+        size++;
+    }
+
+    /*
+     * Name: IntrusiveList.pop_front
+     * Description: Unlinks the first object and returns it.
+     * Parameters: None
+     * Returns: T& - The object that was first.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::pop_front() {
+        if (!head) {
+            throw std::out_of_range("IntrusiveList is empty");
+        }
+        T& item = *head;
+        head = hook(item).next;
+        if (!head) tail = nullptr;
+        release(item);
+        size--;
+        return item;
+    }
+
+    /*
+     * Name: IntrusiveList.removeAfter
+     * Description: Unlinks the object that follows a given one.
+     * Parameters: position - An object in this list.
+     * Returns: T* - The unlinked object, or nullptr if position was the last one.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    T* IntrusiveList<T, Hook>::removeAfter(T& position) {
+        checkOwned(position);
+        T* item = hook(position).next;
+        if (!item) return nullptr;
+        hook(position).next = hook(*item).next;
+        if (tail == item) tail = &position;
+        release(*item);
+        size--;
+        return item;
+    }
+
+    /*
+     * Name: IntrusiveList.remove
+     * Description: Unlinks a given object. The list is singly linked, so this walks to the object before it.
+     * Parameters: item - An object in this list.
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::remove(T& item) {
+        checkOwned(item);
+        if (head == &item) {
+            pop_front();
+            return;
+        }
+        T* current = head;
+        while (current && hook(*current).next != &item) {
+            current = hook(*current).next;
+        }
+        if (current) {
+            removeAfter(*current);
+        }
+        // If item is not in the list, do nothing
+    }
+
+    /*
+     * Name: IntrusiveList.contains
+     * Description: Checks if an object is in this list. O(1) with COMMANDA_INTRUSIVE_CHECKS on, else a walk.
+     * Parameters: item - The object to look for.
+     * Returns: bool - True if item is in this list.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    bool IntrusiveList<T, Hook>::contains(const T& item) const {
+#if COMMANDA_INTRUSIVE_CHECKS
+        return (item.*Hook).owner == this;
+#else
+        for (const T* current = head; current; current = (current->*Hook).next) {
+            if (current == &item) return true;
+        }
+        return false;
+#endif
+    }
+
+    /*
+     * Name: IntrusiveList.front
+     * Description: Returns the first object in the list.
+     * Parameters: None
+     * Returns: T& - Reference to the first object.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::front() const {
+        if (!head) {
+            throw std::out_of_range("IntrusiveList is empty");
+        }
+        return *head;
+    }
+
+    /*
+     * Name: IntrusiveList.back
+     * Description: Returns the last object in the list.
+     * Parameters: None
+     * Returns: T& - Reference to the last object.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::back() const {
+        if (!tail) {
+            throw std::out_of_range("IntrusiveList is empty");
+        }
+        return *tail;
+    }
+
+    /*
+     * Name: IntrusiveList.clear
+     * Description: Unlinks every object and resets its hook. The objects themselves are untouched.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::clear() {
+        T* current = head;
+        while (current) {
+            T* nextItem = hook(*current).next;
+            release(*current);
+            current = nextItem;
+        }
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+
+    /*
+     * Name: IntrusiveList.reverse
+     * Description: Reverses the list in place.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::reverse() {
+        T* prev = nullptr;
+        T* current = head;
+        tail = head;
+        while (current) {
+            T* nextItem = hook(*current).next;
+            hook(*current).next = prev;
+            prev = current;
+            current = nextItem;
+        }
+        head = prev;
+    }
+
+    /*
+     * Name: IntrusiveList.display
+     * Description: Calls a function for every object in the list, in order.
+     * Parameters: func - A function that takes a const reference to T and returns void.
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    template<typename Func>
+    void IntrusiveList<T, Hook>::display(Func func) const {
+        for (const T* current = head; current; current = (current->*Hook).next) {
+            func(*current);
+        }
+        std::cout << std::endl;
+    }
+
+    /*
+     * Name: IntrusiveList.claim
+     * Description: With checks on, makes sure the object is not linked anywhere yet and records this list as its owner.
+     * Parameters: item - The object about to be linked in.
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::claim(T& item) {
+#if COMMANDA_INTRUSIVE_CHECKS
+        if (hook(item).owner) {
+            throw std::logic_error("IntrusiveList: object is already in a list");
+        }
+        hook(item).owner = this;
+#endif
+        hook(item).next = nullptr;
+    }
+
+    /*
+     * Name: IntrusiveList.release
+     * Description: Resets the hook of an object that was just unlinked.
+     * Parameters: item - The unlinked object.
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::release(T& item) {
+        hook(item).next = nullptr;
+#if COMMANDA_INTRUSIVE_CHECKS
+        hook(item).owner = nullptr;
+#endif
+    }
+
+    /*
+     * Name: IntrusiveList.checkOwned
+     * Description: With checks on, makes sure the object is in this list.
+     * Parameters: item - The object.
+     * Returns: void - No return value.
+     */
+    template<typename T, SingleHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::checkOwned(const T& item) const {
+#if COMMANDA_INTRUSIVE_CHECKS
+        if ((item.*Hook).owner != this) {
+            throw std::logic_error("IntrusiveList: object is not in this list");
+        }
+#else
+        (void)item;
+#endif
+    }
+
+}
+
+#endif //INTRUSIVELIST_H
@@ -4,18 +4,35 @@
 
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "nodepool.h" // Default node allocator
 #include "nodes.h" // Include the Node class definition
 using namespace CommandaStructures::Single;
 
 
 namespace CommandaStructures {
-    /* Linked List Class */
-    template<typename T> // Template class for LinkedList (allows for different data types)
+    /* Linked List Class
+     * Nodes come from Allocator<SingleNode<T>>, a NodePool by default (see nodepool.h), so steady-state insert/remove
+     * recycles nodes instead of calling new/delete. LinkedList<T, std::allocator> allocates every node on the heap.
+     */
+    template<typename T, template<typename> class Allocator = NodePool> // Template class for LinkedList (allows for different data types)
     class LinkedList {
     public:
         LinkedList();
+        explicit LinkedList(Allocator<SingleNode<T>> nodeAllocator); // Uses the given allocator, e.g. an ArenaAllocator bound to an arena
+        LinkedList(const LinkedList& other);          // Deep copy, the copy gets its own allocator (same arena for ArenaAllocator)
+        LinkedList(LinkedList&& other) noexcept(std::is_nothrow_move_constructible_v<Allocator<SingleNode<T>>>); // Takes over the nodes, O(1)
+        LinkedList& operator=(const LinkedList& other); // Replaces the contents with a deep copy of other
+        LinkedList& operator=(LinkedList&& other) noexcept(std::is_nothrow_move_assignable_v<Allocator<SingleNode<T>>>); // Frees this list's nodes, takes over other's
         ~LinkedList();
         void insert(const T& value, int spot = TAIL); // insert a new node with the given value to the end of the list (spot is optional)
+        void insert(T&& value, int spot = TAIL);      // Same, but moves the value into the node
+        template<typename... Args>
+        T& emplace_front(Args&&... args);             // Constructs a new value in place at the head of the list
+        template<typename... Args>
+        T& emplace_back(Args&&... args);              // Constructs a new value in place at the end of the list
         void remove(const T& value);                  // Remove the first node with the given value from the list
         template<typename Func>                       // Function to display the contents of the linked list using a custom function
         void display(Func func) const;                // Display the contents using a custom function
@@ -27,6 +44,8 @@ namespace CommandaStructures {
         void clear();                                 // Clear the linked list by deleting all nodes
         bool contains(const T& value) const { return findNode(value) != nullptr; } // Check if the list contains a node with the given value
         void reverse(); // Reverse the linked list in place
+        Allocator<SingleNode<T>>& getAllocator() { return allocator; } // Node allocator, e.g. for reserve() / highWater()
+        const Allocator<SingleNode<T>>& getAllocator() const { return allocator; }
 
         enum Spot {
             HEAD = 0, // Enum to define positions for appending nodes
@@ -79,7 +98,14 @@ namespace CommandaStructures {
         size_t size;   // Size of the linked list
         SingleNode<T>* head; // Pointer to the first node in the list
         SingleNode<T>* tail; // Pointer to the last node in the list
+        Allocator<SingleNode<T>> allocator; // Where the nodes come from
         // Enum to define positions for appending nodes
+
+        template<typename... Args>
+        SingleNode<T>* createNode(Args&&... args);   // Allocates a node and constructs its value from args
+        void linkNode(SingleNode<T>* newNode, int spot); // Links a new node in at spot (the position logic of insert)
+        static Allocator<SingleNode<T>> copyAllocator(const Allocator<SingleNode<T>>& source); // Allocator for a copy of the list
+        void destroyNode(SingleNode<T>* node);       // Destroys a node and gives its memory back to the allocator
     };
 
     /*
@@ -88,8 +114,85 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    LinkedList<T>::LinkedList() : size(0), head(nullptr), tail(nullptr) {
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>::LinkedList() : size(0), head(nullptr), tail(nullptr) {
+    }
+
+    /*
+     * Name: LinkedList constructor (allocator)
+     * Description: Initializes an empty list that gets its nodes from the given allocator.
+     * Parameters: nodeAllocator - The allocator to use, e.g. ArenaAllocator (constructible straight from an Arena).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>::LinkedList(Allocator<SingleNode<T>> nodeAllocator)
+        : size(0), head(nullptr), tail(nullptr), allocator(std::move(nodeAllocator)) {}
+
+    /*
+     * Name: LinkedList copy constructor
+     * Description: Initializes a list holding copies of other's values, in the same order.
+     *              A copyable allocator (ArenaAllocator, std::allocator) is copied, a NodePool is not shared: the copy gets its own.
+     * Parameters: other - The list to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>::LinkedList(const LinkedList& other)
+        : size(0), head(nullptr), tail(nullptr), allocator(copyAllocator(other.allocator)) {
+        try {
+            for (const SingleNode<T>* current = other.head; current; current = current->next) {
+                SingleNode<T>* newNode = createNode(current->data);
+                if (tail) tail->next = newNode;
+                else head = newNode;
+                tail = newNode;
+                size++;
+            }
+        } catch (...) {
+            clear(); // The destructor does not run for a half-built object
+            throw;
+        }
+    }
+
+    /*
+     * Name: LinkedList move constructor
+     * Description: Takes over other's nodes and allocator without touching a single node. other is left empty.
+     * Parameters: other - The list to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>::LinkedList(LinkedList&& other) noexcept(std::is_nothrow_move_constructible_v<Allocator<SingleNode<T>>>)
+        : size(std::exchange(other.size, 0)), head(std::exchange(other.head, nullptr)), tail(std::exchange(other.tail, nullptr)),
+          allocator(std::move(other.allocator)) {}
+
+    /*
+     * Name: LinkedList copy assignment
+     * Description: Replaces the contents with copies of other's values (copy, then move into place).
+     * Parameters: other - The list to copy.
+     * Returns: LinkedList& - This list.
+     */
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList& other) {
+        if (this != &other) {
+            *this = LinkedList(other); // If copying throws, this list is untouched
+        }
+        return *this;
+    }
+
+    /*
+     * Name: LinkedList move assignment
+     * Description: Destroys this list's nodes, then takes over other's nodes and allocator. other is left empty.
+     * Parameters: other - The list to move from.
+     * Returns: LinkedList& - This list.
+     */
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList&& other) noexcept(std::is_nothrow_move_assignable_v<Allocator<SingleNode<T>>>) {
+        if (this != &other) {
+            clear(); // Our nodes go back to our allocator before it is replaced
+            allocator = std::move(other.allocator);
+            head = std::exchange(other.head, nullptr);
+            tail = std::exchange(other.tail, nullptr);
+            size = std::exchange(other.size, 0);
+        }
+        return *this;
     }
 
     /*
@@ -98,17 +201,9 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    LinkedList<T>::~LinkedList() {
-        SingleNode<T>* current = head;
-        while (current) {
-            SingleNode<T>* nextNode = current->next; // Store the next node
-            delete current; // Delete the current node
-            current = nextNode; // Move to the next node
-        }
-        size = 0; // Reset size to zero
-        head = nullptr; // Set head to nullptr after deletion
-        tail = nullptr; // Set tail to nullptr after deletion
+    template<typename T, template<typename> class Allocator>
+    LinkedList<T, Allocator>::~LinkedList() {
+        clear(); // Destroys every node (or, for an allocator that releases in bulk, just forgets them)
     }
 
     /*
@@ -118,10 +213,60 @@ namespace CommandaStructures {
      *             spot - The position where the new node should be inserted (default is TAIL, which appends to the end).
      * Returns: void - No return value.
      */
-    template<typename T>
-    void LinkedList<T>::insert(const T& value, int spot) {
-        // Create a new node with the given value
-        SingleNode<T>* newNode = new SingleNode<T>(value);
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::insert(const T& value, int spot) {
+        linkNode(createNode(value), spot);
+    }
+
+    /*
+     * Name: LinkedList.insert (move)
+     * Description: Same as insert, but the value is moved into the new node instead of copied.
+     * Parameters: value - The value to be moved into the linked list.
+     *             spot - The position where the new node should be inserted (default is TAIL, which appends to the end).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::insert(T&& value, int spot) {
+        linkNode(createNode(std::move(value)), spot);
+    }
+
+    /*
+     * Name: LinkedList.emplace_front
+     * Description: Constructs a new value in place in a node at the head of the list, no temporary T is made.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new value.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& LinkedList<T, Allocator>::emplace_front(Args&&... args) {
+        SingleNode<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNode(newNode, HEAD);
+        return newNode->data;
+    }
+
+    /*
+     * Name: LinkedList.emplace_back
+     * Description: Constructs a new value in place in a node at the end of the list, no temporary T is made.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new value.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& LinkedList<T, Allocator>::emplace_back(Args&&... args) {
+        SingleNode<T>* newNode = createNode(std::forward<Args>(args)...);
+        linkNode(newNode, TAIL);
+        return newNode->data;
+    }
+
+    /*
+     * Name: LinkedList.linkNode
+     * Description: Links a freshly created node into the list at the given position.
+     * Parameters: newNode - The node to link in (next is nullptr).
+     *             spot - The position where the node should be inserted (HEAD, TAIL or an index).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::linkNode(SingleNode<T>* newNode, int spot) {
         // If the spot is 0, insert at the head
         if (spot == HEAD) {
             newNode->next = head;
@@ -137,23 +282,21 @@ namespace CommandaStructures {
             size++;
             return;
         }
-        // Set the current node to the head and traverse to the desired spot
-        SingleNode<T>* current = head;
-        // If spot is positive, traverse to the specified position
-        if (spot > 0) {
-            for (int i = 0; i < spot - 1 && current->next; i++) {
-                current = current->next;
-            }
+        // If spot is negative or past the end, append after the tail without walking the list
+        if (spot < 0 || static_cast<size_t>(spot) >= size) {
+            newNode->next = nullptr;
+            tail->next = newNode;
+            tail = newNode;
+            size++;
+            return;
         }
-        // If spot is negative or greater than the size, insert to the end
-        else {
-            while (current->next) {
-                current = current->next;
-            }
+        // Set the current node to the head and traverse to the node before the desired spot
+        SingleNode<T>* current = head;
+        for (int i = 0; i < spot - 1; i++) {
+            current = current->next;
         }
         newNode->next = current->next;
         current->next = newNode;
-        if (!newNode->next) tail = newNode; // If inserted at end, update tail
         size++; // Increment size
     }
 
@@ -163,15 +306,15 @@ namespace CommandaStructures {
      * Parameters: value - The value of the node to be removed.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void LinkedList<T>::remove(const T& value) {
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::remove(const T& value) {
         // If the list is empty, do nothing
         if (!head) return;
         // If the head node contains the value, remove it and update the head pointer
         if (head->getData() == value) {
             SingleNode<T>* temp = head;
             head = head->next;
-            delete temp;
+            destroyNode(temp);
             size--;
             return;
         }
@@ -188,7 +331,7 @@ namespace CommandaStructures {
             if (!current->next) {
                 tail = current; // If we removed the last node, update the tail pointer
             }
-            delete temp;
+            destroyNode(temp);
             size--;
         }
         // If we didn't find the node, do nothing
@@ -200,9 +343,9 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
+    template<typename T, template<typename> class Allocator>
     template<typename Func>
-    void LinkedList<T>::display(Func func) const {
+    void LinkedList<T, Allocator>::display(Func func) const {
         // Get the head of the list and traverse through each node, printing the data
         SingleNode<T>* current = head;
         while (current) {
@@ -220,8 +363,8 @@ namespace CommandaStructures {
      * Parameters: value - The value to search for in the linked list.
      * Returns: SingleNode<T>* - Pointer to the node containing the value, or nullptr if not found.
      */
-    template<typename T>
-    SingleNode<T>* LinkedList<T>::findNode(const T& value) const {
+    template<typename T, template<typename> class Allocator>
+    SingleNode<T>* LinkedList<T, Allocator>::findNode(const T& value) const {
         const SingleNode<T>* current = head; // Start from the head of the list
         // Traverse the list to find the node with the given value
         while (current) {
@@ -240,15 +383,15 @@ namespace CommandaStructures {
      * Parameters: node - Pointer to the node to be removed.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void LinkedList<T>::removeNode(SingleNode<T>* node) {
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::removeNode(SingleNode<T>* node) {
         if (!node || !head) return; // If the node is null or the list is empty, do nothing
         if (node == head) {
             head = head->next; // Update the head pointer
             if (node == tail) {
                 tail = nullptr;  // The list had one element
             }
-            delete node; // Delete the node
+            destroyNode(node); // Delete the node
             size--; // Decrement the size of the list
             return;
         }
@@ -263,7 +406,7 @@ namespace CommandaStructures {
             if (node == tail) {
                 tail = current; // Update the tail if the removed node was the last one
             }
-            delete node; // Delete the node
+            destroyNode(node); // Delete the node
             size--; // Decrement the size of the list
         }
     }
@@ -271,15 +414,24 @@ namespace CommandaStructures {
     /*
      * Name: LinkedList.clear
      * Description: Clears the linked list by deleting all nodes.
+     *              With an allocator that releases in bulk (ArenaAllocator) and a trivially destructible T, the nodes are
+     *              just forgotten in O(1), the arena takes the memory back on reset() / rollback().
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    void LinkedList<T>::clear() {
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::clear() {
+        if constexpr (allocatorReleasesInBulk<Allocator<SingleNode<T>>> && std::is_trivially_destructible_v<T>) {
+            // Nothing to destroy and nothing to give back: the allocator's owner frees all nodes at once
+            head = nullptr;
+            tail = nullptr;
+            size = 0;
+            return;
+        }
         SingleNode<T>* current = head; // Start from the head of the list
         while (current) {
             SingleNode<T>* nextNode = current->next; // Store the next node
-            delete current; // Delete the current node
+            destroyNode(current); // Delete the current node
             current = nextNode; // Move to the next node
         }
         head = nullptr; // Set head to nullptr after deletion
@@ -287,14 +439,62 @@ namespace CommandaStructures {
         size = 0; // Reset size to zero
     }
 
+    /*
+     * Name: LinkedList.createNode
+     * Description: Gets memory for a node from the allocator and constructs the node's value in it from args
+     *              (a const T& copies, a T&& moves, anything else goes to T's constructor).
+     * Parameters: args - The value, or the arguments for T's constructor.
+     * Returns: SingleNode<T>* - The new node (next is nullptr).
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    SingleNode<T>* LinkedList<T, Allocator>::createNode(Args&&... args) {
+        SingleNode<T>* node = allocator.allocate(1);
+        try {
+            std::construct_at(node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            allocator.deallocate(node, 1); // Constructing the value threw, do not lose the memory
+            throw;
+        }
+        return node;
+    }
+
+    /*
+     * Name: LinkedList.copyAllocator
+     * Description: Picks the allocator for a copy of the list: a copy of source if the allocator can be copied
+     *              (ArenaAllocator keeps using the same arena), else a fresh one (every list owns its own NodePool).
+     * Parameters: source - The allocator of the list being copied.
+     * Returns: Allocator<SingleNode<T>> - The allocator for the copy.
+     */
+    template<typename T, template<typename> class Allocator>
+    Allocator<SingleNode<T>> LinkedList<T, Allocator>::copyAllocator(const Allocator<SingleNode<T>>& source) {
+        if constexpr (std::is_copy_constructible_v<Allocator<SingleNode<T>>>) {
+            return source;
+        } else {
+            return Allocator<SingleNode<T>>();
+        }
+    }
+
+    /*
+     * Name: LinkedList.destroyNode
+     * Description: Destroys a node and returns its memory to the allocator.
+     * Parameters: node - The node to destroy (already unlinked).
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::destroyNode(SingleNode<T>* node) {
+        std::destroy_at(node);
+        allocator.deallocate(node, 1);
+    }
+
     /*
      * Name: LinkedList.reverse
      * Description: Reverses the linked list in place.
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    void LinkedList<T>::reverse() {
+    template<typename T, template<typename> class Allocator>
+    void LinkedList<T, Allocator>::reverse() {
         SingleNode<T>* prev = nullptr; // Previous node pointer
         SingleNode<T>* current = head; // Current node pointer
         tail = head; // Set tail to the current head
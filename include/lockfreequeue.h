@@ -0,0 +1,310 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "concurrentnodepool.h" // Pooled nodes, shared by every thread
+#include "hazardpointers.h"     // Safe reclamation of dequeued nodes
+/* Notes:
+ * Unbounded lock-free FIFO queue (Michael-Scott queue), the concurrent counterpart of Queue for backlogs whose depth
+ * cannot be bounded ahead of time. Any number of threads may push and pop at the same time. Use MpmcQueue instead
+ * when a bound is known: it never allocates and has no pointer chasing.
+ *
+ * Functions in the lock-free queue class:
+ * push - Adds a new element to the end of the queue (copies, or moves an rvalue). Never waits.
+ * emplace - Constructs a new element in place at the end of the queue.
+ * try_pop - Removes the front element into out, returns false if the queue is empty.
+ * pop - Removes and returns the front element, throws if the queue is empty (same as Queue::pop).
+ * isEmpty - Checks if the queue is empty (snapshot).
+ * reserve - Makes sure nodes nodes can be pushed before the pool has to grow.
+ *
+ * How it works:
+ * A singly linked list with a dummy node in front: head points at the dummy, the first element is in head->next and
+ * tail points at the last node (or lags one behind, any thread that notices helps it along). push links the new node
+ * after the last node with a CAS on its next pointer, then swings tail. pop swings head to head->next with a CAS; the
+ * node it moved onto becomes the new dummy, and its value is moved out and destroyed right there, so dummies never
+ * hold an element. Every operation takes effect at a single CAS, which makes the queue linearizable.
+ * Before dereferencing head, tail or head->next a thread protects them with hazard pointers (hazardpointers.h), so
+ * the old dummy is retired rather than freed and a CAS can never see a recycled node (no ABA).
+ *
+ * Memory:
+ * Nodes come from a ConcurrentNodePool, not new, so a queue that has reached its high-water mark stops allocating.
+ * A retired node goes back to the pool once no thread can still see it. The pool lives until the queue is destroyed
+ * and the last retired node has come back, so destroying a queue never leaves another thread's retire list dangling.
+ * There is no size counter on purpose: a shared counter would be a third contended cache line on every operation.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class LockFreeQueue {
+    public:
+        explicit LockFreeQueue(size_t nodesPerSlab = 256);
+        ~LockFreeQueue();
+        LockFreeQueue(const LockFreeQueue&) = delete;        // Shared between threads, copying makes no sense
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+        void push(const T& value) { pushNode(createNode(value)); }          // Adds a new element to the end of the queue
+        void push(T&& value) { pushNode(createNode(std::move(value))); }    // Same, but moves the value in
+        template<typename... Args>
+        void emplace(Args&&... args) { pushNode(createNode(std::forward<Args>(args)...)); } // Constructs the element in place
+        bool try_pop(T& out);                                // Removes the front element into out, false if empty
+        T pop();                                             // Removes and returns the front element, throws if empty
+        [[nodiscard]] bool isEmpty() const;                  // Checks if the queue is empty (snapshot)
+        void reserve(size_t nodes) { storage->pool.reserve(nodes + 1); } // Room for nodes elements (plus the dummy)
+
+    private:
+        static constexpr size_t cacheLineSize = 64;
+
+        struct Node {
+            std::atomic<Node*> next;
+            alignas(T) unsigned char storage[sizeof(T)];     // The element, only alive between push and pop
+            Node() : next(nullptr) {}                        // Leaves storage alone, the element is constructed separately
+            T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        // Outlives the queue while retired nodes are still on their way back to the pool
+        struct Storage {
+            ConcurrentNodePool<Node> pool;
+            std::atomic<size_t> references;                  // 1 for the queue + 1 per retired node not yet returned
+            explicit Storage(size_t nodesPerSlab) : pool(nodesPerSlab), references(1) {}
+        };
+
+        alignas(cacheLineSize) std::atomic<Node*> head;      // The dummy node, consumers CAS here
+        alignas(cacheLineSize) std::atomic<Node*> tail;      // The last node (or one behind), producers CAS here
+        alignas(cacheLineSize) Storage* storage;
+
+        template<typename... Args>
+        Node* createNode(Args&&... args);                    // Pool node with the element constructed in it
+        void pushNode(Node* node);                           // Links a node in at the end
+        Node* unlinkFront(Node*& dummy);                     // Swings head on, returns the node holding the element
+        void finishPop(Node* dummy, Node* front);            // Destroys the popped element and retires the old dummy
+        static void recycle(void* node, void* storage);      // Hazard deleter: gives a retired node back to the pool
+        static void release(Storage* storage);               // Drops one reference, the last one frees the pool
+    };
+
+    /*
+     * Name: LockFreeQueue constructor
+     * Description: Initializes an empty queue, which is just the dummy node.
+     * Parameters: nodesPerSlab - Size of the first slab of the node pool (default is 256), later slabs double.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    LockFreeQueue<T>::LockFreeQueue(size_t nodesPerSlab) : storage(new Storage(nodesPerSlab)) {
+        Node* dummy = std::construct_at(storage->pool.allocate());
+        head.store(dummy, std::memory_order_relaxed);
+        tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    /*
+     * Name: LockFreeQueue destructor
+     * Description: Destroys the remaining elements and drops the queue's reference to the pool. No thread may be
+     *              using the queue anymore.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    LockFreeQueue<T>::~LockFreeQueue() {
+        Node* node = head.load(std::memory_order_acquire);
+        Node* next = node->next.load(std::memory_order_relaxed);
+        std::destroy_at(node); // The dummy holds no element
+        storage->pool.deallocate(node);
+        for (node = next; node; node = next) {
+            next = node->next.load(std::memory_order_relaxed);
+            std::destroy_at(node->value());
+            std::destroy_at(node);
+            storage->pool.deallocate(node);
+        }
+        release(storage);
+    }
+
+    /*
+     * Name: LockFreeQueue.try_pop
+     * Description: Removes the front element if there is one. Lock-free: a failed CAS means another thread made progress.
+     * Parameters: out - Receives the removed element (moved out).
+     * Returns: bool - True if an element was removed, false if the queue is empty.
+     */
+    template<typename T>
+    bool LockFreeQueue<T>::try_pop(T& out) {
+        Node* dummy = nullptr;
+        Node* front = unlinkFront(dummy);
+        if (!front) {
+            return false;
+        }
+        out = std::move(*front->value());
+        finishPop(dummy, front);
+        return true;
+    }
+
+    /*
+     * Name: LockFreeQueue.pop
+     * Description: Removes and returns the front element of the queue.
+     * Parameters: None
+     * Returns: T - The value of the removed element.
+     */
+    template<typename T>
+    T LockFreeQueue<T>::pop() {
+        Node* dummy = nullptr;
+        Node* front = unlinkFront(dummy);
+        if (!front) {
+            throw std::out_of_range("LockFreeQueue is empty");
+        }
+        T value = std::move(*front->value());
+        finishPop(dummy, front);
+        return value;
+    }
+
+    /*
+     * Name: LockFreeQueue.isEmpty
+     * Description: Checks if the queue held no elements at the moment of the check.
+     * Parameters: None
+     * Returns: bool - True if the queue is empty.
+     */
+    template<typename T>
+    bool LockFreeQueue<T>::isEmpty() const {
+        HazardDomain& domain = HazardDomain::instance();
+        Node* first = domain.protect(0, head);
+        const bool empty = first->next.load(std::memory_order_acquire) == nullptr;
+        domain.clear(0);
+        return empty;
+    }
+
+    /*
+     * Name: LockFreeQueue.createNode
+     * Description: Takes a node from the pool and constructs the element in it.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: Node* - The new node, not linked yet.
+     */
+    template<typename T>
+    template<typename... Args>
+    typename LockFreeQueue<T>::Node* LockFreeQueue<T>::createNode(Args&&... args) {
+        Node* node = std::construct_at(storage->pool.allocate());
+        try {
+            std::construct_at(reinterpret_cast<T*>(node->storage), std::forward<Args>(args)...);
+        } catch (...) {
+            std::destroy_at(node);
+            storage->pool.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+    /*
+     * Name: LockFreeQueue.pushNode
+     * Description: Links a node in after the last node with a CAS on its next pointer, then swings tail to it.
+     *              If tail lags behind, it is moved on first (by whichever thread gets there).
+     * Parameters: node - The new node, owned by the queue from here on.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void LockFreeQueue<T>::pushNode(Node* node) {
+        HazardDomain& domain = HazardDomain::instance();
+        while (true) {
+            Node* last = domain.protect(0, tail);
+            Node* next = last->next.load(std::memory_order_acquire);
+            if (last != tail.load(std::memory_order_acquire)) {
+                continue;
+            }
+            if (next) {
+                tail.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed); // Help the lagging tail
+                continue;
+            }
+            Node* expected = nullptr;
+            if (last->next.compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+                tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed); // Fine if it fails, someone helped
+                domain.clear(0);
+                return;
+            }
+        }
+    }
+
+    /*
+     * Name: LockFreeQueue.unlinkFront
+     * Description: Swings head from the dummy to the first element's node with a CAS, helping a lagging tail on the
+     *              way. The node it returns is the new dummy, still protected by hazard slot 1 and with its element
+     *              alive: only the caller may touch the element, other threads only read next pointers.
+     * Parameters: dummy - Receives the old dummy, which the caller retires through finishPop.
+     * Returns: Node* - The node holding the removed element, or nullptr if the queue is empty.
+     */
+    template<typename T>
+    typename LockFreeQueue<T>::Node* LockFreeQueue<T>::unlinkFront(Node*& dummy) {
+        HazardDomain& domain = HazardDomain::instance();
+        while (true) {
+            Node* first = domain.protect(0, head);
+            Node* next = domain.protect(1, first->next);     // Cannot be retired while head is still first
+            if (first != head.load(std::memory_order_acquire)) {
+                continue;
+            }
+            if (!next) {
+                domain.clearAll();
+                return nullptr;
+            }
+            Node* last = tail.load(std::memory_order_acquire);
+            if (first == last) {
+                tail.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed); // Tail lags, help it
+                continue;
+            }
+            if (head.compare_exchange_strong(first, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                dummy = first;
+                return next;
+            }
+        }
+    }
+
+    /*
+     * Name: LockFreeQueue.finishPop
+     * Description: Destroys the element that was moved out of front (front stays on as the dummy, empty), drops the
+     *              hazards and retires the old dummy, which goes back to the pool once nobody can see it.
+     * Parameters: dummy - The old dummy returned by unlinkFront.
+     *             front - The node returned by unlinkFront.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void LockFreeQueue<T>::finishPop(Node* dummy, Node* front) {
+        std::destroy_at(front->value());
+        HazardDomain& domain = HazardDomain::instance();
+        domain.clearAll();
+        storage->references.fetch_add(1, std::memory_order_relaxed);
+        domain.retire(dummy, &recycle, storage);
+    }
+
+    /*
+     * Name: LockFreeQueue.recycle
+     * Description: Called by the hazard domain once a retired node is unprotected: returns it to the pool and drops
+     *              the reference the retire took.
+     * Parameters: node - The retired node (its element is already destroyed).
+     *             storage - The Storage the node belongs to.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void LockFreeQueue<T>::recycle(void* node, void* storage) {
+        auto* owner = static_cast<Storage*>(storage);
+        Node* retired = static_cast<Node*>(node);
+        std::destroy_at(retired);
+        owner->pool.deallocate(retired);
+        release(owner);
+    }
+
+    /*
+     * Name: LockFreeQueue.release
+     * Description: Drops one reference to the storage and frees it (pool and all) when it was the last one.
+     * Parameters: storage - The storage.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void LockFreeQueue<T>::release(Storage* storage) {
+        if (storage->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete storage;
+        }
+    }
+
+}
+
+#endif //LOCKFREEQUEUE_H
@@ -0,0 +1,256 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef LOCKFREESTACK_H
+#define LOCKFREESTACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include "hazardpointers.h" // Safe reclamation of popped nodes
+/* Notes:
+ * Unbounded lock-free LIFO stack (Treiber stack) for sharing work between threads without a mutex. Any number of
+ * threads may push and pop at the same time.
+ *
+ * Functions in the lock-free stack class:
+ * push - Adds a new element to the top of the stack (copies, or moves an rvalue). Never waits.
+ * emplace - Constructs a new element in place on top of the stack.
+ * try_pop - Removes the top element into out, returns false if the stack is empty.
+ * pop - Removes and returns the top element, waiting while the stack is empty.
+ * isEmpty - Checks if the stack is empty (snapshot).
+ * getEliminations - Number of push/pop pairs that met in the elimination array instead of on the head.
+ *
+ * How it works:
+ * The head is a single atomic pointer. push links a new node in front of it with a CAS, pop swings it to head->next
+ * with a CAS. pop reads head->next, so it first protects the head node with a hazard pointer (hazardpointers.h):
+ * a popped node is retired rather than deleted and only freed once no other thread can still be reading it.
+ * The same protection rules out ABA: the node a pending CAS expects cannot be freed and come back at the same
+ * address, so no tagged pointers or double-width CAS are needed.
+ *
+ * Elimination: under contention every thread is fighting over one cache line. A push whose CAS fails offers its node
+ * in a random slot of a small elimination array and waits briefly; a pop whose CAS fails checks a random slot and
+ * takes any node on offer. A push and a pop that meet there cancel out without touching the head at all, so
+ * throughput keeps growing with the number of threads instead of collapsing. Pass elimination = false to turn it off.
+ *
+ * Every push allocates a node with new. There is no size counter on purpose: a shared counter would be a second
+ * contended cache line on every operation.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class LockFreeStack {
+    public:
+        explicit LockFreeStack(bool elimination = true);
+        ~LockFreeStack();
+        LockFreeStack(const LockFreeStack&) = delete;        // Shared between threads, copying makes no sense
+        LockFreeStack& operator=(const LockFreeStack&) = delete;
+        void push(const T& value) { pushNode(new Node(value)); }            // Adds a new element to the top of the stack
+        void push(T&& value) { pushNode(new Node(std::move(value))); }      // Same, but moves the value in
+        template<typename... Args>
+        void emplace(Args&&... args) { pushNode(new Node(std::forward<Args>(args)...)); } // Constructs the element in place
+        bool try_pop(T& out);                                // Removes the top element into out, false if empty
+        T pop();                                             // Removes and returns the top element, waits while empty
+        [[nodiscard]] bool isEmpty() const { return head.load(std::memory_order_acquire) == nullptr; } // Snapshot
+        [[nodiscard]] size_t getEliminations() const { return eliminations.load(std::memory_order_relaxed); } // Pairs that met in the array
+
+    private:
+        static constexpr size_t cacheLineSize = 64;
+        static constexpr size_t eliminationWidth = 8;       // Slots in the elimination array
+        static constexpr unsigned eliminationWait = 64;     // How many times a push checks its offer before withdrawing it
+
+        struct Node {
+            T value;
+            Node* next;
+            template<typename... Args>
+            explicit Node(Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
+        };
+
+        // One elimination slot: empty, a node offered by a push, or taken (a pop owns the node, the push has not seen it yet)
+        struct alignas(cacheLineSize) Exchanger {
+            std::atomic<Node*> offer{nullptr};
+        };
+
+        alignas(cacheLineSize) std::atomic<Node*> head;     // Top of the stack
+        Exchanger exchangers[eliminationWidth];             // Elimination array, one cache line per slot
+        alignas(cacheLineSize) std::atomic<size_t> eliminations; // Only written on the elimination path
+        bool useElimination;
+
+        static Node* taken() { return reinterpret_cast<Node*>(alignof(Node)); } // Marker, never a real node address
+        void pushNode(Node* node);                          // Links a node in, via the head or the elimination array
+        bool offer(Node* node);                             // Offers a node to a pop, true if one took it
+        Node* take();                                       // Takes a node offered by a push, nullptr if none
+        static size_t randomSlot();                         // Per-thread xorshift, spreads threads over the array
+    };
+
+    /*
+     * Name: LockFreeStack constructor
+     * Description: Initializes an empty stack.
+     * Parameters: elimination - Whether contended pushes and pops meet in the elimination array (default is true).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    LockFreeStack<T>::LockFreeStack(bool elimination) : head(nullptr), eliminations(0), useElimination(elimination) {}
+
+    /*
+     * Name: LockFreeStack destructor
+     * Description: Deletes the remaining nodes. No thread may be using the stack anymore; nodes popped earlier are
+     *              owned by the hazard domain and freed there.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    LockFreeStack<T>::~LockFreeStack() {
+        Node* node = head.load(std::memory_order_relaxed);
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /*
+     * Name: LockFreeStack.try_pop
+     * Description: Removes the top element if there is one. Lock-free: a failed CAS means another thread made progress.
+     * Parameters: out - Receives the removed element (moved out).
+     * Returns: bool - True if an element was removed, false if the stack is empty.
+     */
+    template<typename T>
+    bool LockFreeStack<T>::try_pop(T& out) {
+        HazardDomain& domain = HazardDomain::instance();
+        while (true) {
+            Node* top = domain.protect(0, head);  // top cannot be freed until slot 0 is cleared
+            if (!top) {
+                if (Node* node = useElimination ? take() : nullptr) { // A push may be waiting in the array
+                    out = std::move(node->value);
+                    delete node;
+                    return true;
+                }
+                return false;
+            }
+            Node* next = top->next;                // Safe to read, top is protected
+            if (head.compare_exchange_strong(top, next, std::memory_order_acquire, std::memory_order_relaxed)) {
+                domain.clear(0);
+                out = std::move(top->value);       // Other threads may still read top->next, never top->value
+                domain.retire(top);
+                return true;
+            }
+            if (Node* node = useElimination ? take() : nullptr) {
+                domain.clear(0);
+                out = std::move(node->value);
+                delete node;                       // Offered nodes were never on the stack, nobody else can see them
+                return true;
+            }
+        }
+    }
+
+    /*
+     * Name: LockFreeStack.pop
+     * Description: Removes and returns the top element, spinning and then yielding while the stack is empty.
+     * Parameters: None
+     * Returns: T - The removed element.
+     */
+    template<typename T>
+    T LockFreeStack<T>::pop() {
+        T value{};
+        unsigned attempt = 0;
+        while (!try_pop(value)) {
+            if (++attempt > 64) {
+                std::this_thread::yield();
+            }
+        }
+        return value;
+    }
+
+    /*
+     * Name: LockFreeStack.pushNode
+     * Description: Links a node in front of the head with a CAS. When the CAS fails and elimination is on, the node is
+     *              offered to a pop through the elimination array first, then the CAS is retried.
+     * Parameters: node - The new node, owned by the stack from here on.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void LockFreeStack<T>::pushNode(Node* node) {
+        Node* expected = head.load(std::memory_order_relaxed);
+        while (true) {
+            node->next = expected;
+            if (head.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+            if (useElimination && offer(node)) {
+                return;
+            }
+            expected = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    /*
+     * Name: LockFreeStack.offer
+     * Description: Puts the node in a random empty elimination slot and waits a little for a pop to take it. A pop
+     *              marks the slot taken, which keeps the slot from being reused until this push has seen it.
+     * Parameters: node - The node to hand over.
+     * Returns: bool - True if a pop took the node, false if nobody came (the node is still ours).
+     */
+    template<typename T>
+    bool LockFreeStack<T>::offer(Node* node) {
+        Exchanger& slot = exchangers[randomSlot()];
+        Node* empty = nullptr;
+        if (!slot.offer.compare_exchange_strong(empty, node, std::memory_order_release, std::memory_order_relaxed)) {
+            return false; // Slot busy, go back to the head
+        }
+        for (unsigned attempt = 0; attempt < eliminationWait; attempt++) {
+            if (slot.offer.load(std::memory_order_acquire) == taken()) {
+                break;
+            }
+            if (attempt > 16) {
+                std::this_thread::yield();
+            }
+        }
+        Node* expected = node;
+        if (slot.offer.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed)) {
+            return false; // Withdrawn, nobody took it
+        }
+        slot.offer.store(nullptr, std::memory_order_release); // It was taken, free the slot for the next offer
+        eliminations.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /*
+     * Name: LockFreeStack.take
+     * Description: Looks at one random elimination slot and takes the node if one is on offer.
+     * Parameters: None
+     * Returns: Node* - The node, now owned by the caller, or nullptr.
+     */
+    template<typename T>
+    typename LockFreeStack<T>::Node* LockFreeStack<T>::take() {
+        Exchanger& slot = exchangers[randomSlot()];
+        Node* node = slot.offer.load(std::memory_order_relaxed);
+        if (node && node != taken() &&
+            slot.offer.compare_exchange_strong(node, taken(), std::memory_order_acquire, std::memory_order_relaxed)) {
+            return node;
+        }
+        return nullptr;
+    }
+
+    /*
+     * Name: LockFreeStack.randomSlot
+     * Description: Picks an elimination slot with a per-thread xorshift generator.
+     * Parameters: None
+     * Returns: size_t - A slot index.
+     */
+    template<typename T>
+    size_t LockFreeStack<T>::randomSlot() {
+        thread_local uint32_t state = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % eliminationWidth;
+    }
+
+}
+
+#endif //LOCKFREESTACK_H
@@ -0,0 +1,237 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef MIRROREDRINGBUFFER_H
+#define MIRROREDRINGBUFFER_H
+
+#include <cerrno>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <sys/mman.h>
+#include <unistd.h>
+/* Notes:
+ * Ring buffer for bytes / POD records whose storage is mapped twice, back to back, in virtual memory.
+ * Slot i and slot i + capacity are the same physical memory, so any window of up to capacity elements starting anywhere
+ * in the buffer is one contiguous pointer range. A record that wraps around the end can be read or written in place,
+ * no scratch copy and no two-segment handling.
+ *
+ * Functions in the mirrored ring buffer class:
+ * push - Adds a new element to the buffer, overwriting the oldest element if the buffer is full (overwrite mode).
+ * pop - Removes and returns the oldest element from the buffer.
+ * front - Returns the oldest element without removing it.
+ * back - Returns the most recently added element without removing it.
+ * getSize - Returns the number of elements currently in the buffer.
+ * isFull - Checks if the buffer is full.
+ * isEmpty - Checks if the buffer is empty.
+ * clear - Clears the buffer, removing all elements.
+ * isOverwriteOnly - Checks if the buffer is in overwrite-only mode.
+ * capacity - Returns the maximum number of elements the buffer can hold.
+ * read_ptr - Pointer to the oldest element, getSize() elements can be read from it contiguously.
+ * write_ptr - Pointer to the first free slot, writable() elements can be written to it contiguously.
+ * writable - Returns the number of free slots.
+ * commit - Makes n elements written through write_ptr part of the buffer.
+ * consume - Removes the oldest n elements after reading them through read_ptr.
+ *
+ * How it works (Linux):
+ * memfd_create makes an anonymous file of capacity * sizeof(T) bytes, 2 * that much address space is reserved and the file
+ * is mapped into both halves. The byte size has to be a multiple of the page size (and of sizeof(T)), so the capacity
+ * passed to the constructor is rounded up to the next such size. Like RingBuffer this class is not thread-safe.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class MirroredRingBuffer {
+        static_assert(std::is_trivially_copyable_v<T>, "MirroredRingBuffer requires a trivially copyable type");
+    public:
+        explicit MirroredRingBuffer(size_t capacity, bool overwrite = false);
+        ~MirroredRingBuffer();
+        MirroredRingBuffer(const MirroredRingBuffer&) = delete;            // Owns the mapping, cannot be copied
+        MirroredRingBuffer& operator=(const MirroredRingBuffer&) = delete;
+        void push(const T& value);                       // Adds a new element to the buffer, overwriting the oldest if full
+        T pop();                                         // Removes and returns the oldest element from the buffer
+        T& front() const;                                // Returns the oldest element without removing it
+        T& back() const;                                 // Returns the most recently added element without removing it
+        [[nodiscard]] int getSize() const { return static_cast<int>(count); }    // Returns the number of elements currently in the buffer
+        [[nodiscard]] bool isFull() const { return count >= maxCapacity; }        // Checks if the buffer is full
+        [[nodiscard]] bool isEmpty() const { return count == 0; }                 // Checks if the buffer is empty
+        void clear() { head = 0; count = 0; }                                     // Clears the buffer, removing all elements
+        [[nodiscard]] bool isOverwriteOnly() const { return overwriteOnly; }      // Checks if the buffer is in overwrite-only mode
+        [[nodiscard]] size_t capacity() const { return maxCapacity; }             // Returns the maximum number of elements (after rounding)
+        T* read_ptr() const { return base + head; }                               // Oldest element, getSize() elements are contiguous from here
+        T* write_ptr() const { return base + head + count; }                      // First free slot, writable() elements are contiguous from here
+        [[nodiscard]] size_t writable() const { return maxCapacity - count; }     // Number of free slots
+        void commit(size_t n);                                                    // Adds the n elements written through write_ptr()
+        void consume(size_t n);                                                   // Removes the oldest n elements
+
+        // The data is always contiguous, so plain pointers are the iterators
+        T* begin() const { return read_ptr(); }
+        T* end() const { return write_ptr(); }
+
+    private:
+        T* base;                 // Start of the first mapping, the second mapping starts at base + maxCapacity
+        size_t maxCapacity;      // Number of elements in one mapping
+        size_t mappedBytes;      // Size of one mapping in bytes
+        size_t head;             // Index of the oldest element, always < maxCapacity
+        size_t count;            // Number of elements currently in the buffer
+        bool overwriteOnly;      // Flag to indicate if the buffer is in overwrite-only mode default is false
+    };
+
+    /*
+     * Name: MirroredRingBuffer constructor
+     * Description: Creates the backing memory and maps it twice, back to back.
+     * Parameters: capacity - The minimum number of elements the buffer can hold (rounded up to whole pages).
+     *             overwrite - A flag indicating if the buffer should overwrite the oldest element when full (default is false).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    MirroredRingBuffer<T>::MirroredRingBuffer(size_t capacity, bool overwrite)
+        : base(nullptr), maxCapacity(0), mappedBytes(0), head(0), count(0), overwriteOnly(overwrite) {
+        if (capacity == 0) {
+            throw std::invalid_argument("MirroredRingBuffer capacity must be greater than zero");
+        }
+        // The mapping size must be a whole number of pages and a whole number of elements
+        const size_t granularity = std::lcm(static_cast<size_t>(sysconf(_SC_PAGESIZE)), sizeof(T));
+        mappedBytes = (capacity * sizeof(T) + granularity - 1) / granularity * granularity;
+        maxCapacity = mappedBytes / sizeof(T);
+
+        int fd = memfd_create("commanda_mirrored_ring", MFD_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "MirroredRingBuffer memfd_create");
+        }
+        if (ftruncate(fd, static_cast<off_t>(mappedBytes)) != 0) {
+            int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "MirroredRingBuffer ftruncate");
+        }
+        // Reserve both halves first so nothing else can land in the second half between the two mmap calls
+        void* reserved = mmap(nullptr, 2 * mappedBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED) {
+            int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "MirroredRingBuffer mmap reserve");
+        }
+        auto* first = static_cast<unsigned char*>(reserved);
+        if (mmap(first, mappedBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+            mmap(first + mappedBytes, mappedBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            int error = errno;
+            munmap(reserved, 2 * mappedBytes);
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "MirroredRingBuffer mmap mirror");
+        }
+        close(fd); // The mappings keep the memory alive
+        base = reinterpret_cast<T*>(first);
+    }
+
+    /*
+     * Name: MirroredRingBuffer destructor
+     * Description: Unmaps both halves, which frees the backing memory.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    MirroredRingBuffer<T>::~MirroredRingBuffer() {
+        munmap(base, 2 * mappedBytes);
+    }
+
+    /*
+     * Name: MirroredRingBuffer.push
+     * Description: Adds a new element to the buffer, overwriting the oldest element if the buffer is full.
+     * Parameters: value - The value to be added to the buffer.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void MirroredRingBuffer<T>::push(const T& value) {
+        if (isFull()) {
+            if (!overwriteOnly) {
+                throw std::runtime_error("MirroredRingBuffer is full and not in overwrite-only mode");
+            }
+            consume(1); // Drop the oldest, its slot is the one written below
+        }
+        base[head + count] = value; // May land in the mirror half, which is the same memory as the start
+        count++;
+    }
+
+    /*
+     * Name: MirroredRingBuffer.pop
+     * Description: Removes and returns the oldest element from the buffer.
+     * Parameters: None
+     * Returns: T - The value of the removed element.
+     */
+    template<typename T>
+    T MirroredRingBuffer<T>::pop() {
+        if (isEmpty()) {
+            throw std::out_of_range("MirroredRingBuffer is empty");
+        }
+        T value = base[head];
+        consume(1);
+        return value;
+    }
+
+    /*
+     * Name: MirroredRingBuffer.front
+     * Description: Returns the oldest element without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the oldest element.
+     */
+    template<typename T>
+    T& MirroredRingBuffer<T>::front() const {
+        if (isEmpty()) {
+            throw std::out_of_range("MirroredRingBuffer is empty");
+        }
+        return base[head];
+    }
+
+    /*
+     * Name: MirroredRingBuffer.back
+     * Description: Returns the most recently added element without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the most recently added element.
+     */
+    template<typename T>
+    T& MirroredRingBuffer<T>::back() const {
+        if (isEmpty()) {
+            throw std::out_of_range("MirroredRingBuffer is empty");
+        }
+        return base[head + count - 1];
+    }
+
+    /*
+     * Name: MirroredRingBuffer.commit
+     * Description: Adds n elements that were written in place through write_ptr().
+     * Parameters: n - The number of elements written (at most writable()).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void MirroredRingBuffer<T>::commit(size_t n) {
+        if (n > writable()) {
+            throw std::out_of_range("MirroredRingBuffer cannot commit more elements than there are free slots");
+        }
+        count += n;
+    }
+
+    /*
+     * Name: MirroredRingBuffer.consume
+     * Description: Removes the oldest n elements, meant to commit a read done through read_ptr().
+     * Parameters: n - The number of elements to remove (at most getSize()).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void MirroredRingBuffer<T>::consume(size_t n) {
+        if (n > count) {
+            throw std::out_of_range("MirroredRingBuffer cannot consume more elements than it holds");
+        }
+        head += n;
+        if (head >= maxCapacity) {
+            head -= maxCapacity; // Jump back from the mirror half, same memory
+        }
+        count -= n;
+    }
+
+}
+
+#endif //MIRROREDRINGBUFFER_H
@@ -0,0 +1,279 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+/* Notes:
+ * Bounded multi-producer / multi-consumer FIFO queue. Any number of threads may push and pop at the same time.
+ * All memory is allocated in the constructor, push/pop never allocate.
+ *
+ * Functions in the MPMC queue class:
+ * try_push - Adds a new element to the end of the queue, returns false if the queue is full.
+ * try_pop - Removes the front element into out, returns false if the queue is empty.
+ * push - Adds a new element to the end of the queue, waiting while the queue is full.
+ * pop - Removes and returns the front element of the queue, waiting while the queue is empty.
+ * getSize - Returns the number of elements in the queue (snapshot).
+ * isEmpty - Checks if the queue is empty (snapshot).
+ * capacity - Returns the maximum number of elements the queue can hold.
+ *
+ * How it works (Dmitry Vyukov's bounded queue):
+ * Every slot carries a sequence number next to the element. enqueuePos and dequeuePos are free-running counters.
+ * A slot whose sequence equals the producer's position is free for that lap, a producer claims the position with a CAS on
+ * enqueuePos, writes the element and then publishes it by setting sequence = position + 1.
+ * A consumer at position p waits for sequence == p + 1, claims p with a CAS on dequeuePos, takes the element and sets
+ * sequence = p + capacity, which is exactly the value the producer of the next lap is waiting for.
+ * Producers only contend with producers and consumers only with consumers, and each slot is touched by one thread at a time.
+ *
+ * Exceptions:
+ * A producer owns its position before it constructs the element, so a throwing copy constructor cannot just give the
+ * position back. The producer publishes the slot anyway with hasValue = false, consumers that claim such a slot free it
+ * for the next lap and move on to the next position, and the exception is rethrown from try_push.
+ * If moving the element into try_pop's out throws, the element is destroyed and its slot freed before the exception is
+ * rethrown, so a throwing T loses that one element but never wedges the queue. pop() move-constructs its result straight
+ * from the slot, so T does not need to be default constructible.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class MpmcQueue {
+    public:
+        explicit MpmcQueue(size_t capacity);
+        ~MpmcQueue();
+        MpmcQueue(const MpmcQueue&) = delete;            // Shared between threads, copying makes no sense
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+        bool try_push(const T& value);                   // Adds a new element to the end of the queue, false if full
+        bool try_pop(T& out);                            // Removes the front element into out, false if empty
+        void push(const T& value);                       // Adds a new element, waits while the queue is full
+        T pop();                                         // Removes and returns the front element, waits while the queue is empty
+        [[nodiscard]] size_t getSize() const;            // Returns the number of elements in the queue (snapshot)
+        [[nodiscard]] bool isEmpty() const { return getSize() == 0; } // Checks if the queue is empty (snapshot)
+        [[nodiscard]] size_t capacity() const { return maxCapacity; }  // Maximum number of elements (rounded up to a power of two)
+
+    private:
+        static constexpr size_t cacheLineSize = 64;
+
+        struct Slot {
+            std::atomic<size_t> sequence;                 // Which lap / state the slot is in (see notes above)
+            bool hasValue;                                // False if the producer's constructor threw, written before sequence is published
+            alignas(T) unsigned char storage[sizeof(T)];  // Raw storage, the element only exists while the slot is full
+            T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        alignas(cacheLineSize) Slot* slots;               // Slot array, read-only pointer after construction
+        size_t maxCapacity;                               // Number of slots (power of two)
+        size_t mask;                                      // maxCapacity - 1
+        alignas(cacheLineSize) std::atomic<size_t> enqueuePos; // Next position producers claim
+        alignas(cacheLineSize) std::atomic<size_t> dequeuePos; // Next position consumers claim
+
+        template<typename Take>
+        bool tryTake(Take&& take);                        // Shared body of try_pop and pop, hands the front element to take
+
+        // Spins a little, then starts yielding the core, used by the blocking push/pop
+        static void backoff(unsigned& attempt) {
+            if (++attempt > 64) {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    /*
+     * Name: MpmcQueue constructor
+     * Description: Initializes an empty queue and allocates all slots. The capacity is rounded up to the next power of two.
+     * Parameters: capacity - The minimum number of elements the queue can hold (at least 2).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    MpmcQueue<T>::MpmcQueue(size_t capacity) : slots(nullptr), maxCapacity(0), mask(0), enqueuePos(0), dequeuePos(0) {
+        if (capacity < 2) {
+            throw std::invalid_argument("MpmcQueue capacity must be at least 2");
+        }
+        maxCapacity = std::bit_ceil(capacity);
+        mask = maxCapacity - 1;
+        slots = std::allocator<Slot>().allocate(maxCapacity);
+        for (size_t i = 0; i < maxCapacity; i++) {
+            std::construct_at(&slots[i].sequence, i); // Slot i is free for position i (lap 0)
+            slots[i].hasValue = false;
+        }
+    }
+
+    /*
+     * Name: MpmcQueue destructor
+     * Description: Destroys the remaining elements and frees the slots. No thread may be using the queue anymore.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    MpmcQueue<T>::~MpmcQueue() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            const size_t end = enqueuePos.load(std::memory_order_relaxed);
+            for (size_t position = dequeuePos.load(std::memory_order_relaxed); position != end; position++) {
+                Slot& slot = slots[position & mask];
+                if (slot.hasValue) {
+                    std::destroy_at(slot.value());
+                }
+            }
+        }
+        for (size_t i = 0; i < maxCapacity; i++) {
+            std::destroy_at(&slots[i].sequence);
+        }
+        std::allocator<Slot>().deallocate(slots, maxCapacity);
+    }
+
+    /*
+     * Name: MpmcQueue.try_push
+     * Description: Adds a new element to the end of the queue if there is room. Lock-free.
+     *              If copying the value throws, the claimed slot is published empty and the exception is rethrown.
+     * Parameters: value - The value to be added to the queue.
+     * Returns: bool - True if the value was added, false if the queue is full.
+     */
+    template<typename T>
+    bool MpmcQueue<T>::try_push(const T& value) {
+        size_t position = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[position & mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                // The slot is free for this lap, try to claim the position
+                if (enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    try {
+                        std::construct_at(slot.value(), value);
+                    } catch (...) {
+                        // The position is ours and consumers will wait for it, so publish it empty for them to skip
+                        slot.hasValue = false;
+                        slot.sequence.store(position + 1, std::memory_order_release);
+                        throw;
+                    }
+                    slot.hasValue = true;
+                    slot.sequence.store(position + 1, std::memory_order_release); // Publish to consumers
+                    return true;
+                }
+                // Another producer won, position was reloaded by the CAS
+            } else if (difference < 0) {
+                return false; // The slot still holds last lap's element: the queue is full
+            } else {
+                position = enqueuePos.load(std::memory_order_relaxed); // Fell behind other producers, catch up
+            }
+        }
+    }
+
+    /*
+     * Name: MpmcQueue.try_pop
+     * Description: Removes the front element of the queue if there is one. Lock-free.
+     * Parameters: out - Receives the removed element.
+     * Returns: bool - True if an element was removed, false if the queue is empty.
+     */
+    template<typename T>
+    bool MpmcQueue<T>::try_pop(T& out) {
+        return tryTake([&out](T& element) { out = std::move(element); });
+    }
+
+    /*
+     * Name: MpmcQueue.tryTake
+     * Description: Claims the front position, hands its element to take and frees the slot for the next lap. Slots whose
+     *              producer threw are freed and skipped. The element is destroyed and the slot freed even if take throws.
+     * Parameters: take - Called with the front element (T&), moves it wherever the caller wants it.
+     * Returns: bool - True if an element was taken, false if the queue is empty.
+     */
+    template<typename T>
+    template<typename Take>
+    bool MpmcQueue<T>::tryTake(Take&& take) {
+        size_t position = dequeuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[position & mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0) {
+                // The slot holds this lap's element, try to claim the position
+                if (dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    if (!slot.hasValue) {
+                        // The producer's constructor threw, free the slot and try the next position
+                        slot.sequence.store(position + maxCapacity, std::memory_order_release);
+                        position = dequeuePos.load(std::memory_order_relaxed);
+                        continue;
+                    }
+                    T* element = slot.value();
+                    try {
+                        take(*element);
+                    } catch (...) {
+                        std::destroy_at(element);
+                        slot.hasValue = false;
+                        slot.sequence.store(position + maxCapacity, std::memory_order_release);
+                        throw;
+                    }
+                    std::destroy_at(element);
+                    slot.hasValue = false;
+                    slot.sequence.store(position + maxCapacity, std::memory_order_release); // Free for the next lap
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false; // Nothing has been published here yet: the queue is empty
+            } else {
+                position = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /*
+     * Name: MpmcQueue.push
+     * Description: Adds a new element to the end of the queue, spinning and then yielding while the queue is full.
+     * Parameters: value - The value to be added to the queue.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void MpmcQueue<T>::push(const T& value) {
+        unsigned attempt = 0;
+        while (!try_push(value)) {
+            backoff(attempt);
+        }
+    }
+
+    /*
+     * Name: MpmcQueue.pop
+     * Description: Removes and returns the front element of the queue, spinning and then yielding while the queue is empty.
+     *              The result is move-constructed from the slot, so T does not need a default constructor.
+     * Parameters: None
+     * Returns: T - The value of the removed element.
+     */
+    template<typename T>
+    T MpmcQueue<T>::pop() {
+        std::optional<T> value;
+        unsigned attempt = 0;
+        while (!tryTake([&value](T& element) { value.emplace(std::move(element)); })) {
+            backoff(attempt);
+        }
+        return std::move(*value);
+    }
+
+    /*
+     * Name: MpmcQueue.getSize
+     * Description: Returns the number of elements in the queue. Only a snapshot while other threads are active, and it also
+     *              counts slots a throwing producer published empty until a consumer skips them.
+     * Parameters: None
+     * Returns: size_t - The number of elements in the queue.
+     */
+    template<typename T>
+    size_t MpmcQueue<T>::getSize() const {
+        const size_t dequeued = dequeuePos.load(std::memory_order_acquire);
+        const size_t enqueued = enqueuePos.load(std::memory_order_acquire);
+        if (enqueued <= dequeued) {
+            return 0;
+        }
+        return enqueued - dequeued > maxCapacity ? maxCapacity : enqueued - dequeued;
+    }
+
+}
+
+#endif //MPMCQUEUE_H
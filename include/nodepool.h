@@ -0,0 +1,356 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+/* Notes:
+ * Fixed-size node allocator, the default allocator of LinkedList / DoubleLinkedList (and so of Queue, Stack and Deque).
+ * Nodes are carved out of slabs and recycled through a free list, so once the pool has grown to the list's
+ * high-water mark, insert / remove never call malloc or free again.
+ *
+ * Slabs:
+ * The first slab is small (about firstSlabBytes), because every list owns a pool and most lists stay short. Each new slab
+ * is as large as everything reserved so far, so the pool doubles like ConcurrentNodePool, until a slab reaches
+ * maxSlabBytes. Slabs are freed when the pool is destroyed, or earlier by shrink() once all of their nodes are free.
+ *
+ * Functions in the node pool class:
+ * allocate - Returns raw memory for one node (std::allocator style, n must be 1).
+ * deallocate - Puts a node's memory back on the free list.
+ * reserve - Carves a slab up front so the first nodes do not allocate either.
+ * shrink - Frees the slabs whose nodes are all free again.
+ * inUse - Returns the number of nodes currently handed out.
+ * highWater - Returns the largest number of nodes that were handed out at the same time.
+ * reserved - Returns the number of nodes the current slabs can hold.
+ * slabCount - Returns the number of slabs currently allocated.
+ *
+ * Allocator interface:
+ * The lists take the allocator as a template template parameter, LinkedList<T, Allocator> uses Allocator<SingleNode<T>>.
+ * Anything with value_type, allocate(n) and deallocate(p, n) works, e.g. LinkedList<T, std::allocator> gives the old
+ * new / delete per node behavior. Every list owns its own allocator object, so a pool is never shared between lists
+ * (or threads). Moving a pool hands its slabs over without touching the nodes, which is what makes moving a list O(1);
+ * the moved-from pool is empty and reusable.
+ * An allocator that declares static constexpr bool releasesInBulk = true (ArenaAllocator) promises that deallocate() is a
+ * no-op, which lets the lists skip the per-node walk in clear() when there are no destructors to run.
+ *
+ * NodePoolRef:
+ * Allocator that forwards to a NodePool owned by someone else, e.g. DoubleLinkedList<T, NodePoolRef> built from a
+ * NodePool<DoubleNode<T>>&. Lists sharing one pool can hand nodes to each other with DoubleLinkedList::splice (the
+ * timing wheel's buckets do this). The pool must outlive the lists, and like NodePool it is not thread safe.
+ */
+
+namespace CommandaStructures {
+
+    // True for allocators whose memory is released all at once (see the notes above)
+    template<typename Alloc>
+    inline constexpr bool allocatorReleasesInBulk = requires { requires Alloc::releasesInBulk; };
+
+    template<typename Node>
+    class NodePool {
+    public:
+        using value_type = Node;
+
+        explicit NodePool(size_t firstSlabNodes = 0);    // 0 picks a first slab of about firstSlabBytes
+        ~NodePool();
+        NodePool(const NodePool&) = delete;              // Owns the slabs, cannot be copied
+        NodePool& operator=(const NodePool&) = delete;
+        NodePool(NodePool&& other) noexcept;             // Takes over the slabs, the nodes in them stay where they are
+        NodePool& operator=(NodePool&& other) noexcept;  // Frees this pool's slabs (its nodes must be gone) and takes over other's
+        Node* allocate(size_t n = 1);                    // Raw memory for one node, the caller constructs it
+        void deallocate(Node* node, size_t n = 1);       // Returns a node (already destroyed) to the free list
+        void reserve(size_t nodes);                      // Makes sure nodes can be handed out without allocating
+        size_t shrink();                                 // Frees every slab none of whose nodes is handed out, returns the nodes released
+        [[nodiscard]] size_t inUse() const { return used; }              // Nodes currently handed out
+        [[nodiscard]] size_t highWater() const { return peak; }          // Most nodes handed out at the same time
+        [[nodiscard]] size_t reserved() const { return capacity; }       // Nodes the slabs can hold
+        [[nodiscard]] size_t slabCount() const { return slabs.size(); } // Number of slabs currently allocated
+
+        static constexpr size_t firstSlabBytes = 512;       // Default size of the first slab, a list with a few nodes stays small
+        static constexpr size_t maxSlabBytes = 64 * 1024;   // Growth stops doubling here, so shrink() still finds whole free slabs
+
+    private:
+        // A free slot holds the free-list link, a used slot holds the node
+        union Slot {
+            Slot* nextFree;
+            alignas(Node) unsigned char storage[sizeof(Node)];
+        };
+
+        struct Slab {
+            Slot* slots;          // Start of the slab
+            size_t size;          // Number of slots in the slab
+        };
+
+        std::vector<Slab> slabs;  // Every slab currently allocated, in allocation order
+        Slot* freeList;           // Recycled slots, most recently freed first (still warm in cache)
+        Slot* carveNext;          // Next never-used slot in the newest slab
+        Slot* carveEnd;           // End of the newest slab
+        size_t firstSlabSize;     // Nodes in the first slab, later slabs grow from it
+        size_t capacity;          // Total nodes the slabs hold
+        size_t used;              // Nodes currently handed out
+        size_t peak;              // High-water mark of used
+
+        void addSlab(size_t atLeast);
+        void releaseSlabs();
+    };
+
+    /*
+     * Name: NodePool constructor
+     * Description: Initializes an empty pool. No memory is allocated until the first node is needed (or reserve() is called).
+     * Parameters: firstSlabNodes - How many nodes the first slab holds. The default (0) fits the first slab in about
+     *                              firstSlabBytes, so small nodes get more per slab than large ones.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    NodePool<Node>::NodePool(size_t firstSlabNodes)
+        : freeList(nullptr), carveNext(nullptr), carveEnd(nullptr), firstSlabSize(firstSlabNodes), capacity(0), used(0), peak(0) {
+        if (firstSlabSize == 0) {
+            firstSlabSize = std::max<size_t>(4, firstSlabBytes / sizeof(Slot));
+        }
+    }
+
+    /*
+     * Name: NodePool destructor
+     * Description: Frees every slab. The owning list has already destroyed its nodes.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    NodePool<Node>::~NodePool() {
+        releaseSlabs();
+    }
+
+    /*
+     * Name: NodePool move constructor
+     * Description: Takes over another pool's slabs and free list. Nodes handed out by other are now owned by this pool.
+     * Parameters: other - The pool to take over, left empty.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    NodePool<Node>::NodePool(NodePool&& other) noexcept
+        : slabs(std::move(other.slabs)), freeList(other.freeList), carveNext(other.carveNext), carveEnd(other.carveEnd),
+          firstSlabSize(other.firstSlabSize), capacity(other.capacity), used(other.used), peak(other.peak) {
+        other.slabs.clear();
+        other.freeList = nullptr;
+        other.carveNext = nullptr;
+        other.carveEnd = nullptr;
+        other.capacity = 0;
+        other.used = 0;
+        other.peak = 0;
+    }
+
+    /*
+     * Name: NodePool move assignment
+     * Description: Frees this pool's slabs and takes over other's. Every node from this pool must already be destroyed.
+     * Parameters: other - The pool to take over, left empty.
+     * Returns: NodePool& - This pool.
+     */
+    template<typename Node>
+    NodePool<Node>& NodePool<Node>::operator=(NodePool&& other) noexcept {
+        if (this != &other) {
+            releaseSlabs();
+            slabs = std::move(other.slabs);
+            other.slabs.clear();
+            freeList = std::exchange(other.freeList, nullptr);
+            carveNext = std::exchange(other.carveNext, nullptr);
+            carveEnd = std::exchange(other.carveEnd, nullptr);
+            firstSlabSize = other.firstSlabSize;
+            capacity = std::exchange(other.capacity, 0);
+            used = std::exchange(other.used, 0);
+            peak = std::exchange(other.peak, 0);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: NodePool.allocate
+     * Description: Hands out memory for one node, from the free list if possible, else from the newest slab.
+     * Parameters: n - Number of nodes, must be 1 (the pool only deals in single nodes).
+     * Returns: Node* - Uninitialized memory for one node.
+     */
+    template<typename Node>
+    Node* NodePool<Node>::allocate(size_t n) {
+        if (n != 1) {
+            throw std::bad_alloc();
+        }
+        Slot* slot;
+        if (freeList) {
+            slot = freeList;
+            freeList = freeList->nextFree;
+        } else {
+            if (carveNext == carveEnd) {
+                addSlab(1);
+            }
+            slot = carveNext++;
+        }
+        if (++used > peak) {
+            peak = used;
+        }
+        return reinterpret_cast<Node*>(slot->storage);
+    }
+
+    /*
+     * Name: NodePool.deallocate
+     * Description: Puts a node's memory back on the free list, the slab itself stays allocated until shrink().
+     * Parameters: node - The node to return (its destructor has already run).
+     *             n - Number of nodes, must be 1.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void NodePool<Node>::deallocate(Node* node, size_t n) {
+        if (!node) return;
+        (void)n;
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+        used--;
+    }
+
+    /*
+     * Name: NodePool.reserve
+     * Description: Makes sure at least nodes more nodes can be handed out without allocating, with at most one new slab.
+     * Parameters: nodes - How many nodes should be available.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void NodePool<Node>::reserve(size_t nodes) {
+        if (capacity - used < nodes) {
+            addSlab(nodes - (capacity - used));
+        }
+    }
+
+    /*
+     * Name: NodePool.shrink
+     * Description: Frees every slab whose nodes are all back on the free list, e.g. after a burst has drained.
+     *              Walks the free list once and sorts the slab table, so it belongs in idle time, not in a hot loop.
+     *              The next slab grows from what is left, so a pool that shrank and refills doubles again from there.
+     * Parameters: None
+     * Returns: size_t - The number of nodes the freed slabs held.
+     */
+    template<typename Node>
+    size_t NodePool<Node>::shrink() {
+        if (slabs.empty() || used == capacity) {
+            return 0;
+        }
+        // Never-carved slots of the newest slab are free too, put them on the list so one count covers everything
+        while (carveNext != carveEnd) {
+            Slot* slot = carveNext++;
+            slot->nextFree = freeList;
+            freeList = slot;
+        }
+        carveNext = nullptr;
+        carveEnd = nullptr;
+        // Count the free slots of each slab, found by address in the sorted slab table
+        std::sort(slabs.begin(), slabs.end(), [](const Slab& a, const Slab& b) { return std::less<Slot*>()(a.slots, b.slots); });
+        std::vector<size_t> freeCount(slabs.size(), 0);
+        auto owner = [this](Slot* slot) {
+            auto it = std::upper_bound(slabs.begin(), slabs.end(), slot,
+                                       [](Slot* s, const Slab& slab) { return std::less<Slot*>()(s, slab.slots); });
+            return static_cast<size_t>(it - slabs.begin()) - 1;
+        };
+        for (Slot* slot = freeList; slot; slot = slot->nextFree) {
+            freeCount[owner(slot)]++;
+        }
+        // Unlink the slots of fully free slabs from the free list, keeping the order of the rest
+        Slot** link = &freeList;
+        while (*link) {
+            if (freeCount[owner(*link)] == slabs[owner(*link)].size) {
+                *link = (*link)->nextFree;
+            } else {
+                link = &(*link)->nextFree;
+            }
+        }
+        size_t released = 0;
+        size_t kept = 0;
+        for (size_t k = 0; k < slabs.size(); k++) {
+            if (freeCount[k] == slabs[k].size) {
+                std::allocator<Slot>().deallocate(slabs[k].slots, slabs[k].size);
+                released += slabs[k].size;
+            } else {
+                slabs[kept++] = slabs[k];
+            }
+        }
+        slabs.resize(kept);
+        capacity -= released;
+        return released;
+    }
+
+    /*
+     * Name: NodePool.addSlab
+     * Description: Allocates a new slab and makes it the one nodes are carved from. Each slab is as large as everything
+     *              reserved so far (so the pool doubles, like ConcurrentNodePool), between firstSlabSize and maxSlabBytes,
+     *              and at least atLeast nodes. Slots the previous slab never handed out go onto the free list, so
+     *              reserved() stays exact.
+     * Parameters: atLeast - The minimum number of nodes the new slab must hold.
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void NodePool<Node>::addSlab(size_t atLeast) {
+        if (slabs.size() == slabs.capacity()) {
+            slabs.reserve(slabs.size() * 2 + 4); // Grow the bookkeeping first so push_back below cannot throw and leak the slab
+        }
+        const size_t maxSlabSize = std::max(firstSlabSize, maxSlabBytes / sizeof(Slot));
+        const size_t size = std::max(atLeast, std::clamp(capacity, firstSlabSize, maxSlabSize));
+        Slot* slab = std::allocator<Slot>().allocate(size);
+        while (carveNext != carveEnd) {
+            Slot* slot = carveNext++;
+            slot->nextFree = freeList;
+            freeList = slot;
+        }
+        slabs.push_back({slab, size});
+        capacity += size;
+        carveNext = slab;
+        carveEnd = slab + size;
+    }
+
+    /*
+     * Name: NodePool.releaseSlabs
+     * Description: Frees every slab, used by the destructor and move assignment.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Node>
+    void NodePool<Node>::releaseSlabs() {
+        for (const Slab& slab : slabs) {
+            std::allocator<Slot>().deallocate(slab.slots, slab.size);
+        }
+        slabs.clear();
+        capacity = 0;
+    }
+
+    template<typename Node>
+    class NodePoolRef {
+    public:
+        using value_type = Node;
+
+        NodePoolRef(NodePool<Node>& pool) : pool(&pool) {}  // Implicit, so a list can be constructed straight from a pool
+        NodePoolRef() : pool(nullptr) {}                    // Unbound, allocate() throws until a bound allocator is assigned
+        Node* allocate(size_t n = 1) {
+            if (!pool) {
+                throw std::logic_error("NodePoolRef is not bound to a pool");
+            }
+            return pool->allocate(n);
+        }
+        void deallocate(Node* node, size_t n = 1) {
+            if (pool) {
+                pool->deallocate(node, n); // An unbound allocator never handed out a node, so there is nothing to return
+            }
+        }
+        [[nodiscard]] NodePool<Node>* getPool() const { return pool; }
+        bool operator==(const NodePoolRef& other) const { return pool == other.pool; } // Same pool, nodes can move between lists
+
+    private:
+        NodePool<Node>* pool;
+    };
+
+}
+
+#endif //NODEPOOL_H
@@ -4,6 +4,10 @@
 
 #ifndef NODE_H
 #define NODE_H
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
 
 namespace CommandaStructures::Single {
     /* Linked List Node Class */
@@ -31,7 +35,11 @@ namespace CommandaStructures::Single {
         T data;
         SingleNode<T>* next;
         explicit SingleNode(const T& value);
+        explicit SingleNode(T&& value);                // Moves the value in instead of copying it
+        template<typename... Args>
+        explicit SingleNode(std::in_place_t, Args&&... args); // Constructs the value in place from args
         T& getData() { return data; } // Getter for data
+        const T& getData() const { return data; } // Same, for const nodes (findNode / contains on a const list)
     };
 
     /*
@@ -43,6 +51,25 @@ namespace CommandaStructures::Single {
     template<typename T>
     SingleNode<T>::SingleNode(const T& value) : data(value), next(nullptr) {}
 
+    /*
+     * Name: Node constructor (move)
+     * Description: Initializes a node by moving the given value in and sets the next pointer to nullptr.
+     * Parameters: value - The value to be moved into the node.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    SingleNode<T>::SingleNode(T&& value) : data(std::move(value)), next(nullptr) {}
+
+    /*
+     * Name: Node constructor (in place)
+     * Description: Initializes a node by constructing its value straight from the given arguments (used by emplace).
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    template<typename... Args>
+    SingleNode<T>::SingleNode(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
+
 }
 
 namespace CommandaStructures::Double {
@@ -59,7 +86,11 @@ namespace CommandaStructures::Double {
         DoubleNode<T>* next;
         DoubleNode<T>* prev;
         explicit DoubleNode(const T& value);
+        explicit DoubleNode(T&& value);                // Moves the value in instead of copying it
+        template<typename... Args>
+        explicit DoubleNode(std::in_place_t, Args&&... args); // Constructs the value in place from args
         T& getData() { return data; } // Getter for data
+        const T& getData() const { return data; } // Same, for const nodes
     };
 
     /*
@@ -71,6 +102,116 @@ namespace CommandaStructures::Double {
     template<typename T>
     DoubleNode<T>::DoubleNode(const T& value) : data(value), next(nullptr), prev(nullptr) {}
 
+    /*
+     * Name: DoubleNode constructor (move)
+     * Description: Initializes a double node by moving the given value in, with both pointers set to nullptr.
+     * Parameters: value - The value to be moved into the node.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    DoubleNode<T>::DoubleNode(T&& value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+
+    /*
+     * Name: DoubleNode constructor (in place)
+     * Description: Initializes a double node by constructing its value straight from the given arguments (used by emplace).
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    template<typename... Args>
+    DoubleNode<T>::DoubleNode(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
+
+}
+
+namespace CommandaStructures::Unrolled {
+    /*
+     * Unrolled Node Class
+     * Used for the unrolled linked list. Instead of one value per node, each node holds up to Capacity values in a small
+     * inline array, so a traversal touches one cache line per handful of elements instead of one per element.
+     * The slots are raw storage: only the first count of them hold constructed values, the list constructs and destroys them.
+     */
+    template<typename T, size_t Capacity>
+    class alignas(alignof(T) > 64 ? alignof(T) : 64) UnrolledNode {
+    public:
+        UnrolledNode<T, Capacity>* next;
+        size_t count;
+        UnrolledNode() : next(nullptr), count(0) {}
+        T* items() { return std::launder(reinterpret_cast<T*>(storage)); }             // The first count slots
+        const T* items() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+        T& getData(size_t index) { return items()[index]; } // Getter for one value
+        [[nodiscard]] bool isFull() const { return count == Capacity; }
+
+    private:
+        alignas(T) unsigned char storage[Capacity * sizeof(T)];
+    };
+
+}
+
+namespace CommandaStructures::Indexed {
+    /*
+     * Index Node Class
+     * Used for the index linked list, where every node lives in one vector and links to its neighbours by 32-bit slot
+     * index instead of by pointer. 8 bytes of links instead of 16, and the node holds no address, so the whole array can
+     * be moved or copied as it is.
+     */
+    template<typename T>
+    class IndexNode {
+    public:
+        T data;
+        uint32_t next; // Slot of the next node, or the next free slot while the slot is unused
+        uint32_t prev; // Slot of the previous node
+        IndexNode(const T& value, uint32_t next, uint32_t prev) : data(value), next(next), prev(prev) {}
+        IndexNode(T&& value, uint32_t next, uint32_t prev) : data(std::move(value)), next(next), prev(prev) {} // Moves the value in
+        T& getData() { return data; } // Getter for data
+    };
+
+}
+
+// Intrusive hooks remember which list they are in and the lists check it (double insertion, removal from the wrong list).
+// On by default in debug builds; define COMMANDA_INTRUSIVE_CHECKS to 0 or 1 to choose. The hooks keep their owner field
+// either way, so an object with a hook has the same layout whatever the setting and only the checks come and go. Still
+// choose the same way in every file: a list built with checks off records no owner for a checked list to find.
+#ifndef COMMANDA_INTRUSIVE_CHECKS
+#ifdef NDEBUG
+#define COMMANDA_INTRUSIVE_CHECKS 0
+#else
+#define COMMANDA_INTRUSIVE_CHECKS 1
+#endif
+#endif
+
+namespace CommandaStructures::Intrusive {
+    /*
+     * Intrusive Hook Classes
+     * Used for the intrusive lists. Instead of the list copying a value into a node it allocates, the object itself
+     * carries the links as a member, and the list only splices pointers:
+     * struct Task {
+     *     int priority;
+     *     SingleHook<Task> hook;
+     * };
+     * IntrusiveList<Task, &Task::hook> ready;
+     * An object with two hooks can be in two lists at once. Copying an object gives the copy unlinked hooks.
+     */
+    template<typename T>
+    class SingleHook {
+    public:
+        T* next = nullptr;
+        const void* owner = nullptr; // List the object is in (set only with checks on), nullptr when unlinked
+        SingleHook() = default;
+        SingleHook(const SingleHook&) {}                                 // A copy is not in any list
+        SingleHook& operator=(const SingleHook&) { return *this; }       // Assigning the payload keeps the links
+    };
+
+    template<typename T>
+    class DoubleHook {
+    public:
+        T* next = nullptr;
+        T* prev = nullptr;
+        const void* owner = nullptr; // List the object is in (set only with checks on), nullptr when unlinked
+        DoubleHook() = default;
+        DoubleHook(const DoubleHook&) {}                                 // A copy is not in any list
+        DoubleHook& operator=(const DoubleHook&) { return *this; }       // Assigning the payload keeps the links
+    };
+
 }
 
 #endif //NODE_H
@@ -0,0 +1,478 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef PRIORITYQUEUE_H
+#define PRIORITYQUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "slotmap.h" // SlotHandle
+/* Notes:
+ * Priority queue for the mission planner (A* open set, waypoint deadlines): a d-ary heap in one contiguous array.
+ * top() is the element that no other element compares less than, so with the default std::less<T> the smallest
+ * element comes out first (a min-heap, the opposite of std::priority_queue). Pass std::greater<T> for a max-heap.
+ *
+ * Functions in the priority queue class:
+ * push - Adds an element (copies, or moves an rvalue), returns its handle. O(log N).
+ * emplace - Constructs a new element in place, returns its handle. O(log N).
+ * top / topHandle - The first element and its handle, without removing it. O(1).
+ * pop - Removes and returns the first element (moved out). O(Arity * log N).
+ * decrease_key - Gives an element a new value that compares less than or equal to the old one. O(log N).
+ * update - Gives an element any new value and moves it up or down. O(Arity * log N).
+ * erase - Removes the element a handle refers to. O(Arity * log N).
+ * get / contains - The element a handle refers to, check if a handle is still live.
+ * assign - Replaces the contents with a range in O(N) (bulk heapify), returns the new elements' handles.
+ * getSize / isEmpty / reserve / clear - Number of elements, empty check, make room, remove everything.
+ *
+ * How it works:
+ * The elements sit in one vector in heap order: the children of position i are Arity * i + 1 ... Arity * i + Arity.
+ * A wider heap (Arity 4 or 8) is shallower, so push and decrease_key do fewer steps, and the children of a node are
+ * next to each other in memory, so pop's "find the smallest child" loop reads one or two cache lines per level instead
+ * of jumping around. Arity 4 is usually the best trade-off; 2 is the classic binary heap.
+ * Elements move around the array as the heap changes, so push hands out a SlotHandle (the same generational handle as
+ * SlotMap) instead of a position. A slot table maps a handle to its element's current position; every move in a sift
+ * updates it. Popping or erasing an element bumps its slot's generation, so a handle to it becomes stale and get(),
+ * decrease_key(), update() and erase() throw std::out_of_range for it. Sifts move a hole instead of swapping, so each
+ * level costs one move of T.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, size_t Arity = 4, typename Compare = std::less<T>>
+    class PriorityQueue {
+        static_assert(Arity >= 2, "PriorityQueue needs an arity of at least 2");
+    public:
+        using Handle = SlotHandle;
+
+        explicit PriorityQueue(Compare compare = Compare()) : compare(std::move(compare)) {}
+        template<typename InputIt>
+        PriorityQueue(InputIt first, InputIt last, Compare compare = Compare()); // Bulk heapify of a range, O(N)
+        Handle push(const T& value) { return emplace(value); }             // Adds a copy of value, returns its handle
+        Handle push(T&& value) { return emplace(std::move(value)); }       // Same, but moves the value in
+        template<typename... Args>
+        Handle emplace(Args&&... args);                   // Constructs a new element in place, returns its handle
+        const T& top() const;                             // The first element, throws std::out_of_range if empty
+        Handle topHandle() const;                         // The first element's handle, throws std::out_of_range if empty
+        T pop();                                          // Removes and returns the first element
+        void decrease_key(Handle handle, T value);        // New value must not compare greater than the old one
+        void update(Handle handle, T value);              // New value in either direction
+        void erase(Handle handle);                        // Removes an element, throws std::out_of_range if the handle is stale
+        const T& get(Handle handle) const;                // The element, throws std::out_of_range if the handle is stale
+        [[nodiscard]] bool contains(Handle handle) const; // Checks if the handle still refers to an element
+        template<typename InputIt>
+        std::vector<Handle> assign(InputIt first, InputIt last); // Replaces the contents with a range, O(N)
+        [[nodiscard]] int getSize() const { return static_cast<int>(heap.size()); } // Returns the number of elements
+        [[nodiscard]] bool isEmpty() const { return heap.empty(); }                 // Checks if the queue is empty
+        void reserve(size_t n);                           // Makes room for n elements
+        void clear();                                     // Removes every element, all handles become stale
+
+    private:
+        static constexpr uint32_t none = UINT32_MAX;      // End of the free list
+
+        struct Item {
+            T value;
+            uint32_t slot;                                // The slot that tracks this element's position
+        };
+        struct Slot {
+            uint32_t position;                            // Position in heap while in use, next free slot while free
+            uint32_t generation;                          // Bumped whenever the element leaves, never 0
+        };
+
+        std::vector<Item> heap;                           // The elements, in heap order
+        std::vector<Slot> slots;
+        uint32_t freeHead = none;                         // First free slot
+        [[no_unique_address]] Compare compare;
+
+        uint32_t acquireSlot();                           // A free slot (a new one if none is free)
+        void releaseSlot(uint32_t slot);                  // Bumps a slot's generation and puts it on the free list
+        size_t positionOf(Handle handle) const;           // The element's position, throws std::out_of_range if stale
+        void place(size_t position, Item&& item);         // Moves an item to a position and records it in its slot
+        void siftUp(size_t position);                     // Moves an element up until its parent is not greater
+        void siftDown(size_t position);                   // Moves an element down until no child is smaller
+        void heapify();                                   // Restores heap order over the whole array, O(N)
+        void removeAt(size_t position);                   // Fills a position with the last element and re-sifts it
+        template<typename InputIt>
+        void load(InputIt first, InputIt last, std::vector<Handle>* handles); // Replaces the contents with a range and heapifies
+    };
+
+    /*
+     * Name: PriorityQueue constructor (range)
+     * Description: Copies a range into the array and heapifies it bottom-up in O(N), instead of N pushes in O(N log N).
+     *              Use assign() instead if the elements' handles are needed.
+     * Parameters: first, last - The range of elements.
+     *             compare - The comparator (default is Compare()).
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    template<typename InputIt>
+    PriorityQueue<T, Arity, Compare>::PriorityQueue(InputIt first, InputIt last, Compare compare) : compare(std::move(compare)) {
+        load(first, last, nullptr);
+    }
+
+    /*
+     * Name: PriorityQueue.emplace
+     * Description: Constructs a new element at the end of the array and sifts it up.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: Handle - The new element's handle.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    template<typename... Args>
+    typename PriorityQueue<T, Arity, Compare>::Handle PriorityQueue<T, Arity, Compare>::emplace(Args&&... args) {
+        const uint32_t slot = acquireSlot();
+        try {
+            heap.push_back(Item{T(std::forward<Args>(args)...), slot});
+        } catch (...) {
+            releaseSlot(slot);
+            throw;
+        }
+        slots[slot].position = static_cast<uint32_t>(heap.size() - 1);
+        siftUp(heap.size() - 1);
+        return Handle(slot, slots[slot].generation);
+    }
+
+    /*
+     * Name: PriorityQueue.top
+     * Description: Returns the first element (the root of the heap) without removing it.
+     * Parameters: None
+     * Returns: const T& - The first element. Throws std::out_of_range if the queue is empty.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    const T& PriorityQueue<T, Arity, Compare>::top() const {
+        if (heap.empty()) {
+            throw std::out_of_range("PriorityQueue is empty");
+        }
+        return heap.front().value;
+    }
+
+    template<typename T, size_t Arity, typename Compare>
+    typename PriorityQueue<T, Arity, Compare>::Handle PriorityQueue<T, Arity, Compare>::topHandle() const {
+        if (heap.empty()) {
+            throw std::out_of_range("PriorityQueue is empty");
+        }
+        const uint32_t slot = heap.front().slot;
+        return Handle(slot, slots[slot].generation);
+    }
+
+    /*
+     * Name: PriorityQueue.pop
+     * Description: Removes the first element and returns it (moved out). The last element takes the root's place and is
+     *              sifted down. The element's handle becomes stale.
+     * Parameters: None
+     * Returns: T - The first element. Throws std::out_of_range if the queue is empty.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    T PriorityQueue<T, Arity, Compare>::pop() {
+        if (heap.empty()) {
+            throw std::out_of_range("PriorityQueue is empty");
+        }
+        T value = std::move(heap.front().value);
+        removeAt(0);
+        return value;
+    }
+
+    /*
+     * Name: PriorityQueue.decrease_key
+     * Description: Gives an element a new value that compares less than or equal to its old one (e.g. a shorter path to
+     *              an A* node) and sifts it up, O(log N).
+     * Parameters: handle - The element's handle.
+     *             value - The new value.
+     * Returns: void - No return value. Throws std::out_of_range for a stale handle and std::invalid_argument if the new
+     *          value compares greater than the old one (use update() for that).
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::decrease_key(Handle handle, T value) {
+        const size_t position = positionOf(handle);
+        if (compare(heap[position].value, value)) {
+            throw std::invalid_argument("PriorityQueue decrease_key with a greater value");
+        }
+        heap[position].value = std::move(value);
+        siftUp(position);
+    }
+
+    /*
+     * Name: PriorityQueue.update
+     * Description: Gives an element a new value and sifts it up or down, whichever way the value moved.
+     * Parameters: handle - The element's handle.
+     *             value - The new value.
+     * Returns: void - No return value. Throws std::out_of_range for a stale handle.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::update(Handle handle, T value) {
+        const size_t position = positionOf(handle);
+        const bool up = compare(value, heap[position].value);
+        heap[position].value = std::move(value);
+        if (up) {
+            siftUp(position);
+        } else {
+            siftDown(position);
+        }
+    }
+
+    /*
+     * Name: PriorityQueue.erase
+     * Description: Removes the element a handle refers to, e.g. a waypoint that was cancelled before its turn.
+     * Parameters: handle - The element's handle.
+     * Returns: void - No return value. Throws std::out_of_range for a stale handle.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::erase(Handle handle) {
+        removeAt(positionOf(handle));
+    }
+
+    /*
+     * Name: PriorityQueue.get
+     * Description: Looks up the element a handle refers to.
+     * Parameters: handle - The element's handle.
+     * Returns: const T& - The element (read-only: change it through decrease_key or update). Throws std::out_of_range
+     *          for a stale handle.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    const T& PriorityQueue<T, Arity, Compare>::get(Handle handle) const {
+        return heap[positionOf(handle)].value;
+    }
+
+    template<typename T, size_t Arity, typename Compare>
+    bool PriorityQueue<T, Arity, Compare>::contains(Handle handle) const {
+        if (handle.index() >= slots.size()) {
+            return false;
+        }
+        const Slot& slot = slots[handle.index()];
+        return slot.generation == handle.generation() && slot.position < heap.size() && heap[slot.position].slot == handle.index();
+    }
+
+    /*
+     * Name: PriorityQueue.assign
+     * Description: Replaces the contents with the elements of a range: every old handle becomes stale, the range is
+     *              appended as is and the array is heapified bottom-up in O(N).
+     * Parameters: first, last - The range of elements.
+     * Returns: std::vector<Handle> - The new elements' handles, in the order of the range.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    template<typename InputIt>
+    std::vector<typename PriorityQueue<T, Arity, Compare>::Handle> PriorityQueue<T, Arity, Compare>::assign(InputIt first, InputIt last) {
+        std::vector<Handle> handles;
+        load(first, last, &handles);
+        return handles;
+    }
+
+    /*
+     * Name: PriorityQueue.load
+     * Description: Replaces the contents with the range (reserving first if its length is known) and heapifies. The new
+     *              heap is built in a second queue that starts from a copy of the slot table with the old elements'
+     *              slots released, and is only swapped in once it is complete: if copying an element or the comparator
+     *              throws, this queue and its handles are left exactly as they were.
+     * Parameters: first, last - The range of elements.
+     *             handles - Receives the new elements' handles in range order, or nullptr if they are not needed.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    template<typename InputIt>
+    void PriorityQueue<T, Arity, Compare>::load(InputIt first, InputIt last, std::vector<Handle>* handles) {
+        PriorityQueue loaded(compare);
+        loaded.slots = slots; // The old handles have to go stale, so the generations carry over
+        loaded.freeHead = freeHead;
+        for (const Item& item : heap) {
+            loaded.releaseSlot(item.slot);
+        }
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+            const auto count = static_cast<size_t>(std::distance(first, last));
+            loaded.reserve(count);
+            if (handles) {
+                handles->reserve(count);
+            }
+        }
+        for (; first != last; ++first) {
+            const uint32_t slot = loaded.acquireSlot();
+            loaded.heap.push_back(Item{T(*first), slot});
+            loaded.slots[slot].position = static_cast<uint32_t>(loaded.heap.size() - 1);
+            if (handles) {
+                handles->emplace_back(slot, loaded.slots[slot].generation);
+            }
+        }
+        loaded.heapify();
+        heap.swap(loaded.heap);
+        slots.swap(loaded.slots);
+        freeHead = loaded.freeHead;
+    }
+
+    /*
+     * Name: PriorityQueue.reserve
+     * Description: Makes room for n elements, so the next pushes do not reallocate.
+     * Parameters: n - The number of elements.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::reserve(size_t n) {
+        heap.reserve(n);
+        slots.reserve(n);
+    }
+
+    /*
+     * Name: PriorityQueue.clear
+     * Description: Removes every element. Their slots go back on the free list with a new generation, so all handles
+     *              handed out so far become stale.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::clear() {
+        for (const Item& item : heap) {
+            releaseSlot(item.slot);
+        }
+        heap.clear();
+    }
+
+    /*
+     * Name: PriorityQueue.acquireSlot
+     * Description: Takes the first free slot, or appends a new one. The slot's position is set by the caller.
+     * Parameters: None
+     * Returns: uint32_t - The slot's index.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    uint32_t PriorityQueue<T, Arity, Compare>::acquireSlot() {
+        if (freeHead == none) {
+            if (slots.size() >= none) {
+                throw std::length_error("PriorityQueue is full");
+            }
+            slots.push_back(Slot{none, 1});
+            return static_cast<uint32_t>(slots.size() - 1);
+        }
+        const uint32_t slot = freeHead;
+        freeHead = slots[slot].position;
+        return slot;
+    }
+
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::releaseSlot(uint32_t slot) {
+        Slot& entry = slots[slot];
+        entry.generation = entry.generation + 1 == 0 ? 1 : entry.generation + 1; // 0 stays reserved for the null handle
+        entry.position = freeHead;
+        freeHead = slot;
+    }
+
+    /*
+     * Name: PriorityQueue.positionOf
+     * Description: Finds the current position of the element a handle refers to. The back-reference from the heap item
+     *              rejects a free slot whose generation matches by chance.
+     * Parameters: handle - The element's handle.
+     * Returns: size_t - The element's position in the array. Throws std::out_of_range for a stale handle.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    size_t PriorityQueue<T, Arity, Compare>::positionOf(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("PriorityQueue handle is stale");
+        }
+        return slots[handle.index()].position;
+    }
+
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::place(size_t position, Item&& item) {
+        heap[position] = std::move(item);
+        slots[heap[position].slot].position = static_cast<uint32_t>(position);
+    }
+
+    /*
+     * Name: PriorityQueue.siftUp
+     * Description: Takes the element out, moves each greater parent down into the hole and drops the element in where
+     *              the parent is not greater.
+     * Parameters: position - The element's position.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::siftUp(size_t position) {
+        Item item = std::move(heap[position]);
+        while (position > 0) {
+            const size_t parent = (position - 1) / Arity;
+            if (!compare(item.value, heap[parent].value)) {
+                break;
+            }
+            place(position, std::move(heap[parent]));
+            position = parent;
+        }
+        place(position, std::move(item));
+    }
+
+    /*
+     * Name: PriorityQueue.siftDown
+     * Description: Takes the element out, moves the smallest child up into the hole while it is smaller than the element
+     *              and drops the element in where no child is. The Arity children sit next to each other in the array.
+     * Parameters: position - The element's position.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::siftDown(size_t position) {
+        const size_t count = heap.size();
+        Item item = std::move(heap[position]);
+        while (true) {
+            const size_t firstChild = position * Arity + 1;
+            if (firstChild >= count) {
+                break;
+            }
+            const size_t lastChild = std::min(firstChild + Arity, count);
+            size_t best = firstChild;
+            for (size_t child = firstChild + 1; child < lastChild; child++) {
+                if (compare(heap[child].value, heap[best].value)) {
+                    best = child;
+                }
+            }
+            if (!compare(heap[best].value, item.value)) {
+                break;
+            }
+            place(position, std::move(heap[best]));
+            position = best;
+        }
+        place(position, std::move(item));
+    }
+
+    /*
+     * Name: PriorityQueue.heapify
+     * Description: Sifts down every position that has children, last parent first (Floyd's bottom-up build), O(N).
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::heapify() {
+        if (heap.size() < 2) {
+            return;
+        }
+        for (size_t position = (heap.size() - 2) / Arity + 1; position-- > 0;) {
+            siftDown(position);
+        }
+    }
+
+    /*
+     * Name: PriorityQueue.removeAt
+     * Description: Frees the slot of the element at a position, moves the last element into its place and sifts that
+     *              one up or down.
+     * Parameters: position - The position to remove.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t Arity, typename Compare>
+    void PriorityQueue<T, Arity, Compare>::removeAt(size_t position) {
+        releaseSlot(heap[position].slot);
+        const size_t last = heap.size() - 1;
+        if (position != last) {
+            place(position, std::move(heap[last]));
+        }
+        heap.pop_back();
+        if (position == last) {
+            return;
+        }
+        if (position > 0 && compare(heap[position].value, heap[(position - 1) / Arity].value)) {
+            siftUp(position);
+        } else {
+            siftDown(position);
+        }
+    }
+
+}
+
+#endif //PRIORITYQUEUE_H
@@ -0,0 +1,335 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef QUANTILERINGBUFFER_H
+#define QUANTILERINGBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "ringbuffer.h"
+/* Notes:
+ * Sliding-window ring buffer that keeps its samples in order as well, so the running median / percentiles of the last
+ * N samples can be read without copying the window into a vector and calling nth_element on every tick.
+ * It behaves like RingBuffer<T>(window, true): push never fails and the oldest sample is evicted once the window is full.
+ *
+ * Functions in the quantile ring buffer class:
+ * push - Adds a new sample, evicting the oldest one if the window is full. O(log N) expected.
+ * select - Returns the k-th smallest sample (0-based). O(log N) expected.
+ * quantile - Returns the q quantile (0 <= q <= 1) of the window. O(log N) expected.
+ * percentile - Same as quantile with p in percent (0 <= p <= 100).
+ * median - Returns the median of the window (the lower one for an even number of samples).
+ * min / max - Returns the smallest / largest sample in the window.
+ * countBelow - Returns how many samples in the window are smaller than a value. O(log N) expected.
+ * front / back / getSize / isFull / isEmpty / capacity / clear / iterators - Same as RingBuffer.
+ *
+ * Quantile rule:
+ * quantile(q) returns the element at sorted index floor(q * (getSize() - 1)), the same element
+ * nth_element(v.begin() + size_t(q * (v.size() - 1)), ...) leaves in place, so it drops into the old copy-and-select code.
+ *
+ * How it works:
+ * Next to the RingBuffer of samples there is an order-statistics tree (a treap: a binary search tree ordered by
+ * (value, arrival order) and balanced by random heap priorities) where every node also stores the size of its subtree.
+ * Walking down by subtree sizes finds the k-th smallest sample in O(log N).
+ * Tree nodes live in one array of window slots. Sample number s always uses node s % window, so the node of the sample
+ * being evicted is the node the new sample reuses, and nothing allocates after construction.
+ * NaN samples are not supported, they break the ordering.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class QuantileRingBuffer {
+        static_assert(std::is_arithmetic_v<T>, "QuantileRingBuffer needs a numeric sample type");
+    public:
+        explicit QuantileRingBuffer(size_t window);
+        void push(const T& value);                         // Adds a new sample, evicting the oldest if the window is full
+        [[nodiscard]] T select(size_t k) const;            // k-th smallest sample (0-based)
+        [[nodiscard]] T quantile(double q) const;          // q quantile of the window, 0 <= q <= 1
+        [[nodiscard]] T percentile(double p) const { return quantile(p / 100.0); } // p percentile, 0 <= p <= 100
+        [[nodiscard]] T median() const { return quantile(0.5); }                     // Median (the lower one if the size is even)
+        [[nodiscard]] T min() const { return quantile(0.0); }                         // Smallest sample in the window
+        [[nodiscard]] T max() const { return quantile(1.0); }                         // Largest sample in the window
+        [[nodiscard]] size_t countBelow(const T& value) const; // Number of samples smaller than value
+        T& front() const { return samples.front(); }       // Oldest sample
+        T& back() const { return samples.back(); }         // Newest sample
+        [[nodiscard]] int getSize() const { return samples.getSize(); }          // Number of samples in the window
+        [[nodiscard]] bool isFull() const { return samples.isFull(); }           // Checks if the window is full
+        [[nodiscard]] bool isEmpty() const { return samples.isEmpty(); }         // Checks if the window is empty
+        [[nodiscard]] size_t capacity() const { return samples.capacity(); }     // Window length
+        void clear();                                      // Removes all samples
+        auto cbegin() const { return samples.cbegin(); }   // Read-only iteration in arrival order, oldest sample first
+        auto cend() const   { return samples.cend(); }
+        auto begin() const  { return samples.cbegin(); }
+        auto end() const    { return samples.cend(); }
+
+    private:
+        static constexpr uint32_t none = std::numeric_limits<uint32_t>::max(); // "No child" / empty tree
+
+        struct Node {
+            T value;
+            uint64_t sequence;  // Arrival number, breaks ties between equal values
+            uint32_t priority;  // Random heap priority, keeps the tree balanced in expectation
+            uint32_t size;      // Number of nodes in this subtree
+            uint32_t left;
+            uint32_t right;
+        };
+
+        RingBuffer<T> samples;     // The window itself, in arrival order
+        std::vector<Node> nodes;   // One tree node per window slot
+        uint32_t root;             // Root of the order-statistics tree
+        uint64_t nextSequence;     // Arrival number of the next pushed sample
+        uint32_t randomState;      // xorshift32 state for the priorities
+
+        bool less(uint32_t a, uint32_t b) const;
+        uint32_t subtreeSize(uint32_t node) const { return node == none ? 0 : nodes[node].size; }
+        void update(uint32_t node) { nodes[node].size = 1 + subtreeSize(nodes[node].left) + subtreeSize(nodes[node].right); }
+        void split(uint32_t tree, uint32_t key, uint32_t& left, uint32_t& right);
+        uint32_t merge(uint32_t left, uint32_t right);
+        uint32_t insertNode(uint32_t tree, uint32_t node);
+        uint32_t eraseNode(uint32_t tree, uint32_t node);
+        uint32_t nextPriority();
+    };
+
+    /*
+     * Name: QuantileRingBuffer constructor
+     * Description: Initializes an empty window and allocates the samples and all tree nodes up front.
+     * Parameters: window - Number of most recent samples the order statistics cover.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    QuantileRingBuffer<T>::QuantileRingBuffer(size_t window)
+        : samples(window, true), root(none), nextSequence(0), randomState(0x9E3779B9u) {
+        if (window >= none) {
+            throw std::invalid_argument("QuantileRingBuffer window is too large");
+        }
+        nodes.resize(window);
+    }
+
+    /*
+     * Name: QuantileRingBuffer.push
+     * Description: Adds a new sample, evicting the oldest sample (and its tree node) if the window is full.
+     * Parameters: value - The sample to be added.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void QuantileRingBuffer<T>::push(const T& value) {
+        const auto slot = static_cast<uint32_t>(nextSequence % nodes.size());
+        if (samples.isFull()) {
+            root = eraseNode(root, slot); // The oldest sample always sits in the slot the new one reuses
+        }
+        samples.push(value);
+        Node& node = nodes[slot];
+        node.value = value;
+        node.sequence = nextSequence++;
+        node.priority = nextPriority();
+        node.size = 1;
+        node.left = none;
+        node.right = none;
+        root = insertNode(root, slot);
+    }
+
+    /*
+     * Name: QuantileRingBuffer.select
+     * Description: Returns the k-th smallest sample in the window by walking down the subtree sizes.
+     * Parameters: k - 0-based rank of the sample, 0 is the smallest.
+     * Returns: T - The k-th smallest sample.
+     */
+    template<typename T>
+    T QuantileRingBuffer<T>::select(size_t k) const {
+        if (k >= static_cast<size_t>(getSize())) {
+            throw std::out_of_range("QuantileRingBuffer rank out of range");
+        }
+        uint32_t node = root;
+        while (true) {
+            const size_t leftSize = subtreeSize(nodes[node].left);
+            if (k < leftSize) {
+                node = nodes[node].left;
+            } else if (k == leftSize) {
+                return nodes[node].value;
+            } else {
+                k -= leftSize + 1;
+                node = nodes[node].right;
+            }
+        }
+    }
+
+    /*
+     * Name: QuantileRingBuffer.quantile
+     * Description: Returns the q quantile of the window, the sample at sorted index floor(q * (getSize() - 1)).
+     * Parameters: q - The quantile, between 0 (min) and 1 (max).
+     * Returns: T - The sample at that quantile.
+     */
+    template<typename T>
+    T QuantileRingBuffer<T>::quantile(double q) const {
+        if (!(q >= 0.0 && q <= 1.0)) {
+            throw std::invalid_argument("QuantileRingBuffer quantile must be between 0 and 1");
+        }
+        if (isEmpty()) {
+            throw std::out_of_range("QuantileRingBuffer is empty");
+        }
+        return select(static_cast<size_t>(q * static_cast<double>(getSize() - 1)));
+    }
+
+    /*
+     * Name: QuantileRingBuffer.countBelow
+     * Description: Counts the samples in the window that are smaller than value (the rank value would get).
+     * Parameters: value - The value to compare against.
+     * Returns: size_t - The number of samples smaller than value.
+     */
+    template<typename T>
+    size_t QuantileRingBuffer<T>::countBelow(const T& value) const {
+        size_t count = 0;
+        uint32_t node = root;
+        while (node != none) {
+            if (nodes[node].value < value) {
+                count += subtreeSize(nodes[node].left) + 1;
+                node = nodes[node].right;
+            } else {
+                node = nodes[node].left;
+            }
+        }
+        return count;
+    }
+
+    /*
+     * Name: QuantileRingBuffer.clear
+     * Description: Removes all samples. The tree nodes are simply forgotten, push() reinitializes them.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void QuantileRingBuffer<T>::clear() {
+        samples.clear();
+        root = none;
+        nextSequence = 0;
+    }
+
+    /*
+     * Name: QuantileRingBuffer.less
+     * Description: Tree ordering, by value and then by arrival so equal values still have a strict order.
+     * Parameters: a - Index of the first node.
+     *             b - Index of the second node.
+     * Returns: bool - True if node a sorts before node b.
+     */
+    template<typename T>
+    bool QuantileRingBuffer<T>::less(uint32_t a, uint32_t b) const {
+        if (nodes[a].value < nodes[b].value) return true;
+        if (nodes[b].value < nodes[a].value) return false;
+        return nodes[a].sequence < nodes[b].sequence;
+    }
+
+    /*
+     * Name: QuantileRingBuffer.split
+     * Description: Splits a subtree into the nodes that sort before key and the rest.
+     * Parameters: tree - Root of the subtree to split.
+     *             key - Index of the node to split around (not part of the subtree).
+     *             left - Receives the root of the nodes before key.
+     *             right - Receives the root of the nodes after key.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void QuantileRingBuffer<T>::split(uint32_t tree, uint32_t key, uint32_t& left, uint32_t& right) {
+        if (tree == none) {
+            left = none;
+            right = none;
+        } else if (less(tree, key)) {
+            split(nodes[tree].right, key, nodes[tree].right, right);
+            left = tree;
+            update(tree);
+        } else {
+            split(nodes[tree].left, key, left, nodes[tree].left);
+            right = tree;
+            update(tree);
+        }
+    }
+
+    /*
+     * Name: QuantileRingBuffer.merge
+     * Description: Joins two subtrees where every node of left sorts before every node of right.
+     * Parameters: left - Root of the lower subtree.
+     *             right - Root of the upper subtree.
+     * Returns: uint32_t - Root of the joined subtree.
+     */
+    template<typename T>
+    uint32_t QuantileRingBuffer<T>::merge(uint32_t left, uint32_t right) {
+        if (left == none) return right;
+        if (right == none) return left;
+        if (nodes[left].priority > nodes[right].priority) {
+            nodes[left].right = merge(nodes[left].right, right);
+            update(left);
+            return left;
+        }
+        nodes[right].left = merge(left, nodes[right].left);
+        update(right);
+        return right;
+    }
+
+    /*
+     * Name: QuantileRingBuffer.insertNode
+     * Description: Inserts a detached node into a subtree, splitting the subtree where the node's priority wins.
+     * Parameters: tree - Root of the subtree.
+     *             node - Index of the node to insert.
+     * Returns: uint32_t - New root of the subtree.
+     */
+    template<typename T>
+    uint32_t QuantileRingBuffer<T>::insertNode(uint32_t tree, uint32_t node) {
+        if (tree == none) {
+            return node;
+        }
+        if (nodes[node].priority > nodes[tree].priority) {
+            split(tree, node, nodes[node].left, nodes[node].right);
+            update(node);
+            return node;
+        }
+        if (less(node, tree)) {
+            nodes[tree].left = insertNode(nodes[tree].left, node);
+        } else {
+            nodes[tree].right = insertNode(nodes[tree].right, node);
+        }
+        update(tree);
+        return tree;
+    }
+
+    /*
+     * Name: QuantileRingBuffer.eraseNode
+     * Description: Removes a node from a subtree by finding it and merging its two children in its place.
+     * Parameters: tree - Root of the subtree.
+     *             node - Index of the node to remove (must be in the subtree).
+     * Returns: uint32_t - New root of the subtree.
+     */
+    template<typename T>
+    uint32_t QuantileRingBuffer<T>::eraseNode(uint32_t tree, uint32_t node) {
+        if (tree == node) {
+            return merge(nodes[tree].left, nodes[tree].right);
+        }
+        if (less(node, tree)) {
+            nodes[tree].left = eraseNode(nodes[tree].left, node);
+        } else {
+            nodes[tree].right = eraseNode(nodes[tree].right, node);
+        }
+        update(tree);
+        return tree;
+    }
+
+    /*
+     * Name: QuantileRingBuffer.nextPriority
+     * Description: Returns the next pseudo-random node priority (xorshift32, deterministic from run to run).
+     * Parameters: None
+     * Returns: uint32_t - The priority.
+     */
+    template<typename T>
+    uint32_t QuantileRingBuffer<T>::nextPriority() {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+        return randomState;
+    }
+
+}
+
+#endif //QUANTILERINGBUFFER_H
@@ -5,30 +5,43 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
+#include <utility>
 #include "linkedlist.h"
 /*Notes:
  * Functions in the queue class:
  * push - Adds a new element to the end of the queue.
- * pop - Removes and returns the front element of the queue.
+ * pop - Removes and returns the front element of the queue (moved out of the node, not copied).
  * back - Returns the last element of the queue without removing it.
  * front - Returns the first element of the queue without removing it.
  * emplace - Adds a new element to the end of the queue, allowing for in-place construction.
  * getSize - Returns the number of elements in the queue.
  * isEmpty - Checks if the queue is empty.
+ * clear - Removes all elements (O(1) for trivially destructible T on an ArenaAllocator).
+ * getAllocator - Returns the node allocator (a NodePool by default) of the underlying list.
  */
 
 namespace CommandaStructures {
-    template<typename T>
+    template<typename T, template<typename> class Allocator = NodePool>
     class Queue {
     public:
         Queue();
+        explicit Queue(Allocator<SingleNode<T>> nodeAllocator) : list(std::move(nodeAllocator)) {} // Nodes come from the given allocator (e.g. an arena)
+        Queue(const Queue&) = default;              // Deep copy of the elements
+        Queue(Queue&&) = default;                   // Takes over the nodes, O(1)
+        Queue& operator=(const Queue&) = default;
+        Queue& operator=(Queue&&) = default;
         ~Queue();
         void push(const T& value);                  // Adds a new element to the end of the queue
+        void push(T&& value);                       // Same, but moves the value in
+        template<typename... Args>
+        T& emplace(Args&&... args);                 // Constructs a new element in place at the end of the queue
         T pop();                                   // Removes and returns the front element of the queue
         T& front() const;                           // Returns the first element without removing it
         T& back() const;                            // Returns the last element without removing it
         [[nodiscard]] int getSize() const {return list.getSize();};       // Returns the number of elements in the queue
         [[nodiscard]] bool isEmpty() const;                          // Checks if the queue is empty
+        void clear() { list.clear(); }                              // Removes all elements
+        auto& getAllocator() { return list.getAllocator(); }         // Node allocator of the underlying list (reserve(), highWater())
         // Forward iterator support
         auto begin()       { return list.begin(); }
         auto end()         { return list.end(); }
@@ -42,7 +55,7 @@ namespace CommandaStructures {
         auto crend() const   { return list.rend(); }
 
     private:
-        LinkedList<T> list;                            // Linked list to store the elements of the queue
+        LinkedList<T, Allocator> list;                            // Linked list to store the elements of the queue
     };
 
     /*
@@ -51,8 +64,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    Queue<T>::Queue() : list() {
+    template<typename T, template<typename> class Allocator>
+    Queue<T, Allocator>::Queue() : list() {
         // The size is implicitly managed by the LinkedList class
     }
 
@@ -62,8 +75,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    Queue<T>::~Queue() = default; // Use the default destructor (no need for custom cleanup since LinkedList handles its own memory)
+    template<typename T, template<typename> class Allocator>
+    Queue<T, Allocator>::~Queue() = default; // Use the default destructor (no need for custom cleanup since LinkedList handles its own memory)
 
     /*
      * Name: Queue.enqueue
@@ -71,27 +84,50 @@ namespace CommandaStructures {
      * Parameters: value - The value to be added to the queue.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void Queue<T>::push(const T& value) {
+    template<typename T, template<typename> class Allocator>
+    void Queue<T, Allocator>::push(const T& value) {
         // Use the insert method of the linked list to add the element
         list.insert(value);
     }
 
+    /*
+     * Name: Queue.push (move)
+     * Description: Adds a new element to the end of the queue, moving the value in instead of copying it.
+     * Parameters: value - The value to be moved into the queue.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void Queue<T, Allocator>::push(T&& value) {
+        list.insert(std::move(value));
+    }
+
+    /*
+     * Name: Queue.emplace
+     * Description: Constructs a new element in place at the end of the queue, straight from the constructor arguments.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& Queue<T, Allocator>::emplace(Args&&... args) {
+        return list.emplace_back(std::forward<Args>(args)...);
+    }
+
     /*
      * Name: Queue.dequeue
      * Description: Removes and returns the front element of the queue.
      * Parameters: None
      * Returns: T - The value of the removed element.
      */
-    template<typename T>
-    T Queue<T>::pop() {
+    template<typename T, template<typename> class Allocator>
+    T Queue<T, Allocator>::pop() {
         // Check if the queue is empty
         if (isEmpty()) {
             throw std::out_of_range("Queue is empty");
         }
         SingleNode<T>* headNode = list.getHead();
-        T value = headNode->getData();
-        list.remove(value);
+        T value = std::move(headNode->getData()); // The node is about to be destroyed, so move the value out
+        list.removeNode(headNode); // Unlink the head directly, no search by value (and no operator== needed)
         return value;
     }
 
@@ -101,8 +137,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T& - Reference to the first element.
      */
-    template<typename T>
-    T& Queue<T>::front() const {
+    template<typename T, template<typename> class Allocator>
+    T& Queue<T, Allocator>::front() const {
         // Check if the queue is empty
         if (isEmpty()) {
             throw std::out_of_range("Queue is empty");
@@ -116,8 +152,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T& - Reference to the last element.
      */
-    template<typename T>
-    T& Queue<T>::back() const {
+    template<typename T, template<typename> class Allocator>
+    T& Queue<T, Allocator>::back() const {
         // Check if the queue is empty
         if (isEmpty()) {
             throw std::out_of_range("Queue is empty");
@@ -136,8 +172,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: bool - True if the queue is empty, false otherwise.
      */
-    template<typename T>
-    bool Queue<T>::isEmpty() const {
+    template<typename T, template<typename> class Allocator>
+    bool Queue<T, Allocator>::isEmpty() const {
         return getSize() == 0; // Return true if size is zero, false otherwise
     }
 }
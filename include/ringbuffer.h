@@ -5,11 +5,22 @@
 #ifndef RINGBUFFER_H
 #define RINGBUFFER_H
 
-#include <linkedlist.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 /* Notes:
  * Functions in the ring buffer class:
- * push - Adds a new element to the buffer, overwriting the oldest element if the buffer is full.
- * pop - Removes and returns the oldest element from the buffer (if not overwrite only mode).
+ * push - Adds a new element to the buffer, overwriting the oldest element if the buffer is full (copies, or moves an rvalue).
+ * emplace - Constructs a new element in place from constructor arguments, same rules as push.
+ * pop - Removes and returns the oldest element from the buffer (moved out of the slot, not copied).
+ * pop_back - Removes and returns the most recently added element (lets the buffer double as a bounded deque).
  * front - Returns the oldest element without removing it.
  * back - Returns the most recently added element without removing it.
  * getSize - Returns the number of elements currently in the buffer.
@@ -19,69 +30,264 @@
  * isOverwriteOnly - Checks if the buffer is in overwrite-only mode.
  * capacity - Returns the maximum number of elements the buffer can hold.
  * resize - Resizes the buffer to a new capacity, preserving existing elements if possible.
+ * push_bulk - Adds a span of elements in at most two block copies.
+ * pop_bulk - Removes the oldest elements into a span in at most two block moves.
+ * peek_contiguous - Returns the stored elements (oldest first) as at most two spans that point straight into the slot array.
+ * consume - Removes the oldest n elements, used after reading them through peek_contiguous.
  *
  * Extra:
  * Overwrite only mode: new data is always accepted (push() never fails), the tail moves forward as normal and when full, head also moves forward to discard the oldest item silently
+ *
+ * Fixed capacity:
+ * RingBuffer<T, N> (optionally RingBuffer<T, N, OverflowPolicy::Overwrite>) keeps its N slots inline in the object instead of
+ * on the heap, so it fits in .bss or on the stack. Capacity and overwrite policy are compile-time, everything else matches
+ * RingBuffer<T> (no resize(), and no push_bulk/pop_bulk, peek_contiguous + consume cover the bulk read path).
+ *
+ * Storage:
+ * The elements live in one contiguous slot array that is allocated once in the constructor (and again only by resize()).
+ * head is the index of the oldest element, tail is the index the next push() writes to, and count is the number of live elements.
+ * Slots outside [head, head + count) hold no object, so T does not need to be default constructible.
+ * Once constructed, push() / pop() never allocate or free memory.
+ * Copying a buffer copies its elements into a new slot array (oldest first, from slot 0). Moving RingBuffer<T> hands the
+ * slot array over in O(1) and leaves the source with capacity 0 (destroy it, assign to it or resize() it before reuse);
+ * moving RingBuffer<T, N> has to move the elements one by one since they live inside the object.
  */
 
 namespace CommandaStructures {
 
-    template<typename T>
+    inline constexpr size_t DynamicCapacity = 0; // N value that selects the runtime-capacity RingBuffer
+
+    // What push() does when a fixed-capacity RingBuffer<T, N> is full
+    enum class OverflowPolicy {
+        Reject,    // push() throws, like the default mode of the runtime-capacity buffer
+        Overwrite  // push() drops the oldest element, like overwriteOnly = true
+    };
+
+    /* Runtime-capacity ring buffer, RingBuffer<T> (N = DynamicCapacity).
+     * Overwrite vs reject is chosen by the constructor flag, so Policy must stay at its default here.
+     */
+    template<typename T, size_t N = DynamicCapacity, OverflowPolicy Policy = OverflowPolicy::Reject>
     class RingBuffer {
+        static_assert(Policy == OverflowPolicy::Reject, "RingBuffer<T> picks overwrite mode at runtime, pass overwrite = true to the constructor instead");
     public:
         RingBuffer(size_t capacity, bool overwrite = false);
+        RingBuffer(const RingBuffer& other);               // Copies the elements into a slot array of its own
+        RingBuffer(RingBuffer&& other) noexcept;           // Takes over the slot array, O(1)
+        RingBuffer& operator=(const RingBuffer& other);
+        RingBuffer& operator=(RingBuffer&& other) noexcept;
         ~RingBuffer();
         void push(const T& value);       // Adds a new element to the buffer, overwriting the oldest if full
+        void push(T&& value);            // Same, but moves the value in
+        template<typename... Args>
+        T& emplace(Args&&... args);      // Constructs a new element in place, overwriting the oldest if full
         T pop();                         // Removes and returns the oldest element from the buffer
+        T pop_back();                    // Removes and returns the most recently added element
         T& front() const;                // Returns the oldest element without removing it
         T& peek() const { return front(); }  // Alias for front()
         T& back() const;                 // Returns the most recently added element without removing it
-        [[nodiscard]] int getSize() const {return list.getSize();};             // Returns the number of elements currently in the buffer
+        [[nodiscard]] int getSize() const {return static_cast<int>(count);};   // Returns the number of elements currently in the buffer
         [[nodiscard]] bool isFull() const;             // Checks if the buffer is full
         [[nodiscard]] bool isEmpty() const;            // Checks if the buffer is empty
         void clear();                    // Clears the buffer, removing all elements
         [[nodiscard]] bool isOverwriteOnly() const {return overwriteOnly;};    // Checks if the buffer is in overwrite-only mode
         [[nodiscard]] size_t capacity() const {return maxCapacity;};         // Returns the maximum number of elements the buffer can hold
         void resize(size_t newCapacity); // Resizes the buffer to a new capacity, preserving existing elements if possible
+        size_t push_bulk(std::span<const T> values);   // Adds many elements at once, returns how many were added
+        size_t pop_bulk(std::span<T> out);             // Removes up to out.size() oldest elements into out, returns how many were removed
+        std::array<std::span<T>, 2> peek_contiguous() const; // Stored elements as at most two segments (the second is empty unless the data wraps)
+        void consume(size_t n);                        // Removes the oldest n elements without copying them out
+
+        /* Iterators walk the buffer from the oldest element (front) to the newest (back).
+         * They store a logical position (0 = front) and map it to a slot on dereference.
+         */
+        class Iterator {
+        public:
+            Iterator(const RingBuffer* buffer, size_t position) : buffer(buffer), position(position) {}
+            T& operator*() const { return buffer->slots[buffer->slotIndex(position)]; }
+            Iterator& operator++() { ++position; return *this; }
+            bool operator!=(const Iterator& other) const { return position != other.position; }
+            bool operator==(const Iterator& other) const { return position == other.position; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+        private:
+            const RingBuffer* buffer;
+            size_t position;
+        };
+
+        class ConstIterator {
+        public:
+            ConstIterator(const RingBuffer* buffer, size_t position) : buffer(buffer), position(position) {}
+            const T& operator*() const { return buffer->slots[buffer->slotIndex(position)]; }
+            ConstIterator& operator++() { ++position; return *this; }
+            bool operator!=(const ConstIterator& other) const { return position != other.position; }
+            bool operator==(const ConstIterator& other) const { return position == other.position; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+        private:
+            const RingBuffer* buffer;
+            size_t position;
+        };
+
+        // Walks from the newest element back to the oldest, position counts down to 0 and end() sits one past it
+        class ReverseIterator {
+        public:
+            ReverseIterator(const RingBuffer* buffer, size_t position) : buffer(buffer), position(position) {}
+            T& operator*() const { return buffer->slots[buffer->slotIndex(position - 1)]; }
+            ReverseIterator& operator++() { --position; return *this; }
+            bool operator!=(const ReverseIterator& other) const { return position != other.position; }
+            bool operator==(const ReverseIterator& other) const { return position == other.position; }
+
+        private:
+            const RingBuffer* buffer;
+            size_t position;
+        };
+
         // Forward iterator support
-        auto begin()       { return list.begin(); }
-        auto end()         { return list.end(); }
-        auto cbegin() const { return list.cbegin(); }
-        auto cend() const   { return list.cend(); }
+        Iterator begin()       { return Iterator(this, 0); }
+        Iterator end()         { return Iterator(this, count); }
+        ConstIterator cbegin() const { return ConstIterator(this, 0); }
+        ConstIterator cend() const   { return ConstIterator(this, count); }
 
         // Reverse iterator support
-        auto rbegin()      { return list.rbegin(); }
-        auto rend()        { return list.rend(); }
+        ReverseIterator rbegin()      { return ReverseIterator(this, count); }
+        ReverseIterator rend()        { return ReverseIterator(this, 0); }
     private:
-        LinkedList<T> list;              // Linked list to store the elements of the buffer
-        size_t maxCapacity;              // Maximum number of elements the buffer can hold
+        T* slots;                        // Contiguous slot array holding the elements of the buffer
+        size_t maxCapacity;              // Maximum number of elements the buffer can hold (length of the slot array)
+        size_t head;                     // Index of the oldest element
+        size_t tail;                     // Index the next pushed element is written to
+        size_t count;                    // Number of elements currently in the buffer
         bool overwriteOnly;              // Flag to indicate if the buffer is in overwrite-only mode default is false
+
+        // Advances a slot index by one, wrapping to zero at the end of the array (cheaper than % for arbitrary capacities)
+        [[nodiscard]] size_t nextIndex(size_t index) const { return index + 1 == maxCapacity ? 0 : index + 1; }
+        // Maps a logical position (0 = oldest) to its slot index
+        [[nodiscard]] size_t slotIndex(size_t position) const {
+            size_t index = head + position;
+            return index >= maxCapacity ? index - maxCapacity : index;
+        }
+        // Drops the oldest n elements (n <= count)
+        void dropOldest(size_t n) {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < n; i++) {
+                    std::destroy_at(slots + slotIndex(i));
+                }
+            }
+            head = slotIndex(n);
+            count -= n;
+        }
+        template<typename U>
+        void pushValue(U&& value);       // Shared body of the two push overloads
+        static T* allocateSlots(size_t capacity) { return std::allocator<T>().allocate(capacity); }
+        static void freeSlots(T* slots, size_t capacity) { std::allocator<T>().deallocate(slots, capacity); }
     };
 
     /*
      * Name: RingBuffer constructor
-     * Description: Initializes an empty ring buffer with a default capacity.
+     * Description: Initializes an empty ring buffer and allocates the slot array for all of its capacity up front.
      * Parameters: capacity - The maximum number of elements the buffer can hold.
      *             overwrite - A flag indicating if the buffer should overwrite the oldest element when full (default is false).
      * Returns: void - No return value.
      */
-    template<typename T>
-    RingBuffer<T>::RingBuffer(size_t capacity, bool overwrite)
-        : maxCapacity(capacity), overwriteOnly(overwrite) {
+    template<typename T, size_t N, OverflowPolicy Policy>
+    RingBuffer<T, N, Policy>::RingBuffer(size_t capacity, bool overwrite)
+        : slots(nullptr), maxCapacity(capacity), head(0), tail(0), count(0), overwriteOnly(overwrite) {
         if (capacity == 0) {
             throw std::invalid_argument("RingBuffer capacity must be greater than zero");
         }
-        list = LinkedList<T>();
+        slots = allocateSlots(capacity);
+    }
+
+    /*
+     * Name: RingBuffer copy constructor
+     * Description: Initializes a buffer with the same capacity and mode as other and copies its elements, oldest first.
+     * Parameters: other - The buffer to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    RingBuffer<T, N, Policy>::RingBuffer(const RingBuffer& other)
+        : slots(allocateSlots(other.maxCapacity)), maxCapacity(other.maxCapacity), head(0), tail(0), count(0),
+          overwriteOnly(other.overwriteOnly) {
+        try {
+            for (; count < other.count; count++) {
+                std::construct_at(slots + count, other.slots[other.slotIndex(count)]);
+            }
+        } catch (...) {
+            clear();
+            freeSlots(slots, maxCapacity);
+            throw;
+        }
+        tail = count == maxCapacity ? 0 : count;
+    }
+
+    /*
+     * Name: RingBuffer move constructor
+     * Description: Takes over other's slot array and elements. other is left empty with capacity 0.
+     * Parameters: other - The buffer to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    RingBuffer<T, N, Policy>::RingBuffer(RingBuffer&& other) noexcept
+        : slots(std::exchange(other.slots, nullptr)), maxCapacity(std::exchange(other.maxCapacity, 0)),
+          head(std::exchange(other.head, 0)), tail(std::exchange(other.tail, 0)), count(std::exchange(other.count, 0)),
+          overwriteOnly(std::exchange(other.overwriteOnly, false)) {} // A capacity 0 reject-mode buffer refuses every push
+
+    /*
+     * Name: RingBuffer copy assignment
+     * Description: Replaces the contents, capacity and mode with a copy of other's (copy, then move into place).
+     * Parameters: other - The buffer to copy.
+     * Returns: RingBuffer& - This buffer.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    RingBuffer<T, N, Policy>& RingBuffer<T, N, Policy>::operator=(const RingBuffer& other) {
+        if (this != &other) {
+            *this = RingBuffer(other); // If copying throws, this buffer is untouched
+        }
+        return *this;
+    }
+
+    /*
+     * Name: RingBuffer move assignment
+     * Description: Destroys this buffer's elements and slot array, then takes over other's. other is left with capacity 0.
+     * Parameters: other - The buffer to move from.
+     * Returns: RingBuffer& - This buffer.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    RingBuffer<T, N, Policy>& RingBuffer<T, N, Policy>::operator=(RingBuffer&& other) noexcept {
+        if (this != &other) {
+            clear();
+            freeSlots(slots, maxCapacity);
+            slots = std::exchange(other.slots, nullptr);
+            maxCapacity = std::exchange(other.maxCapacity, 0);
+            head = std::exchange(other.head, 0);
+            tail = std::exchange(other.tail, 0);
+            count = std::exchange(other.count, 0);
+            overwriteOnly = std::exchange(other.overwriteOnly, false);
+        }
+        return *this;
     }
 
     /*
      * Name: RingBuffer destructor
-     * Description: Cleans up the ring buffer by deleting the linked list to prevent memory leaks.
+     * Description: Destroys the live elements and frees the slot array.
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    RingBuffer<T>::~RingBuffer() = default; // Use the default destructor (no need for custom cleanup since LinkedList handles its own memory)
+    template<typename T, size_t N, OverflowPolicy Policy>
+    RingBuffer<T, N, Policy>::~RingBuffer() {
+        clear();
+        freeSlots(slots, maxCapacity);
+    }
 
     /*
      * Name: RingBuffer.push
@@ -89,18 +295,67 @@ namespace CommandaStructures {
      * Parameters: value - The value to be added to the buffer.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void RingBuffer<T>::push(const T& value) {
+    template<typename T, size_t N, OverflowPolicy Policy>
+    void RingBuffer<T, N, Policy>::push(const T& value) {
+        pushValue(value);
+    }
+
+    /*
+     * Name: RingBuffer.push (move)
+     * Description: Same as push, but the value is moved into the buffer instead of copied.
+     * Parameters: value - The value to be moved into the buffer.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    void RingBuffer<T, N, Policy>::push(T&& value) {
+        pushValue(std::move(value));
+    }
+
+    /*
+     * Name: RingBuffer.emplace
+     * Description: Constructs a new element in place from the given arguments. When full, overwrite-only mode destroys
+     *              the oldest element and builds the new one in its slot, otherwise it throws like push.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    template<typename... Args>
+    T& RingBuffer<T, N, Policy>::emplace(Args&&... args) {
+        if (isFull()) {
+            if (!overwriteOnly) {
+                throw std::runtime_error("RingBuffer is full and not in overwrite-only mode");
+            }
+            dropOldest(1); // Frees the slot at tail (tail == head when full)
+        }
+        T* slot = std::construct_at(slots + tail, std::forward<Args>(args)...);
+        tail = nextIndex(tail);
+        count++;
+        return *slot;
+    }
+
+    /*
+     * Name: RingBuffer.pushValue
+     * Description: Adds a new element (copied from an lvalue, moved from an rvalue), overwriting the oldest element if the buffer is full.
+     * Parameters: value - The value to be added to the buffer.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    template<typename U>
+    void RingBuffer<T, N, Policy>::pushValue(U&& value) {
         if (isFull()) {
             if (overwriteOnly) {
-                // If in overwrite-only mode, remove the oldest element
-                list.removeNode(list.getHead());
-            } else {
-                // If not in overwrite-only mode, do not add the new element
-                throw std::runtime_error("RingBuffer is full and not in overwrite-only mode");
+                // If in overwrite-only mode, the oldest slot is reused in place (tail == head when full)
+                slots[tail] = std::forward<U>(value);
+                head = nextIndex(head);
+                tail = head;
+                return;
             }
+            // If not in overwrite-only mode, do not add the new element
+            throw std::runtime_error("RingBuffer is full and not in overwrite-only mode");
         }
-        list.insert(value); // Insert the new value at the end of the linked list
+        std::construct_at(slots + tail, std::forward<U>(value)); // Construct the new value in the free slot
+        tail = nextIndex(tail);
+        count++;
     }
 
     /*
@@ -109,28 +364,48 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T - The value of the removed element.
      */
-    template<typename T>
-    T RingBuffer<T>::pop() {
+    template<typename T, size_t N, OverflowPolicy Policy>
+    T RingBuffer<T, N, Policy>::pop() {
         if (isEmpty()) {
             throw std::out_of_range("RingBuffer is empty");
         }
-        T value = list.getHead()->getData(); // Get the data from the head node
-        list.removeNode(list.getHead()); // Remove the head node
+        T value = std::move(slots[head]); // Move the data out of the oldest slot
+        std::destroy_at(slots + head); // The slot is free again
+        head = nextIndex(head);
+        count--;
         return value; // Return the removed value
     }
 
+    /*
+     * Name: RingBuffer.pop_back
+     * Description: Removes and returns the most recently added element, undoing the last push.
+     * Parameters: None
+     * Returns: T - The value of the removed element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    T RingBuffer<T, N, Policy>::pop_back() {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
+        }
+        tail = tail == 0 ? maxCapacity - 1 : tail - 1; // Step back onto the newest element
+        T value = std::move(slots[tail]);
+        std::destroy_at(slots + tail);
+        count--;
+        return value;
+    }
+
     /*
      * Name: RingBuffer.front
      * Description: Returns the oldest element without removing it.
      * Parameters: None
      * Returns: T& - Reference to the oldest element.
      */
-    template<typename T>
-    T& RingBuffer<T>::front() const {
-        if (isEmpty() || list.getHead() == nullptr) {
-            throw std::out_of_range("RingBuffer is empty or head is null");
+    template<typename T, size_t N, OverflowPolicy Policy>
+    T& RingBuffer<T, N, Policy>::front() const {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
         }
-        return list.getHead()->getData(); // Return the data from the head node
+        return slots[head]; // Return the oldest slot
     }
 
     /*
@@ -139,12 +414,12 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T& - Reference to the most recently added element.
      */
-    template<typename T>
-    T& RingBuffer<T>::back() const {
-        if (isEmpty() || list.getTail() == nullptr) {
-            throw std::out_of_range("RingBuffer is empty or tail is null");
+    template<typename T, size_t N, OverflowPolicy Policy>
+    T& RingBuffer<T, N, Policy>::back() const {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
         }
-        return list.getTail()->getData(); // Return the data from the tail node
+        return slots[tail == 0 ? maxCapacity - 1 : tail - 1]; // The newest element sits just before tail
     }
 
     /*
@@ -153,9 +428,9 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: bool - True if the buffer is full, false otherwise.
      */
-    template<typename T>
-    bool RingBuffer<T>::isFull() const {
-        return list.getSize() >= maxCapacity; // Check if the size of the linked list is equal to or greater than the maximum capacity
+    template<typename T, size_t N, OverflowPolicy Policy>
+    bool RingBuffer<T, N, Policy>::isFull() const {
+        return count >= maxCapacity; // Check if every slot holds an element
     }
 
     /*
@@ -164,39 +439,548 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: bool - True if the buffer is empty, false otherwise.
      */
-    template<typename T>
-    bool RingBuffer<T>::isEmpty() const {
-        return list.getSize() == 0; // Check if the size of the linked list is zero
+    template<typename T, size_t N, OverflowPolicy Policy>
+    bool RingBuffer<T, N, Policy>::isEmpty() const {
+        return count == 0; // Check if no slot holds an element
     }
 
     /*
      * Name: RingBuffer.clear
-     * Description: Clears the buffer, removing all elements.
+     * Description: Clears the buffer, destroying all elements. The slot array is kept for reuse.
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    void RingBuffer<T>::clear() {
-        list.clear();
+    template<typename T, size_t N, OverflowPolicy Policy>
+    void RingBuffer<T, N, Policy>::clear() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; i++) {
+                std::destroy_at(slots + slotIndex(i));
+            }
+        }
+        head = 0;
+        tail = 0;
+        count = 0;
     }
 
     /*
      * Name: RingBuffer.resize
      * Description: Resizes the buffer to a new capacity, preserving existing elements if possible. Removes oldest elements if the new capacity is smaller than the current size.
+     *              This reallocates the slot array, so it should stay out of hot paths.
+     *              Elements are moved, or copied when T's move may throw, so if a copy throws the new array is freed and the
+     *              buffer is left as it was.
      * Parameters: newCapacity - The new maximum number of elements the buffer can hold.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void RingBuffer<T>::resize(size_t newCapacity) {
-        if (newCapacity < list.getSize()) {
-            // If the new capacity is less than the current size, remove the oldest elements
-            while (list.getSize() > newCapacity) {
-                list.removeNode(list.getHead());
+    template<typename T, size_t N, OverflowPolicy Policy>
+    void RingBuffer<T, N, Policy>::resize(size_t newCapacity) {
+        if (newCapacity == 0) {
+            throw std::invalid_argument("RingBuffer capacity must be greater than zero");
+        }
+        // If the new capacity is less than the current size, the oldest elements are dropped
+        size_t dropped = count > newCapacity ? count - newCapacity : 0;
+        size_t kept = count - dropped;
+        T* newSlots = allocateSlots(newCapacity);
+        // Move the kept elements to the start of the new array so they are in order again
+        size_t constructed = 0;
+        try {
+            for (; constructed < kept; constructed++) {
+                std::construct_at(newSlots + constructed, std::move_if_noexcept(slots[slotIndex(dropped + constructed)]));
             }
+        } catch (...) {
+            std::destroy_n(newSlots, constructed);
+            freeSlots(newSlots, newCapacity);
+            throw;
         }
+        clear();
+        freeSlots(slots, maxCapacity);
+        slots = newSlots;
         maxCapacity = newCapacity; // Update the maximum capacity
+        count = kept;
+        tail = kept == newCapacity ? 0 : kept;
+    }
+
+
+    /*
+     * Name: RingBuffer.push_bulk
+     * Description: Adds the values in order, copying them into the free slots in at most two blocks.
+     *              In overwrite-only mode every value is added and the oldest elements are dropped to make room
+     *              (if there are more values than capacity, only the newest capacity values are kept).
+     *              Otherwise only as many values as fit are added, the rest are left for the caller.
+     *              values may point into this buffer (e.g. a span from peek_contiguous): when elements have to be dropped
+     *              first, such values are copied out before the drop destroys them.
+     *              If a copy throws, none of the values are added (in overwrite mode the dropped elements stay dropped).
+     * Parameters: values - The values to be added to the buffer, oldest first.
+     * Returns: size_t - The number of values that were added.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    size_t RingBuffer<T, N, Policy>::push_bulk(std::span<const T> values) {
+        size_t accepted = values.size();
+        if (overwriteOnly) {
+            if (values.size() > maxCapacity) {
+                values = values.last(maxCapacity); // Older values would be overwritten within this same call anyway
+            }
+            size_t room = maxCapacity - count;
+            if (values.size() > room) {
+                const std::less<const T*> before;
+                if (!values.empty() && !before(values.data(), slots) && before(values.data(), slots + maxCapacity)) {
+                    const std::vector<T> copies(values.begin(), values.end()); // The drop below would destroy them
+                    push_bulk(std::span<const T>(copies));
+                    return accepted;
+                }
+                dropOldest(values.size() - room);
+            }
+        } else {
+            values = values.first(std::min(values.size(), maxCapacity - count));
+            accepted = values.size();
+        }
+        // The free region starts at tail and may wrap around the end of the array
+        size_t firstBlock = std::min(values.size(), maxCapacity - tail);
+        std::uninitialized_copy_n(values.begin(), firstBlock, slots + tail);
+        try {
+            std::uninitialized_copy_n(values.begin() + firstBlock, values.size() - firstBlock, slots);
+        } catch (...) {
+            std::destroy_n(slots + tail, firstBlock); // Not counted yet, nothing else would destroy them
+            throw;
+        }
+        tail = slotIndex(count + values.size());
+        count += values.size();
+        return accepted;
+    }
+
+    /*
+     * Name: RingBuffer.pop_bulk
+     * Description: Removes the oldest elements into out, moving them out of the slot array in at most two blocks.
+     * Parameters: out - Receives the removed elements, oldest first. At most out.size() elements are removed.
+     * Returns: size_t - The number of elements removed (less than out.size() if the buffer ran empty).
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    size_t RingBuffer<T, N, Policy>::pop_bulk(std::span<T> out) {
+        size_t n = std::min(out.size(), count);
+        auto [first, second] = peek_contiguous();
+        size_t firstBlock = std::min(n, first.size());
+        std::move(first.begin(), first.begin() + firstBlock, out.begin());
+        std::move(second.begin(), second.begin() + (n - firstBlock), out.begin() + firstBlock);
+        dropOldest(n);
+        return n;
+    }
+
+    /*
+     * Name: RingBuffer.peek_contiguous
+     * Description: Returns the stored elements, oldest first, as spans into the slot array so they can be read without copying.
+     *              The first span runs from the oldest element to the end of the array (or to the newest element),
+     *              the second span holds the wrapped part from the start of the array and is empty if the data does not wrap.
+     *              The spans are only valid until the next push/pop/consume/clear/resize.
+     * Parameters: None
+     * Returns: std::array<std::span<T>, 2> - The two segments, first then second.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    std::array<std::span<T>, 2> RingBuffer<T, N, Policy>::peek_contiguous() const {
+        size_t firstBlock = std::min(count, maxCapacity - head);
+        return {std::span<T>(slots + head, firstBlock), std::span<T>(slots, count - firstBlock)};
+    }
+
+    /*
+     * Name: RingBuffer.consume
+     * Description: Removes the oldest n elements. Meant to commit a read done through peek_contiguous.
+     * Parameters: n - The number of elements to remove.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy>
+    void RingBuffer<T, N, Policy>::consume(size_t n) {
+        if (n > count) {
+            throw std::out_of_range("RingBuffer cannot consume more elements than it holds");
+        }
+        dropOldest(n);
     }
 
+    /* Fixed-capacity ring buffer, RingBuffer<T, N> / RingBuffer<T, N, OverflowPolicy::Overwrite>.
+     * The slot array is an inline member, so the whole buffer can live in .bss, on the stack or inside another object,
+     * and it never allocates. The overflow policy is a template parameter, so push() has no runtime mode check,
+     * and when N is a power of two the index wrap compiles down to a mask.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    class RingBuffer<T, N, Policy> {
+    public:
+        RingBuffer() : head(0), count(0) {} // Leaves the slot storage untouched, nothing is zeroed or allocated
+        RingBuffer(const RingBuffer& other);               // Copies the elements, oldest first
+        RingBuffer(RingBuffer&& other) noexcept(std::is_nothrow_move_constructible_v<T>); // Moves the elements one by one, other ends up empty
+        RingBuffer& operator=(const RingBuffer& other);
+        RingBuffer& operator=(RingBuffer&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+        ~RingBuffer();
+        void push(const T& value);       // Adds a new element to the buffer (Overwrite: drops the oldest if full, Reject: throws if full)
+        void push(T&& value);            // Same, but moves the value in
+        template<typename... Args>
+        T& emplace(Args&&... args);      // Constructs a new element in place, same overflow rules as push
+        T pop();                         // Removes and returns the oldest element from the buffer
+        T pop_back();                    // Removes and returns the most recently added element
+        T& front() const;                // Returns the oldest element without removing it
+        T& peek() const { return front(); }  // Alias for front()
+        T& back() const;                 // Returns the most recently added element without removing it
+        [[nodiscard]] int getSize() const { return static_cast<int>(count); }   // Returns the number of elements currently in the buffer
+        [[nodiscard]] bool isFull() const { return count == N; }                // Checks if the buffer is full
+        [[nodiscard]] bool isEmpty() const { return count == 0; }               // Checks if the buffer is empty
+        void clear();                    // Clears the buffer, removing all elements
+        [[nodiscard]] static constexpr bool isOverwriteOnly() { return Policy == OverflowPolicy::Overwrite; } // Checks if the buffer is in overwrite-only mode
+        [[nodiscard]] static constexpr size_t capacity() { return N; }          // Returns the maximum number of elements the buffer can hold
+        std::array<std::span<T>, 2> peek_contiguous() const; // Stored elements as at most two segments (the second is empty unless the data wraps)
+        void consume(size_t n);                        // Removes the oldest n elements without copying them out
+
+        class Iterator {
+        public:
+            Iterator(const RingBuffer* buffer, size_t position) : buffer(buffer), position(position) {}
+            T& operator*() const { return buffer->slot(wrap(buffer->head + position)); }
+            Iterator& operator++() { ++position; return *this; }
+            bool operator!=(const Iterator& other) const { return position != other.position; }
+            bool operator==(const Iterator& other) const { return position == other.position; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+        private:
+            const RingBuffer* buffer;
+            size_t position;
+        };
+
+        class ConstIterator {
+        public:
+            ConstIterator(const RingBuffer* buffer, size_t position) : buffer(buffer), position(position) {}
+            const T& operator*() const { return buffer->slot(wrap(buffer->head + position)); }
+            ConstIterator& operator++() { ++position; return *this; }
+            bool operator!=(const ConstIterator& other) const { return position != other.position; }
+            bool operator==(const ConstIterator& other) const { return position == other.position; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+        private:
+            const RingBuffer* buffer;
+            size_t position;
+        };
+
+        class ReverseIterator {
+        public:
+            ReverseIterator(const RingBuffer* buffer, size_t position) : buffer(buffer), position(position) {}
+            T& operator*() const { return buffer->slot(wrap(buffer->head + position - 1)); }
+            ReverseIterator& operator++() { --position; return *this; }
+            bool operator!=(const ReverseIterator& other) const { return position != other.position; }
+            bool operator==(const ReverseIterator& other) const { return position == other.position; }
+
+        private:
+            const RingBuffer* buffer;
+            size_t position;
+        };
+
+        // Forward iterator support
+        Iterator begin()       { return Iterator(this, 0); }
+        Iterator end()         { return Iterator(this, count); }
+        ConstIterator cbegin() const { return ConstIterator(this, 0); }
+        ConstIterator cend() const   { return ConstIterator(this, count); }
+
+        // Reverse iterator support
+        ReverseIterator rbegin()      { return ReverseIterator(this, count); }
+        ReverseIterator rend()        { return ReverseIterator(this, 0); }
+
+    private:
+        alignas(T) unsigned char storage[N * sizeof(T)]; // Inline slot array, slots outside [head, head + count) hold no object
+        size_t head;                     // Index of the oldest element
+        size_t count;                    // Number of elements currently in the buffer
+
+        // Wraps an index in [0, 2N) back into [0, N), a single AND when N is a power of two
+        static constexpr size_t wrap(size_t index) {
+            if constexpr ((N & (N - 1)) == 0) {
+                return index & (N - 1);
+            } else {
+                return index >= N ? index - N : index;
+            }
+        }
+        T& slot(size_t index) const { return *std::launder(reinterpret_cast<T*>(const_cast<unsigned char*>(storage)) + index); }
+        T* slotAddress(size_t index) { return reinterpret_cast<T*>(storage) + index; }
+        template<typename Buffer>
+        void appendFrom(Buffer&& other); // Copies (lvalue) or moves (rvalue) other's elements into this empty buffer
+        template<typename U>
+        void pushValue(U&& value);       // Shared body of the two push overloads
+    };
+
+    /*
+     * Name: RingBuffer<T, N> destructor
+     * Description: Destroys the live elements. The storage is part of the object, so there is nothing to free.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    RingBuffer<T, N, Policy>::~RingBuffer() {
+        clear();
+    }
+
+    /*
+     * Name: RingBuffer<T, N> copy constructor
+     * Description: Initializes a buffer holding copies of other's elements, oldest first.
+     * Parameters: other - The buffer to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    RingBuffer<T, N, Policy>::RingBuffer(const RingBuffer& other) : head(0), count(0) {
+        appendFrom(other);
+    }
+
+    /*
+     * Name: RingBuffer<T, N> move constructor
+     * Description: Initializes a buffer by moving other's elements over one by one (the storage is inline, so there is
+     *              no pointer to hand over). other is left empty.
+     * Parameters: other - The buffer to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    RingBuffer<T, N, Policy>::RingBuffer(RingBuffer&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : head(0), count(0) {
+        appendFrom(std::move(other));
+    }
+
+    /*
+     * Name: RingBuffer<T, N> copy assignment
+     * Description: Replaces the contents with copies of other's elements.
+     * Parameters: other - The buffer to copy.
+     * Returns: RingBuffer& - This buffer.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    RingBuffer<T, N, Policy>& RingBuffer<T, N, Policy>::operator=(const RingBuffer& other) {
+        if (this != &other) {
+            clear();
+            appendFrom(other);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: RingBuffer<T, N> move assignment
+     * Description: Replaces the contents by moving other's elements over. other is left empty.
+     * Parameters: other - The buffer to move from.
+     * Returns: RingBuffer& - This buffer.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    RingBuffer<T, N, Policy>& RingBuffer<T, N, Policy>::operator=(RingBuffer&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            appendFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.appendFrom
+     * Description: Copies or moves other's elements, oldest first, into this buffer starting at slot 0. A moved-from
+     *              other is cleared afterwards. If a copy throws, the elements copied so far are destroyed.
+     * Parameters: other - The buffer to take the elements from, this buffer must be empty.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    template<typename Buffer>
+    void RingBuffer<T, N, Policy>::appendFrom(Buffer&& other) {
+        head = 0;
+        try {
+            for (; count < other.count; count++) {
+                T& source = other.slot(wrap(other.head + count));
+                if constexpr (std::is_lvalue_reference_v<Buffer>) {
+                    std::construct_at(slotAddress(count), std::as_const(source));
+                } else {
+                    std::construct_at(slotAddress(count), std::move(source));
+                }
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+        if constexpr (!std::is_lvalue_reference_v<Buffer>) {
+            other.clear();
+        }
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.push
+     * Description: Adds a new element to the buffer. When full, OverflowPolicy::Overwrite replaces the oldest element
+     *              and OverflowPolicy::Reject throws. The policy is resolved at compile time.
+     * Parameters: value - The value to be added to the buffer.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    void RingBuffer<T, N, Policy>::push(const T& value) {
+        pushValue(value);
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.push (move)
+     * Description: Same as push, but the value is moved into the buffer instead of copied.
+     * Parameters: value - The value to be moved into the buffer.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    void RingBuffer<T, N, Policy>::push(T&& value) {
+        pushValue(std::move(value));
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.emplace
+     * Description: Constructs a new element in place from the given arguments. When full, OverflowPolicy::Overwrite
+     *              destroys the oldest element and builds the new one in its slot, OverflowPolicy::Reject throws.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    template<typename... Args>
+    T& RingBuffer<T, N, Policy>::emplace(Args&&... args) {
+        if (isFull()) {
+            if constexpr (Policy == OverflowPolicy::Overwrite) {
+                consume(1); // Frees the oldest slot, which is where the new element goes
+            } else {
+                throw std::runtime_error("RingBuffer is full and not in overwrite-only mode");
+            }
+        }
+        T* added = std::construct_at(slotAddress(wrap(head + count)), std::forward<Args>(args)...);
+        count++;
+        return *added;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.pushValue
+     * Description: Adds a new element (copied from an lvalue, moved from an rvalue) following the overflow policy.
+     * Parameters: value - The value to be added to the buffer.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    template<typename U>
+    void RingBuffer<T, N, Policy>::pushValue(U&& value) {
+        if (isFull()) {
+            if constexpr (Policy == OverflowPolicy::Overwrite) {
+                slot(head) = std::forward<U>(value); // Reuse the oldest slot in place (tail == head when full)
+                head = wrap(head + 1);
+                return;
+            } else {
+                throw std::runtime_error("RingBuffer is full and not in overwrite-only mode");
+            }
+        }
+        std::construct_at(slotAddress(wrap(head + count)), std::forward<U>(value));
+        count++;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.pop
+     * Description: Removes and returns the oldest element from the buffer.
+     * Parameters: None
+     * Returns: T - The value of the removed element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    T RingBuffer<T, N, Policy>::pop() {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
+        }
+        T value = std::move(slot(head)); // Move the data out, consume() then destroys the moved-from slot
+        consume(1);
+        return value;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.pop_back
+     * Description: Removes and returns the most recently added element, undoing the last push.
+     * Parameters: None
+     * Returns: T - The value of the removed element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    T RingBuffer<T, N, Policy>::pop_back() {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
+        }
+        T& newest = slot(wrap(head + count - 1));
+        T value = std::move(newest);
+        std::destroy_at(&newest);
+        count--;
+        return value;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.front
+     * Description: Returns the oldest element without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the oldest element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    T& RingBuffer<T, N, Policy>::front() const {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
+        }
+        return slot(head);
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.back
+     * Description: Returns the most recently added element without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the most recently added element.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    T& RingBuffer<T, N, Policy>::back() const {
+        if (isEmpty()) {
+            throw std::out_of_range("RingBuffer is empty");
+        }
+        return slot(wrap(head + count - 1));
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.clear
+     * Description: Clears the buffer, destroying all elements.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    void RingBuffer<T, N, Policy>::clear() {
+        consume(count);
+        head = 0;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.peek_contiguous
+     * Description: Returns the stored elements, oldest first, as spans into the inline storage (see RingBuffer<T>::peek_contiguous).
+     *              A segment that holds no elements is an empty span, slots without a live T are never laundered.
+     * Parameters: None
+     * Returns: std::array<std::span<T>, 2> - The two segments, first then second.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    std::array<std::span<T>, 2> RingBuffer<T, N, Policy>::peek_contiguous() const {
+        std::array<std::span<T>, 2> segments{};
+        if (count == 0) {
+            return segments;
+        }
+        size_t firstBlock = std::min(count, N - head);
+        segments[0] = std::span<T>(&slot(head), firstBlock);
+        if (count > firstBlock) {
+            segments[1] = std::span<T>(&slot(0), count - firstBlock); // Only when the data wraps is slot 0 live
+        }
+        return segments;
+    }
+
+    /*
+     * Name: RingBuffer<T, N>.consume
+     * Description: Removes the oldest n elements.
+     * Parameters: n - The number of elements to remove.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t N, OverflowPolicy Policy> requires (N != DynamicCapacity)
+    void RingBuffer<T, N, Policy>::consume(size_t n) {
+        if (n > count) {
+            throw std::out_of_range("RingBuffer cannot consume more elements than it holds");
+        }
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < n; i++) {
+                std::destroy_at(&slot(wrap(head + i)));
+            }
+        }
+        head = wrap(head + n);
+        count -= n;
+    }
 
 }
 
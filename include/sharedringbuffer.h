@@ -0,0 +1,431 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef SHAREDRINGBUFFER_H
+#define SHAREDRINGBUFFER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/* Notes:
+ * Ring buffer that lives in a POSIX shared-memory object, so two processes (e.g. acquisition and uplink) can exchange
+ * samples through the same memory instead of a socket. One process creates it by name, the other attaches by name.
+ * Like SpscRingBuffer there is exactly one producer and one consumer (they are usually in different processes).
+ * Only trivially copyable T is allowed: the elements are plain bytes shared by two address spaces.
+ *
+ * Functions in the shared ring buffer class:
+ * try_push - (producer) Adds a new element, returns false if the buffer is full (overwrite mode always succeeds).
+ * try_pop - (consumer) Removes the oldest element into out, returns false if the buffer is empty (see overwrite mode).
+ * peek_contiguous - (consumer) Returns the stored elements as at most two spans that point straight into the shared memory.
+ * consume - (consumer) Removes the oldest n elements after reading them through peek_contiguous.
+ * (peek_contiguous and consume are not available in overwrite mode and throw std::logic_error there.)
+ * getSize - Returns the number of elements in the buffer (snapshot).
+ * isEmpty - Checks if the buffer is empty (snapshot).
+ * isFull - Checks if the buffer is full (snapshot).
+ * capacity - Returns the maximum number of elements the buffer can hold.
+ * isOverwriteOnly - Checks if the buffer is in overwrite-oldest mode.
+ * getName - Returns the shared-memory name.
+ *
+ * Shared layout:
+ * [Header][padding][slot 0][slot 1]...[slot capacity - 1]
+ * The header only holds sizes and the free-running head/tail counters (as in SpscRingBuffer), never pointers, because
+ * each process maps the region at a different address. Each process computes its own slot pointer from its mapping.
+ * The producer's cached head and the consumer's cached tail are kept in the process-local object, not in shared memory.
+ * An attaching process checks every header field before using it, a corrupt or foreign object is refused.
+ *
+ * Overwrite mode:
+ * Same protocol as SpscRingBuffer<T, OverflowPolicy::Overwrite>: every slot is a seqlock (a sequence counter plus the
+ * element as 64-bit relaxed atomics), only the consumer moves head, and try_pop returns false when the element it was
+ * reading got overwritten. The slots are then not plain T, which is why peek_contiguous cannot hand out spans there.
+ *
+ * Lifetime:
+ * The creating process owns the name and unlinks it in its destructor. Processes that already attached keep their
+ * mapping until they are destroyed, new attaches fail after that. Creating replaces any stale object with the same name
+ * (e.g. left behind by a crashed run).
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class SharedRingBuffer {
+        static_assert(std::is_trivially_copyable_v<T>, "SharedRingBuffer requires a trivially copyable type");
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "SharedRingBuffer needs lock-free 64-bit atomics to share them between processes");
+    public:
+        SharedRingBuffer(const std::string& name, size_t capacity, bool overwrite = false); // Creates the shared buffer
+        explicit SharedRingBuffer(const std::string& name);                                 // Attaches to a buffer created by another process
+        ~SharedRingBuffer();
+        SharedRingBuffer(const SharedRingBuffer&) = delete;            // Owns a mapping (and maybe the name), cannot be copied
+        SharedRingBuffer& operator=(const SharedRingBuffer&) = delete;
+        bool try_push(const T& value);                                 // Producer only: adds a new element, false if full
+        bool try_pop(T& out);                                          // Consumer only: removes the oldest element into out, false if empty
+        std::array<std::span<const T>, 2> peek_contiguous();           // Consumer only: stored elements as at most two spans into shared memory (not in overwrite mode)
+        void consume(size_t n);                                        // Consumer only: removes the oldest n elements (not in overwrite mode)
+        [[nodiscard]] size_t getSize() const;                          // Number of elements currently in the buffer (snapshot)
+        [[nodiscard]] bool isEmpty() const { return getSize() == 0; }  // Checks if the buffer is empty (snapshot)
+        [[nodiscard]] bool isFull() const { return getSize() >= maxCapacity; } // Checks if the buffer is full (snapshot)
+        [[nodiscard]] size_t capacity() const { return maxCapacity; }  // Maximum number of elements (rounded up to a power of two)
+        [[nodiscard]] bool isOverwriteOnly() const { return header->overwrite != 0; } // Checks if the buffer is in overwrite-oldest mode
+        [[nodiscard]] const std::string& getName() const { return shmName; } // Shared-memory object name
+
+    private:
+        static constexpr uint64_t magicValue = 0x434d4e4452494e47ULL; // "CMNDRING"
+        static constexpr uint32_t layoutVersion = 2;
+        static constexpr size_t cacheLineSize = 64;
+        static constexpr size_t wordCount = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t); // Words per element in overwrite mode
+
+        struct SeqlockSlot {                         // Overwrite-mode slot (see SpscRingBuffer)
+            std::atomic<uint64_t> sequence;          // 2 * (counter + 1) once the element is written, odd while it is being written
+            std::atomic<uint64_t> words[wordCount];  // The element's bytes
+        };
+
+        // Everything in here is position independent: sizes and counters only
+        struct Header {
+            std::atomic<uint64_t> magic;             // Set last by the creator, attachers refuse a header without it
+            uint32_t version;                        // Layout version, bumped if this struct or the slot layout changes
+            uint32_t elementSize;                    // sizeof(T) of the creator, catches mismatched types
+            uint64_t capacity;                       // Number of slots (power of two)
+            uint64_t slotsOffset;                    // Byte offset of slot 0 from the start of the region
+            uint32_t overwrite;                      // Overwrite-oldest mode flag
+            alignas(cacheLineSize) std::atomic<uint64_t> head; // Counter of the oldest element (consumer)
+            alignas(cacheLineSize) std::atomic<uint64_t> tail; // Counter of the next slot to write (producer)
+        };
+
+        std::string shmName;    // Name passed to shm_open (always starts with '/')
+        bool owner;             // True in the creating process, which unlinks the name
+        int fd;                 // Shared-memory file descriptor
+        void* mapping;          // Start of this process's mapping
+        size_t mappingSize;     // Length of the mapping in bytes
+        Header* header;         // Header at the start of the mapping
+        T* slots;               // First slot in this process's mapping (normal mode)
+        SeqlockSlot* seqlockSlots; // First slot in this process's mapping (overwrite mode)
+        size_t maxCapacity;     // Copy of header->capacity
+        size_t mask;            // maxCapacity - 1
+        uint64_t cachedHead;    // Producer's last seen head (process-local)
+        uint64_t cachedTail;    // Consumer's last seen tail (process-local)
+
+        static std::string normalizeName(const std::string& name) { return (!name.empty() && name[0] == '/') ? name : "/" + name; }
+        static size_t slotSize(bool overwrite) { return overwrite ? sizeof(SeqlockSlot) : sizeof(T); } // Bytes per slot in each mode
+        void mapRegion(size_t size);
+        void release();
+    };
+
+    /*
+     * Name: SharedRingBuffer constructor (create)
+     * Description: Creates the shared-memory object, sizes it for capacity elements and initializes the header.
+     *              The capacity is rounded up to the next power of two.
+     * Parameters: name - Shared-memory name (a leading '/' is added if missing).
+     *             capacity - The minimum number of elements the buffer can hold.
+     *             overwrite - A flag indicating if push should drop the oldest element when full (default is false).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    SharedRingBuffer<T>::SharedRingBuffer(const std::string& name, size_t capacity, bool overwrite)
+        : shmName(normalizeName(name)), owner(true), fd(-1), mapping(nullptr), mappingSize(0), header(nullptr), slots(nullptr),
+          seqlockSlots(nullptr), maxCapacity(0), mask(0), cachedHead(0), cachedTail(0) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SharedRingBuffer capacity must be greater than zero");
+        }
+        maxCapacity = std::bit_ceil(capacity);
+        mask = maxCapacity - 1;
+        const size_t slotAlignment = std::max({alignof(T), alignof(SeqlockSlot), cacheLineSize});
+        const size_t slotsOffset = (sizeof(Header) + slotAlignment - 1) / slotAlignment * slotAlignment;
+
+        shm_unlink(shmName.c_str()); // Replace a stale object from an earlier run, if any
+        fd = shm_open(shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "SharedRingBuffer shm_open " + shmName);
+        }
+        const size_t size = slotsOffset + maxCapacity * slotSize(overwrite);
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            int error = errno;
+            release();
+            throw std::system_error(error, std::generic_category(), "SharedRingBuffer ftruncate " + shmName);
+        }
+        mapRegion(size);
+
+        // A fresh shared-memory object is zero filled, construct the header in place and publish it last
+        header = new (mapping) Header{};
+        header->version = layoutVersion;
+        header->elementSize = sizeof(T);
+        header->capacity = maxCapacity;
+        header->slotsOffset = slotsOffset;
+        header->overwrite = overwrite ? 1 : 0;
+        unsigned char* firstSlot = static_cast<unsigned char*>(mapping) + slotsOffset;
+        if (overwrite) {
+            seqlockSlots = reinterpret_cast<SeqlockSlot*>(firstSlot);
+            for (size_t i = 0; i < maxCapacity; i++) {
+                new (seqlockSlots + i) SeqlockSlot{}; // Sequence 0: no element written yet
+            }
+        } else {
+            slots = reinterpret_cast<T*>(firstSlot);
+        }
+        header->magic.store(magicValue, std::memory_order_release);
+    }
+
+    /*
+     * Name: SharedRingBuffer constructor (attach)
+     * Description: Opens and maps a buffer created by another process and checks that its layout matches T.
+     * Parameters: name - Shared-memory name used by the creator (a leading '/' is added if missing).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    SharedRingBuffer<T>::SharedRingBuffer(const std::string& name)
+        : shmName(normalizeName(name)), owner(false), fd(-1), mapping(nullptr), mappingSize(0), header(nullptr), slots(nullptr),
+          seqlockSlots(nullptr), maxCapacity(0), mask(0), cachedHead(0), cachedTail(0) {
+        fd = shm_open(shmName.c_str(), O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "SharedRingBuffer shm_open " + shmName);
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            int error = errno;
+            release();
+            throw std::system_error(error, std::generic_category(), "SharedRingBuffer fstat " + shmName);
+        }
+        if (static_cast<size_t>(info.st_size) < sizeof(Header)) {
+            release();
+            throw std::runtime_error("SharedRingBuffer " + shmName + " is not initialized yet");
+        }
+        mapRegion(static_cast<size_t>(info.st_size));
+        header = static_cast<Header*>(mapping);
+        if (header->magic.load(std::memory_order_acquire) != magicValue || header->version != layoutVersion) {
+            release();
+            throw std::runtime_error("SharedRingBuffer " + shmName + " has no valid header");
+        }
+        if (header->elementSize != sizeof(T)) {
+            release();
+            throw std::runtime_error("SharedRingBuffer " + shmName + " was created for a different element type");
+        }
+        // Checked before anything is derived from them: the mask needs a power of two, and capacity * slot size is
+        // compared by division so a huge capacity cannot wrap the bound
+        const bool overwrite = header->overwrite != 0;
+        const uint64_t capacity = header->capacity;
+        const uint64_t slotsOffset = header->slotsOffset;
+        if (header->overwrite > 1 || !std::has_single_bit(capacity) || capacity > SIZE_MAX ||
+            slotsOffset < sizeof(Header) || slotsOffset % std::max(alignof(T), alignof(SeqlockSlot)) != 0 ||
+            slotsOffset > mappingSize || capacity > (mappingSize - slotsOffset) / slotSize(overwrite)) {
+            release();
+            throw std::runtime_error("SharedRingBuffer " + shmName + " has an invalid layout");
+        }
+        maxCapacity = static_cast<size_t>(capacity);
+        mask = maxCapacity - 1;
+        unsigned char* firstSlot = static_cast<unsigned char*>(mapping) + slotsOffset;
+        if (overwrite) {
+            seqlockSlots = reinterpret_cast<SeqlockSlot*>(firstSlot);
+        } else {
+            slots = reinterpret_cast<T*>(firstSlot);
+        }
+        cachedHead = header->head.load(std::memory_order_acquire);
+        cachedTail = header->tail.load(std::memory_order_acquire);
+    }
+
+    /*
+     * Name: SharedRingBuffer destructor
+     * Description: Unmaps the region and closes it. The creating process also unlinks the name.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    SharedRingBuffer<T>::~SharedRingBuffer() {
+        release();
+    }
+
+    /*
+     * Name: SharedRingBuffer.mapRegion
+     * Description: Maps size bytes of the shared-memory object read/write into this process.
+     * Parameters: size - Number of bytes to map.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void SharedRingBuffer<T>::mapRegion(size_t size) {
+        void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            int error = errno;
+            release();
+            throw std::system_error(error, std::generic_category(), "SharedRingBuffer mmap " + shmName);
+        }
+        mapping = address;
+        mappingSize = size;
+    }
+
+    /*
+     * Name: SharedRingBuffer.release
+     * Description: Undoes whatever part of the setup has happened (mapping, descriptor, name).
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void SharedRingBuffer<T>::release() {
+        if (mapping) {
+            munmap(mapping, mappingSize);
+            mapping = nullptr;
+        }
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+        if (owner) {
+            shm_unlink(shmName.c_str());
+            owner = false;
+        }
+    }
+
+    /*
+     * Name: SharedRingBuffer.try_push
+     * Description: Adds a new element to the buffer. Producer only. Same protocol as SpscRingBuffer::try_push, in overwrite
+     *              mode a full buffer loses its oldest element.
+     * Parameters: value - The value to be added to the buffer.
+     * Returns: bool - True if the value was added, false if the buffer is full (never false in overwrite mode).
+     */
+    template<typename T>
+    bool SharedRingBuffer<T>::try_push(const T& value) {
+        const uint64_t currentTail = header->tail.load(std::memory_order_relaxed);
+        if (seqlockSlots) {
+            // Seqlock write, the slot may still hold the oldest element
+            uint64_t words[wordCount] = {};
+            std::memcpy(words, std::addressof(value), sizeof(T));
+            SeqlockSlot& slot = seqlockSlots[currentTail & mask];
+            slot.sequence.store(2 * currentTail + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release); // Keeps the word stores after the odd sequence
+            for (size_t i = 0; i < wordCount; i++) {
+                slot.words[i].store(words[i], std::memory_order_relaxed);
+            }
+            slot.sequence.store(2 * currentTail + 2, std::memory_order_release);
+        } else {
+            if (currentTail - cachedHead >= maxCapacity) {
+                cachedHead = header->head.load(std::memory_order_acquire);
+                if (currentTail - cachedHead >= maxCapacity) {
+                    return false;
+                }
+            }
+            slots[currentTail & mask] = value;
+        }
+        header->tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*
+     * Name: SharedRingBuffer.try_pop
+     * Description: Removes the oldest element from the buffer. Consumer only, wait-free. Same protocol as
+     *              SpscRingBuffer::try_pop: in overwrite mode an element written over during the read is dropped.
+     * Parameters: out - Receives the removed element (left untouched when false is returned).
+     * Returns: bool - True if an element was removed, false if the buffer is empty or the element was lost to the producer.
+     */
+    template<typename T>
+    bool SharedRingBuffer<T>::try_pop(T& out) {
+        uint64_t currentHead = header->head.load(std::memory_order_relaxed); // Only the consumer writes head
+        if (currentHead == cachedTail) {
+            cachedTail = header->tail.load(std::memory_order_acquire);
+            if (currentHead == cachedTail) {
+                return false;
+            }
+        }
+        if (!seqlockSlots) {
+            out = slots[currentHead & mask];
+            header->head.store(currentHead + 1, std::memory_order_release); // Hand the slot back to the producer
+            return true;
+        }
+        if (cachedTail - currentHead > maxCapacity) {
+            currentHead = cachedTail - maxCapacity; // The producer lapped us, older elements are gone
+        }
+        const uint64_t expected = 2 * currentHead + 2;
+        SeqlockSlot& slot = seqlockSlots[currentHead & mask];
+        uint64_t words[wordCount];
+        const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        for (size_t i = 0; i < wordCount; i++) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire); // Keeps the word loads before the second sequence load
+        const uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+        if (before == expected && after == expected) {
+            std::memcpy(std::addressof(out), words, sizeof(T));
+            header->head.store(currentHead + 1, std::memory_order_release);
+            return true;
+        }
+        // Overwritten while reading: drop it and everything the producer has lapped since
+        cachedTail = header->tail.load(std::memory_order_acquire);
+        header->head.store(std::max<uint64_t>(currentHead + 1, cachedTail - std::min<uint64_t>(cachedTail, maxCapacity)),
+                           std::memory_order_release);
+        return false;
+    }
+
+    /*
+     * Name: SharedRingBuffer.peek_contiguous
+     * Description: Returns the stored elements, oldest first, as spans into the shared memory so the consumer can read
+     *              (or serialize) them without copying. The second span is empty unless the data wraps around.
+     *              Not available in overwrite mode, where the producer may rewrite a slot while it is read.
+     * Parameters: None
+     * Returns: std::array<std::span<const T>, 2> - The two segments, first then second.
+     */
+    template<typename T>
+    std::array<std::span<const T>, 2> SharedRingBuffer<T>::peek_contiguous() {
+        if (seqlockSlots) {
+            throw std::logic_error("SharedRingBuffer::peek_contiguous is not available in overwrite mode, use try_pop");
+        }
+        const uint64_t currentHead = header->head.load(std::memory_order_relaxed);
+        cachedTail = header->tail.load(std::memory_order_acquire);
+        const size_t available = static_cast<size_t>(cachedTail - currentHead);
+        const size_t start = currentHead & mask;
+        const size_t firstBlock = std::min(available, maxCapacity - start);
+        return {std::span<const T>(slots + start, firstBlock), std::span<const T>(slots, available - firstBlock)};
+    }
+
+    /*
+     * Name: SharedRingBuffer.consume
+     * Description: Removes the oldest n elements, meant to commit a read done through peek_contiguous().
+     *              Not available in overwrite mode (see peek_contiguous).
+     * Parameters: n - The number of elements to remove.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void SharedRingBuffer<T>::consume(size_t n) {
+        if (seqlockSlots) {
+            throw std::logic_error("SharedRingBuffer::consume is not available in overwrite mode, use try_pop");
+        }
+        // Only the consumer moves head, so plain loads/stores are enough
+        const uint64_t currentHead = header->head.load(std::memory_order_relaxed);
+        if (n > cachedTail - currentHead) {
+            cachedTail = header->tail.load(std::memory_order_acquire);
+            if (n > cachedTail - currentHead) {
+                throw std::out_of_range("SharedRingBuffer cannot consume more elements than it holds");
+            }
+        }
+        header->head.store(currentHead + n, std::memory_order_release);
+    }
+
+    /*
+     * Name: SharedRingBuffer.getSize
+     * Description: Returns the number of elements in the buffer. Safe from either process, but only a snapshot.
+     * Parameters: None
+     * Returns: size_t - The number of elements in the buffer.
+     */
+    template<typename T>
+    size_t SharedRingBuffer<T>::getSize() const {
+        const uint64_t currentHead = header->head.load(std::memory_order_acquire);
+        const uint64_t currentTail = header->tail.load(std::memory_order_acquire);
+        if (currentTail <= currentHead) {
+            return 0;
+        }
+        return std::min<size_t>(currentTail - currentHead, maxCapacity);
+    }
+
+}
+
+#endif //SHAREDRINGBUFFER_H
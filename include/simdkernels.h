@@ -0,0 +1,452 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define COMMANDA_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define COMMANDA_SIMD_X86 0
+#endif
+/* Notes:
+ * Numeric kernels over float / double samples, for running over a whole RingBuffer window in one vectorized pass.
+ * Every kernel takes either a span or a RingBuffer<T> / RingBuffer<T, N> and walks the buffer's one or two contiguous
+ * segments (peek_contiguous()) straight in the slot array, no copy, no iterator. SharedRingBuffer consumers can pass the
+ * spans from their own peek_contiguous() to the span versions.
+ *
+ * Functions in the Kernels namespace:
+ * sum - Returns the sum of the samples.
+ * dot - Returns the dot product of the samples with a weight vector of the same length (FIR taps, calibration curves).
+ * minMax - Returns the smallest and largest sample as a pair.
+ * rms - Returns the root mean square of the samples.
+ * scaleOffset - Applies x = x * scale + offset to every sample in place (sensor calibration).
+ * detectedSimdLevel - Returns the best instruction set the CPU supports.
+ * activeSimdLevel - Returns the instruction set the kernels currently use.
+ * setSimdLevel - Forces a lower instruction set (benchmarks, comparing against the scalar results), clamped to what the CPU has.
+ *
+ * Dispatch:
+ * On x86 with GCC / Clang there are SSE2 and AVX2 versions of each kernel, compiled with per-function target attributes so
+ * the rest of the program does not need -mavx2. The CPU is checked once and every call switches on the cached level.
+ * Other platforms / compilers only get the scalar loops.
+ * The vector paths add in a different order than the scalar loop, so float sums can differ in the last bits.
+ */
+
+namespace CommandaStructures::Kernels {
+
+    enum class SimdLevel {
+        Scalar, // Plain loops
+        Sse2,   // 128-bit vectors
+        Avx2    // 256-bit vectors
+    };
+
+    namespace Detail {
+
+        /* Scalar fallback, also used for the tails the vector loops leave over */
+        namespace Scalar {
+            template<typename T>
+            T sum(const T* data, size_t n) {
+                T total = 0;
+                for (size_t i = 0; i < n; i++) total += data[i];
+                return total;
+            }
+
+            template<typename T>
+            T dot(const T* a, const T* b, size_t n) {
+                T total = 0;
+                for (size_t i = 0; i < n; i++) total += a[i] * b[i];
+                return total;
+            }
+
+            template<typename T>
+            void minMax(const T* data, size_t n, T& low, T& high) {
+                for (size_t i = 0; i < n; i++) {
+                    low = std::min(low, data[i]);
+                    high = std::max(high, data[i]);
+                }
+            }
+
+            template<typename T>
+            void scaleOffset(T* data, size_t n, T scale, T offset) {
+                for (size_t i = 0; i < n; i++) data[i] = data[i] * scale + offset;
+            }
+        }
+
+#if COMMANDA_SIMD_X86
+#define COMMANDA_SSE2 __attribute__((target("sse2")))
+#define COMMANDA_AVX2 __attribute__((target("avx2")))
+
+        /* SSE2: 4 floats / 2 doubles per vector. The helpers are overloaded on float / double so each kernel is written once */
+        namespace Sse2 {
+            COMMANDA_SSE2 inline __m128 load(const float* p) { return _mm_loadu_ps(p); }
+            COMMANDA_SSE2 inline __m128d load(const double* p) { return _mm_loadu_pd(p); }
+            COMMANDA_SSE2 inline void store(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+            COMMANDA_SSE2 inline void store(double* p, __m128d v) { _mm_storeu_pd(p, v); }
+            COMMANDA_SSE2 inline __m128 broadcast(float x) { return _mm_set1_ps(x); }
+            COMMANDA_SSE2 inline __m128d broadcast(double x) { return _mm_set1_pd(x); }
+            COMMANDA_SSE2 inline __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+            COMMANDA_SSE2 inline __m128d add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+            COMMANDA_SSE2 inline __m128 mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+            COMMANDA_SSE2 inline __m128d mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+            COMMANDA_SSE2 inline __m128 min(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+            COMMANDA_SSE2 inline __m128d min(__m128d a, __m128d b) { return _mm_min_pd(a, b); }
+            COMMANDA_SSE2 inline __m128 max(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+            COMMANDA_SSE2 inline __m128d max(__m128d a, __m128d b) { return _mm_max_pd(a, b); }
+
+            template<typename T>
+            COMMANDA_SSE2 T sum(const T* data, size_t n) {
+                constexpr size_t width = 16 / sizeof(T);
+                auto first = broadcast(T(0));
+                auto second = first; // Two accumulators hide the add latency
+                size_t i = 0;
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    first = add(first, load(data + i));
+                    second = add(second, load(data + i + width));
+                }
+                T lanes[width];
+                store(lanes, add(first, second));
+                return Scalar::sum(lanes, width) + Scalar::sum(data + i, n - i);
+            }
+
+            template<typename T>
+            COMMANDA_SSE2 T dot(const T* a, const T* b, size_t n) {
+                constexpr size_t width = 16 / sizeof(T);
+                auto first = broadcast(T(0));
+                auto second = first;
+                size_t i = 0;
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    first = add(first, mul(load(a + i), load(b + i)));
+                    second = add(second, mul(load(a + i + width), load(b + i + width)));
+                }
+                T lanes[width];
+                store(lanes, add(first, second));
+                return Scalar::sum(lanes, width) + Scalar::dot(a + i, b + i, n - i);
+            }
+
+            template<typename T>
+            COMMANDA_SSE2 void minMax(const T* data, size_t n, T& low, T& high) {
+                constexpr size_t width = 16 / sizeof(T);
+                size_t i = 0;
+                if (n >= width) {
+                    auto lows = load(data);
+                    auto highs = lows;
+                    for (i = width; i + width <= n; i += width) {
+                        auto v = load(data + i);
+                        lows = min(lows, v);
+                        highs = max(highs, v);
+                    }
+                    T lanes[width];
+                    store(lanes, lows);
+                    Scalar::minMax(lanes, width, low, high);
+                    store(lanes, highs);
+                    Scalar::minMax(lanes, width, low, high);
+                }
+                Scalar::minMax(data + i, n - i, low, high);
+            }
+
+            template<typename T>
+            COMMANDA_SSE2 void scaleOffset(T* data, size_t n, T scale, T offset) {
+                constexpr size_t width = 16 / sizeof(T);
+                const auto scales = broadcast(scale);
+                const auto offsets = broadcast(offset);
+                size_t i = 0;
+                for (; i + width <= n; i += width) {
+                    store(data + i, add(mul(load(data + i), scales), offsets));
+                }
+                Scalar::scaleOffset(data + i, n - i, scale, offset);
+            }
+        }
+
+        /* AVX2: 8 floats / 4 doubles per vector, same kernels as SSE2 */
+        namespace Avx2 {
+            COMMANDA_AVX2 inline __m256 load(const float* p) { return _mm256_loadu_ps(p); }
+            COMMANDA_AVX2 inline __m256d load(const double* p) { return _mm256_loadu_pd(p); }
+            COMMANDA_AVX2 inline void store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+            COMMANDA_AVX2 inline void store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+            COMMANDA_AVX2 inline __m256 broadcast(float x) { return _mm256_set1_ps(x); }
+            COMMANDA_AVX2 inline __m256d broadcast(double x) { return _mm256_set1_pd(x); }
+            COMMANDA_AVX2 inline __m256 add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+            COMMANDA_AVX2 inline __m256d add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+            COMMANDA_AVX2 inline __m256 mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+            COMMANDA_AVX2 inline __m256d mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+            COMMANDA_AVX2 inline __m256 min(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+            COMMANDA_AVX2 inline __m256d min(__m256d a, __m256d b) { return _mm256_min_pd(a, b); }
+            COMMANDA_AVX2 inline __m256 max(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+            COMMANDA_AVX2 inline __m256d max(__m256d a, __m256d b) { return _mm256_max_pd(a, b); }
+
+            template<typename T>
+            COMMANDA_AVX2 T sum(const T* data, size_t n) {
+                constexpr size_t width = 32 / sizeof(T);
+                auto first = broadcast(T(0));
+                auto second = first;
+                size_t i = 0;
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    first = add(first, load(data + i));
+                    second = add(second, load(data + i + width));
+                }
+                T lanes[width];
+                store(lanes, add(first, second));
+                return Scalar::sum(lanes, width) + Scalar::sum(data + i, n - i);
+            }
+
+            template<typename T>
+            COMMANDA_AVX2 T dot(const T* a, const T* b, size_t n) {
+                constexpr size_t width = 32 / sizeof(T);
+                auto first = broadcast(T(0));
+                auto second = first;
+                size_t i = 0;
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    first = add(first, mul(load(a + i), load(b + i)));
+                    second = add(second, mul(load(a + i + width), load(b + i + width)));
+                }
+                T lanes[width];
+                store(lanes, add(first, second));
+                return Scalar::sum(lanes, width) + Scalar::dot(a + i, b + i, n - i);
+            }
+
+            template<typename T>
+            COMMANDA_AVX2 void minMax(const T* data, size_t n, T& low, T& high) {
+                constexpr size_t width = 32 / sizeof(T);
+                size_t i = 0;
+                if (n >= width) {
+                    auto lows = load(data);
+                    auto highs = lows;
+                    for (i = width; i + width <= n; i += width) {
+                        auto v = load(data + i);
+                        lows = min(lows, v);
+                        highs = max(highs, v);
+                    }
+                    T lanes[width];
+                    store(lanes, lows);
+                    Scalar::minMax(lanes, width, low, high);
+                    store(lanes, highs);
+                    Scalar::minMax(lanes, width, low, high);
+                }
+                Scalar::minMax(data + i, n - i, low, high);
+            }
+
+            template<typename T>
+            COMMANDA_AVX2 void scaleOffset(T* data, size_t n, T scale, T offset) {
+                constexpr size_t width = 32 / sizeof(T);
+                const auto scales = broadcast(scale);
+                const auto offsets = broadcast(offset);
+                size_t i = 0;
+                for (; i + width <= n; i += width) {
+                    store(data + i, add(mul(load(data + i), scales), offsets));
+                }
+                Scalar::scaleOffset(data + i, n - i, scale, offset);
+            }
+        }
+
+#undef COMMANDA_SSE2
+#undef COMMANDA_AVX2
+#endif
+
+        inline SimdLevel detect() {
+#if COMMANDA_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+            if (__builtin_cpu_supports("sse2")) return SimdLevel::Sse2;
+#endif
+            return SimdLevel::Scalar;
+        }
+    }
+
+    /*
+     * Name: detectedSimdLevel
+     * Description: Returns the best instruction set this CPU supports (checked once, then cached).
+     * Parameters: None
+     * Returns: SimdLevel - The detected level.
+     */
+    inline SimdLevel detectedSimdLevel() {
+        static const SimdLevel level = Detail::detect();
+        return level;
+    }
+
+    namespace Detail {
+        inline std::atomic<SimdLevel>& activeLevel() {
+            static std::atomic<SimdLevel> level{detectedSimdLevel()};
+            return level;
+        }
+
+// Calls Namespace::kernel(args...) for the active instruction set
+#if COMMANDA_SIMD_X86
+#define COMMANDA_DISPATCH(kernel, ...)                                                   \
+        switch (activeLevel().load(std::memory_order_relaxed)) {                         \
+            case SimdLevel::Avx2: return Avx2::kernel(__VA_ARGS__);                      \
+            case SimdLevel::Sse2: return Sse2::kernel(__VA_ARGS__);                      \
+            default: return Scalar::kernel(__VA_ARGS__);                                 \
+        }
+#else
+#define COMMANDA_DISPATCH(kernel, ...) return Scalar::kernel(__VA_ARGS__);
+#endif
+
+        template<typename T>
+        T sum(const T* data, size_t n) { COMMANDA_DISPATCH(sum, data, n) }
+
+        template<typename T>
+        T dot(const T* a, const T* b, size_t n) { COMMANDA_DISPATCH(dot, a, b, n) }
+
+        template<typename T>
+        void minMax(const T* data, size_t n, T& low, T& high) { COMMANDA_DISPATCH(minMax, data, n, low, high) }
+
+        template<typename T>
+        void scaleOffset(T* data, size_t n, T scale, T offset) { COMMANDA_DISPATCH(scaleOffset, data, n, scale, offset) }
+
+#undef COMMANDA_DISPATCH
+
+        template<typename T>
+        std::pair<T, T> minMax(std::span<const T> first, std::span<const T> second) {
+            if (first.empty() && second.empty()) {
+                throw std::out_of_range("minMax of an empty range");
+            }
+            T low = first.empty() ? second[0] : first[0];
+            T high = low;
+            minMax(first.data(), first.size(), low, high);
+            minMax(second.data(), second.size(), low, high);
+            return {low, high};
+        }
+
+        template<typename T>
+        T dot(std::span<const T> first, std::span<const T> second, std::span<const T> weights) {
+            if (weights.size() != first.size() + second.size()) {
+                throw std::invalid_argument("dot needs as many weights as samples");
+            }
+            return dot(first.data(), weights.data(), first.size()) +
+                   dot(second.data(), weights.data() + first.size(), second.size());
+        }
+
+        template<typename T>
+        T rms(std::span<const T> first, std::span<const T> second) {
+            const size_t n = first.size() + second.size();
+            if (n == 0) {
+                return T(0);
+            }
+            const T squares = dot(first.data(), first.data(), first.size()) + dot(second.data(), second.data(), second.size());
+            return std::sqrt(squares / static_cast<T>(n));
+        }
+    }
+
+    // Anything with a const peek_contiguous(): RingBuffer<T>, RingBuffer<T, N>
+    template<typename Buffer>
+    concept ContiguousSegments = requires(const Buffer& buffer) { buffer.peek_contiguous()[1].data(); };
+
+    // Sample type of such a buffer (float or double)
+    template<typename Buffer>
+    using SampleOf = std::remove_const_t<typename std::remove_cvref_t<decltype(std::declval<const Buffer&>().peek_contiguous()[0])>::element_type>;
+
+    /*
+     * Name: activeSimdLevel
+     * Description: Returns the instruction set the kernels currently dispatch to.
+     * Parameters: None
+     * Returns: SimdLevel - The active level.
+     */
+    inline SimdLevel activeSimdLevel() {
+        return Detail::activeLevel().load(std::memory_order_relaxed);
+    }
+
+    /*
+     * Name: setSimdLevel
+     * Description: Selects the instruction set for all following kernel calls. Levels the CPU does not have are clamped down.
+     * Parameters: level - The requested level.
+     * Returns: SimdLevel - The level actually selected.
+     */
+    inline SimdLevel setSimdLevel(SimdLevel level) {
+        level = std::min(level, detectedSimdLevel());
+        Detail::activeLevel().store(level, std::memory_order_relaxed);
+        return level;
+    }
+
+    /*
+     * Name: sum
+     * Description: Returns the sum of the samples.
+     * Parameters: samples - The samples (a span, or a ring buffer whose segments are summed in place).
+     * Returns: float / double - The sum (0 for no samples).
+     */
+    inline float sum(std::span<const float> samples) { return Detail::sum(samples.data(), samples.size()); }
+    inline double sum(std::span<const double> samples) { return Detail::sum(samples.data(), samples.size()); }
+
+    template<ContiguousSegments Buffer>
+    auto sum(const Buffer& buffer) {
+        auto segments = buffer.peek_contiguous();
+        return sum(segments[0]) + sum(segments[1]);
+    }
+
+    /*
+     * Name: dot
+     * Description: Returns the dot product of the samples with a weight vector, weights[0] goes with the oldest sample.
+     * Parameters: samples - The samples (a span, or a ring buffer).
+     *             weights - One weight per sample.
+     * Returns: float / double - The dot product.
+     */
+    inline float dot(std::span<const float> samples, std::span<const float> weights) { return Detail::dot<float>(samples, {}, weights); }
+    inline double dot(std::span<const double> samples, std::span<const double> weights) { return Detail::dot<double>(samples, {}, weights); }
+
+    template<ContiguousSegments Buffer>
+    SampleOf<Buffer> dot(const Buffer& buffer, std::span<const SampleOf<Buffer>> weights) {
+        auto segments = buffer.peek_contiguous();
+        return Detail::dot<SampleOf<Buffer>>(segments[0], segments[1], weights);
+    }
+
+    /*
+     * Name: minMax
+     * Description: Returns the smallest and the largest sample in one pass.
+     * Parameters: samples - The samples (a span, or a ring buffer), must not be empty.
+     * Returns: std::pair - {min, max}.
+     */
+    inline std::pair<float, float> minMax(std::span<const float> samples) { return Detail::minMax<float>(samples, {}); }
+    inline std::pair<double, double> minMax(std::span<const double> samples) { return Detail::minMax<double>(samples, {}); }
+
+    template<ContiguousSegments Buffer>
+    auto minMax(const Buffer& buffer) {
+        auto segments = buffer.peek_contiguous();
+        return Detail::minMax<SampleOf<Buffer>>(segments[0], segments[1]);
+    }
+
+    /*
+     * Name: rms
+     * Description: Returns the root mean square of the samples.
+     * Parameters: samples - The samples (a span, or a ring buffer).
+     * Returns: float / double - The RMS value (0 for no samples).
+     */
+    inline float rms(std::span<const float> samples) { return Detail::rms<float>(samples, {}); }
+    inline double rms(std::span<const double> samples) { return Detail::rms<double>(samples, {}); }
+
+    template<ContiguousSegments Buffer>
+    auto rms(const Buffer& buffer) {
+        auto segments = buffer.peek_contiguous();
+        return Detail::rms<SampleOf<Buffer>>(segments[0], segments[1]);
+    }
+
+    /*
+     * Name: scaleOffset
+     * Description: Calibrates the samples in place: x = x * scale + offset.
+     * Parameters: samples - The samples (a span, or a ring buffer whose slots are rewritten in place).
+     *             scale - The gain.
+     *             offset - The offset added after scaling.
+     * Returns: void - No return value.
+     */
+    inline void scaleOffset(std::span<float> samples, float scale, float offset) { Detail::scaleOffset(samples.data(), samples.size(), scale, offset); }
+    inline void scaleOffset(std::span<double> samples, double scale, double offset) { Detail::scaleOffset(samples.data(), samples.size(), scale, offset); }
+
+    template<ContiguousSegments Buffer>
+    void scaleOffset(Buffer& buffer, SampleOf<Buffer> scale, SampleOf<Buffer> offset) {
+        for (auto segment : buffer.peek_contiguous()) {
+            Detail::scaleOffset(segment.data(), segment.size(), scale, offset);
+        }
+    }
+
+}
+
+#endif //SIMDKERNELS_H
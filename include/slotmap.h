@@ -0,0 +1,274 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+/* Notes:
+ * Container for objects that are referenced from several places (tracked buoys, waypoints, obstacles). Instead of a
+ * node pointer, insert() hands out a SlotHandle: a 64-bit value made of a slot index and a generation. Looking a handle
+ * up, erasing it and checking it are O(1), and a handle whose object was erased is detected instead of reading freed or
+ * reused memory, so lists of handles (LinkedList<SlotHandle>, ...) can outlive the objects they refer to.
+ *
+ * Functions in the slot map class:
+ * insert - Adds an element (copies, or moves an rvalue), returns its handle. O(1) amortized.
+ * emplace - Constructs a new element in place, returns its handle. O(1) amortized.
+ * erase - Removes the element a handle refers to, returns false if the handle is stale. O(1).
+ * find - Returns a pointer to the element a handle refers to, or nullptr if the handle is stale. O(1).
+ * at - Same, but returns a reference and throws std::out_of_range for a stale handle.
+ * contains - Checks if a handle still refers to an element.
+ * handleAt - Returns the handle of the element at a position of the dense array (e.g. while iterating).
+ * getSize / isEmpty - Number of elements, empty check.
+ * reserve - Makes room for n elements without reallocating.
+ * clear - Removes every element, every handle handed out so far becomes stale.
+ * begin / end - Iterate over the elements in the dense array, in no particular order.
+ *
+ * How it works:
+ * The elements sit packed in one array (dense), so iterating over them is iterating over an array. A second array of
+ * slots maps a handle's index to the element's position in the dense array and holds the slot's generation. Erasing
+ * moves the last element into the hole (its slot is updated through a back-reference), frees the slot and bumps its
+ * generation, so every handle to the old element stops matching. Free slots form a linked list through their index
+ * field and are reused first. Positions in the dense array (and pointers to elements) change when an element is
+ * erased or the array grows, handles do not.
+ * Generations are 32-bit; a handle could only be mistaken for a new element after its slot has been reused 2^32 times.
+ */
+
+namespace CommandaStructures {
+
+    // Stable reference to an element of a SlotMap. The default handle is null and never refers to anything.
+    class SlotHandle {
+    public:
+        SlotHandle() : bits(0) {}
+        SlotHandle(uint32_t index, uint32_t generation) : bits((static_cast<uint64_t>(generation) << 32) | index) {}
+        [[nodiscard]] uint32_t index() const { return static_cast<uint32_t>(bits); }            // Slot index
+        [[nodiscard]] uint32_t generation() const { return static_cast<uint32_t>(bits >> 32); } // Slot generation when the handle was made
+        [[nodiscard]] uint64_t value() const { return bits; }                                   // Both packed in 64 bits (for hashing, serializing)
+        [[nodiscard]] bool isNull() const { return bits == 0; }                                 // Checks if this is the null handle
+        bool operator==(const SlotHandle& other) const { return bits == other.bits; }
+        bool operator!=(const SlotHandle& other) const { return bits != other.bits; }
+
+    private:
+        uint64_t bits;
+    };
+
+    template<typename T>
+    class SlotMap {
+    public:
+        SlotMap() = default;
+        template<typename... Args>
+        SlotHandle emplace(Args&&... args);                      // Constructs a new element in place, returns its handle
+        SlotHandle insert(const T& value) { return emplace(value); }            // Adds a copy of value, returns its handle
+        SlotHandle insert(T&& value) { return emplace(std::move(value)); }      // Same, but moves the value in
+        bool erase(SlotHandle handle);                           // Removes the element, false if the handle is stale
+        T* find(SlotHandle handle);                              // The element, or nullptr if the handle is stale
+        const T* find(SlotHandle handle) const;
+        T& at(SlotHandle handle);                                // The element, throws std::out_of_range if the handle is stale
+        const T& at(SlotHandle handle) const;
+        [[nodiscard]] bool contains(SlotHandle handle) const { return find(handle) != nullptr; } // Checks if the handle is live
+        SlotHandle handleAt(size_t position) const;              // Handle of the element at a position of the dense array
+        [[nodiscard]] int getSize() const { return static_cast<int>(dense.size()); } // Returns the number of elements
+        [[nodiscard]] bool isEmpty() const { return dense.empty(); }                 // Checks if the map is empty
+        void reserve(size_t n);                                  // Makes room for n elements
+        void clear();                                            // Removes every element, all handles become stale
+        // Forward iterator support, over the dense array
+        auto begin()        { return dense.begin(); }
+        auto end()          { return dense.end(); }
+        auto begin() const  { return dense.begin(); }
+        auto end() const    { return dense.end(); }
+        auto cbegin() const { return dense.cbegin(); }
+        auto cend() const   { return dense.cend(); }
+
+    private:
+        static constexpr uint32_t none = UINT32_MAX;             // End of the free list
+
+        struct Slot {
+            uint32_t index;                                      // Position in dense while in use, next free slot while free
+            uint32_t generation;                                 // Bumped on every erase, never 0
+        };
+
+        std::vector<T> dense;                                    // The elements, packed
+        std::vector<uint32_t> denseToSlot;                       // For every element, the slot that points at it
+        std::vector<Slot> slots;
+        uint32_t freeHead = none;                                // First free slot
+
+        const Slot* liveSlot(SlotHandle handle) const;           // The slot if the handle matches it, else nullptr
+    };
+
+    /*
+     * Name: SlotMap.emplace
+     * Description: Constructs a new element at the end of the dense array and gives it a slot, a free one if there is
+     *              one (its generation was bumped when it was freed, so old handles to it stay stale).
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: SlotHandle - The handle of the new element.
+     */
+    template<typename T>
+    template<typename... Args>
+    SlotHandle SlotMap<T>::emplace(Args&&... args) {
+        if (freeHead == none) {
+            if (slots.size() >= none) {
+                throw std::length_error("SlotMap is full");
+            }
+            slots.push_back(Slot{none, 1}); // A spare free slot is harmless if the element below fails to construct
+            freeHead = static_cast<uint32_t>(slots.size() - 1);
+        }
+        const uint32_t slotIndex = freeHead;
+        denseToSlot.push_back(slotIndex);
+        try {
+            dense.emplace_back(std::forward<Args>(args)...);
+        } catch (...) {
+            denseToSlot.pop_back();
+            throw;
+        }
+        Slot& slot = slots[slotIndex];
+        freeHead = slot.index;
+        slot.index = static_cast<uint32_t>(dense.size() - 1);
+        return SlotHandle(slotIndex, slot.generation);
+    }
+
+    /*
+     * Name: SlotMap.erase
+     * Description: Removes the element a handle refers to. The last element of the dense array is moved into its place
+     *              and its slot updated, then the freed slot's generation is bumped and the slot goes on the free list.
+     * Parameters: handle - The element's handle.
+     * Returns: bool - True if an element was removed, false if the handle was stale (or null).
+     */
+    template<typename T>
+    bool SlotMap<T>::erase(SlotHandle handle) {
+        if (!liveSlot(handle)) {
+            return false;
+        }
+        Slot& slot = slots[handle.index()];
+        const uint32_t position = slot.index;
+        const auto last = static_cast<uint32_t>(dense.size() - 1);
+        if (position != last) {
+            dense[position] = std::move(dense[last]);
+            denseToSlot[position] = denseToSlot[last];
+            slots[denseToSlot[position]].index = position;
+        }
+        dense.pop_back();
+        denseToSlot.pop_back();
+        slot.generation = slot.generation + 1 == 0 ? 1 : slot.generation + 1; // 0 stays reserved for the null handle
+        slot.index = freeHead;
+        freeHead = handle.index();
+        return true;
+    }
+
+    /*
+     * Name: SlotMap.find
+     * Description: Looks up the element a handle refers to.
+     * Parameters: handle - The element's handle.
+     * Returns: T* - The element, or nullptr if the handle is stale (or null). Valid until the next insert or erase.
+     */
+    template<typename T>
+    T* SlotMap<T>::find(SlotHandle handle) {
+        const Slot* slot = liveSlot(handle);
+        return slot ? &dense[slot->index] : nullptr;
+    }
+
+    template<typename T>
+    const T* SlotMap<T>::find(SlotHandle handle) const {
+        const Slot* slot = liveSlot(handle);
+        return slot ? &dense[slot->index] : nullptr;
+    }
+
+    /*
+     * Name: SlotMap.at
+     * Description: Looks up the element a handle refers to.
+     * Parameters: handle - The element's handle.
+     * Returns: T& - The element. Throws std::out_of_range if the handle is stale.
+     */
+    template<typename T>
+    T& SlotMap<T>::at(SlotHandle handle) {
+        T* element = find(handle);
+        if (!element) {
+            throw std::out_of_range("SlotMap handle is stale");
+        }
+        return *element;
+    }
+
+    template<typename T>
+    const T& SlotMap<T>::at(SlotHandle handle) const {
+        const T* element = find(handle);
+        if (!element) {
+            throw std::out_of_range("SlotMap handle is stale");
+        }
+        return *element;
+    }
+
+    /*
+     * Name: SlotMap.handleAt
+     * Description: Returns the handle of the element at a position of the dense array, e.g. to get the handle of the
+     *              element an iterator points at (position = it - begin()).
+     * Parameters: position - Position in the dense array, less than getSize().
+     * Returns: SlotHandle - The element's handle.
+     */
+    template<typename T>
+    SlotHandle SlotMap<T>::handleAt(size_t position) const {
+        if (position >= dense.size()) {
+            throw std::out_of_range("SlotMap position out of range");
+        }
+        const uint32_t slotIndex = denseToSlot[position];
+        return SlotHandle(slotIndex, slots[slotIndex].generation);
+    }
+
+    /*
+     * Name: SlotMap.reserve
+     * Description: Makes room for n elements, so the next inserts do not reallocate.
+     * Parameters: n - The number of elements.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void SlotMap<T>::reserve(size_t n) {
+        dense.reserve(n);
+        denseToSlot.reserve(n);
+        slots.reserve(n);
+    }
+
+    /*
+     * Name: SlotMap.clear
+     * Description: Removes every element. Every slot in use gets a new generation and goes on the free list, so all
+     *              handles handed out so far become stale.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void SlotMap<T>::clear() {
+        for (uint32_t slotIndex : denseToSlot) {
+            Slot& slot = slots[slotIndex];
+            slot.generation = slot.generation + 1 == 0 ? 1 : slot.generation + 1;
+            slot.index = freeHead;
+            freeHead = slotIndex;
+        }
+        dense.clear();
+        denseToSlot.clear();
+    }
+
+    /*
+     * Name: SlotMap.liveSlot
+     * Description: Returns the slot a handle refers to if the handle is still live: the index is in range, the
+     *              generation matches (it was bumped when the element was erased) and the slot is in use, which the
+     *              back-reference from the dense array confirms.
+     * Parameters: handle - The handle to check.
+     * Returns: const Slot* - The slot, or nullptr.
+     */
+    template<typename T>
+    const typename SlotMap<T>::Slot* SlotMap<T>::liveSlot(SlotHandle handle) const {
+        if (handle.index() >= slots.size()) {
+            return nullptr;
+        }
+        const Slot& slot = slots[handle.index()];
+        if (slot.generation != handle.generation() || slot.index >= dense.size() || denseToSlot[slot.index] != handle.index()) {
+            return nullptr; // Erased, or a free slot matched by chance (e.g. a handle from another SlotMap)
+        }
+        return &slot;
+    }
+
+}
+
+#endif //SLOTMAP_H
@@ -0,0 +1,323 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef SMALLSTACK_H
+#define SMALLSTACK_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+/* Notes:
+ * Array-backed stack that keeps its first InlineN elements inside the object, for the short-lived stacks that never get
+ * deep (expression evaluation, backtracking in the path planner). Stack<T> allocates a node on every push and frees it
+ * on every pop; SmallStack does not touch the heap at all until it holds more than InlineN elements, and after that
+ * only when its capacity doubles. Same interface as Stack<T>, plus reserve() and capacity information.
+ *
+ * Functions in the small stack class:
+ * push - Adds a new element to the top of the stack (copies, or moves an rvalue).
+ * emplace - Constructs a new element in place on top of the stack.
+ * pop - Removes and returns the top element of the stack (moved out).
+ * top - Returns the top element without removing it, a reference into the contiguous storage.
+ * reserve - Makes room for at least n elements, so the next pushes do not reallocate.
+ * getSize / isEmpty - Number of elements, empty check.
+ * capacity - Number of elements the current storage holds.
+ * isInline - Checks if the elements are still in the inline buffer.
+ * clear - Removes all elements (the storage is kept).
+ * Iterators run from the top of the stack to the bottom, like Stack<T>; crbegin / crend run from the bottom up.
+ *
+ * Storage:
+ * The elements sit contiguously, bottom first, either in the inline buffer or in one heap buffer. When a push finds the
+ * storage full it allocates twice the capacity, constructs the new element there first (so push(top()) is safe), then
+ * moves the old elements over (copies them if T's move constructor may throw). The stack never moves back into the
+ * inline buffer or shrinks; clear() keeps the heap buffer for reuse. Pointers and references to elements are
+ * invalidated when the storage grows. Moving a stack that spilled to the heap takes the buffer over in O(1), moving an
+ * inline stack moves the elements one by one.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, size_t InlineN = 16>
+    class SmallStack {
+        static_assert(InlineN > 0, "SmallStack needs room for at least one inline element");
+    public:
+        SmallStack() : elements(inlineData()), count(0), slots(InlineN) {}
+        SmallStack(const SmallStack& other);       // Deep copy of the elements
+        SmallStack(SmallStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>); // Takes over a heap buffer in O(1)
+        SmallStack& operator=(const SmallStack& other);
+        SmallStack& operator=(SmallStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+        ~SmallStack();
+        void push(const T& value) { emplace(value); }            // Adds a new element to the top of the stack
+        void push(T&& value) { emplace(std::move(value)); }      // Same, but moves the value in
+        template<typename... Args>
+        T& emplace(Args&&... args);                // Constructs a new element in place on top of the stack
+        T pop();                                   // Removes and returns the top element of the stack
+        T& top() const;                            // Returns the top element of the stack without removing it
+        void reserve(size_t n);                    // Makes room for at least n elements
+        [[nodiscard]] int getSize() const { return static_cast<int>(count); }  // Returns the number of elements in the stack
+        [[nodiscard]] bool isEmpty() const { return count == 0; }            // Checks if the stack is empty
+        [[nodiscard]] size_t capacity() const { return slots; }              // Elements the current storage holds
+        [[nodiscard]] bool isInline() const { return elements == inlineData(); } // Still in the inline buffer
+        void clear();                              // Removes all elements
+        // Forward iterator support, top first
+        auto begin()        { return std::reverse_iterator<T*>(elements + count); }
+        auto end()          { return std::reverse_iterator<T*>(elements); }
+        auto cbegin() const { return std::reverse_iterator<const T*>(elements + count); }
+        auto cend() const   { return std::reverse_iterator<const T*>(elements); }
+
+        // Bottom first
+        const T* crbegin() const { return elements; }
+        const T* crend() const   { return elements + count; }
+
+    private:
+        alignas(T) unsigned char inlineBuffer[InlineN * sizeof(T)]; // The first InlineN elements live here
+        T* elements;                               // inlineData() or a heap buffer of slots elements
+        size_t count;                              // Number of elements
+        size_t slots;                              // Capacity of elements
+
+        T* inlineData() const { return reinterpret_cast<T*>(const_cast<unsigned char*>(inlineBuffer)); }
+        void reallocate(size_t newSlots);          // Moves the elements to a heap buffer of newSlots elements
+        void release();                            // Destroys the elements and frees a heap buffer
+        void takeFrom(SmallStack&& other);         // Steals other's heap buffer or moves its inline elements
+    };
+
+    /*
+     * Name: SmallStack copy constructor
+     * Description: Copies every element of another stack. Storage is inline if the elements fit, else one heap buffer
+     *              of exactly the right size.
+     * Parameters: other - The stack to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    SmallStack<T, InlineN>::SmallStack(const SmallStack& other) : SmallStack() {
+        reserve(other.count);
+        std::uninitialized_copy(other.elements, other.elements + other.count, elements);
+        count = other.count;
+    }
+
+    /*
+     * Name: SmallStack move constructor
+     * Description: Takes over another stack's heap buffer, or moves its inline elements one by one. other is left empty.
+     * Parameters: other - The stack to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    SmallStack<T, InlineN>::SmallStack(SmallStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : SmallStack() {
+        takeFrom(std::move(other));
+    }
+
+    /*
+     * Name: SmallStack copy assignment
+     * Description: Replaces the elements with copies of another stack's elements.
+     * Parameters: other - The stack to copy.
+     * Returns: SmallStack& - This stack.
+     */
+    template<typename T, size_t InlineN>
+    SmallStack<T, InlineN>& SmallStack<T, InlineN>::operator=(const SmallStack& other) {
+        if (this != &other) {
+            SmallStack copy(other);
+            release();
+            takeFrom(std::move(copy));
+        }
+        return *this;
+    }
+
+    /*
+     * Name: SmallStack move assignment
+     * Description: Frees this stack's elements and takes over another stack's elements, other is left empty.
+     * Parameters: other - The stack to move from.
+     * Returns: SmallStack& - This stack.
+     */
+    template<typename T, size_t InlineN>
+    SmallStack<T, InlineN>& SmallStack<T, InlineN>::operator=(SmallStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            release();
+            takeFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    /*
+     * Name: SmallStack destructor
+     * Description: Destroys the elements and frees the heap buffer, if any.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    SmallStack<T, InlineN>::~SmallStack() {
+        release();
+    }
+
+    /*
+     * Name: SmallStack.emplace
+     * Description: Constructs a new element in place on top of the stack. If the storage is full it doubles first; the
+     *              new element is constructed in the new buffer before the old elements move, so the arguments may
+     *              refer to an element of this stack.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, size_t InlineN>
+    template<typename... Args>
+    T& SmallStack<T, InlineN>::emplace(Args&&... args) {
+        if (count < slots) {
+            T* element = std::construct_at(elements + count, std::forward<Args>(args)...);
+            count++;
+            return *element;
+        }
+        const size_t newSlots = slots * 2;
+        T* buffer = std::allocator<T>().allocate(newSlots);
+        T* element;
+        try {
+            element = std::construct_at(buffer + count, std::forward<Args>(args)...);
+        } catch (...) {
+            std::allocator<T>().deallocate(buffer, newSlots);
+            throw;
+        }
+        try {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(elements, elements + count, buffer);
+            } else {
+                std::uninitialized_copy(elements, elements + count, buffer);
+            }
+        } catch (...) {
+            std::destroy_at(element);
+            std::allocator<T>().deallocate(buffer, newSlots);
+            throw;
+        }
+        std::destroy(elements, elements + count);
+        if (!isInline()) {
+            std::allocator<T>().deallocate(elements, slots);
+        }
+        elements = buffer;
+        slots = newSlots;
+        count++;
+        return *element;
+    }
+
+    /*
+     * Name: SmallStack.pop
+     * Description: Removes and returns the top element of the stack.
+     * Parameters: None
+     * Returns: T - The removed element (moved out).
+     */
+    template<typename T, size_t InlineN>
+    T SmallStack<T, InlineN>::pop() {
+        if (count == 0) {
+            throw std::out_of_range("SmallStack is empty");
+        }
+        T value = std::move(elements[count - 1]);
+        std::destroy_at(elements + count - 1);
+        count--;
+        return value;
+    }
+
+    /*
+     * Name: SmallStack.top
+     * Description: Returns the top element of the stack without removing it.
+     * Parameters: None
+     * Returns: T& - Reference to the top element, valid until the next push that grows the storage or the pop that removes it.
+     */
+    template<typename T, size_t InlineN>
+    T& SmallStack<T, InlineN>::top() const {
+        if (count == 0) {
+            throw std::out_of_range("SmallStack is empty");
+        }
+        return elements[count - 1];
+    }
+
+    /*
+     * Name: SmallStack.reserve
+     * Description: Makes sure the stack can hold n elements without growing. Does nothing if it already can.
+     * Parameters: n - The number of elements.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    void SmallStack<T, InlineN>::reserve(size_t n) {
+        if (n > slots) {
+            reallocate(n);
+        }
+    }
+
+    /*
+     * Name: SmallStack.clear
+     * Description: Destroys every element. A heap buffer is kept for the next pushes.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    void SmallStack<T, InlineN>::clear() {
+        std::destroy(elements, elements + count);
+        count = 0;
+    }
+
+    /*
+     * Name: SmallStack.reallocate
+     * Description: Moves the elements to a new heap buffer (copies them if T's move constructor may throw) and frees the
+     *              old one.
+     * Parameters: newSlots - Capacity of the new buffer, at least the number of elements.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    void SmallStack<T, InlineN>::reallocate(size_t newSlots) {
+        T* buffer = std::allocator<T>().allocate(newSlots);
+        try {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(elements, elements + count, buffer);
+            } else {
+                std::uninitialized_copy(elements, elements + count, buffer);
+            }
+        } catch (...) {
+            std::allocator<T>().deallocate(buffer, newSlots);
+            throw;
+        }
+        std::destroy(elements, elements + count);
+        if (!isInline()) {
+            std::allocator<T>().deallocate(elements, slots);
+        }
+        elements = buffer;
+        slots = newSlots;
+    }
+
+    /*
+     * Name: SmallStack.release
+     * Description: Destroys the elements and frees a heap buffer, leaving an empty stack on the inline buffer.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    void SmallStack<T, InlineN>::release() {
+        std::destroy(elements, elements + count);
+        if (!isInline()) {
+            std::allocator<T>().deallocate(elements, slots);
+        }
+        elements = inlineData();
+        count = 0;
+        slots = InlineN;
+    }
+
+    /*
+     * Name: SmallStack.takeFrom
+     * Description: Moves another stack's elements into this one, which must be empty and inline. A heap buffer is
+     *              taken over as is, inline elements are moved one by one. other is left empty and inline.
+     * Parameters: other - The stack to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t InlineN>
+    void SmallStack<T, InlineN>::takeFrom(SmallStack&& other) {
+        if (!other.isInline()) {
+            elements = std::exchange(other.elements, other.inlineData());
+            count = std::exchange(other.count, 0);
+            slots = std::exchange(other.slots, InlineN);
+            return;
+        }
+        std::uninitialized_move(other.elements, other.elements + other.count, elements);
+        count = other.count;
+        other.clear();
+    }
+
+}
+
+#endif //SMALLSTACK_H
@@ -0,0 +1,276 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef SPSCRINGBUFFER_H
+#define SPSCRINGBUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "ringbuffer.h"
+/* Notes:
+ * Lock-free single-producer / single-consumer ring buffer for handing samples from one thread to another.
+ * Exactly one thread may call the producer functions and exactly one (other) thread the consumer functions.
+ *
+ * Functions in the SPSC ring buffer class:
+ * try_push - (producer) Adds a new element (copies, or moves an rvalue), returns false if the buffer is full (overwrite mode always succeeds).
+ * try_pop - (consumer) Removes the oldest element into out, returns false if the buffer is empty (see overwrite mode).
+ * getSize - Returns the number of elements in the buffer (a snapshot, the other thread may change it right after).
+ * isEmpty - Checks if the buffer is empty (snapshot).
+ * isFull - Checks if the buffer is full (snapshot).
+ * capacity - Returns the maximum number of elements the buffer can hold.
+ * isOverwriteOnly - Checks if the buffer is in overwrite-oldest mode.
+ *
+ * How it works:
+ * head and tail are free-running counters (they never wrap back, size_t will not overflow in practice), slot = counter & mask.
+ * The consumer owns head, the producer owns tail, and each sits on its own cache line so the two threads never fight over a line.
+ * Each side also keeps a private copy of the other side's counter (cachedTail / cachedHead) and only re-reads the real one
+ * when the copy says the buffer looks empty/full. In the common case a push is one slot write plus one release store of tail.
+ *
+ * Overwrite mode:
+ * SpscRingBuffer<T, OverflowPolicy::Overwrite>, the same policy RingBuffer<T, N> takes: the producer never waits for the
+ * consumer and simply writes over the oldest slot when the buffer is full. Only the consumer moves head, as in normal mode.
+ * Each slot is a seqlock: a sequence counter plus the element stored as word-sized relaxed atomics, so the producer can
+ * rewrite a slot while the consumer reads it without a data race. The producer makes the sequence odd, writes the words
+ * and stores 2 * (counter + 1) when done. The consumer reads the words between two loads of the sequence and keeps the
+ * copy only if both loads show the element it expected; otherwise the element was overwritten under it.
+ * try_pop stays wait-free: when the producer has lapped the consumer, head skips to the oldest element still in the
+ * buffer, and when the element is overwritten during the read, try_pop drops it and returns false even though newer
+ * elements may be waiting (the next call returns them).
+ * Elements are copied as bytes, which is why overwrite mode only compiles for trivially copyable T.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, OverflowPolicy Policy = OverflowPolicy::Reject>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>) // Overwrite mode copies elements as bytes
+    class SpscRingBuffer {
+    public:
+        explicit SpscRingBuffer(size_t capacity);
+        ~SpscRingBuffer();
+        SpscRingBuffer(const SpscRingBuffer&) = delete;            // Atomics and the slot array cannot be shared or copied
+        SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+        bool try_push(const T& value);                              // Producer only: adds a new element, false if full
+        bool try_push(T&& value);                                   // Same, but moves the value in (works for move-only T)
+        bool try_pop(T& out);                                       // Consumer only: removes the oldest element into out, false if empty (or lost to the producer)
+        [[nodiscard]] size_t getSize() const;                       // Number of elements currently in the buffer (snapshot)
+        [[nodiscard]] bool isEmpty() const { return getSize() == 0; }        // Checks if the buffer is empty (snapshot)
+        [[nodiscard]] bool isFull() const { return getSize() >= maxCapacity; } // Checks if the buffer is full (snapshot)
+        [[nodiscard]] size_t capacity() const { return maxCapacity; }        // Maximum number of elements (rounded up to a power of two)
+        [[nodiscard]] static constexpr bool isOverwriteOnly() { return overwriteOnly; } // Checks if the buffer is in overwrite-oldest mode
+
+    private:
+        static constexpr size_t cacheLineSize = 64; // Fixed instead of std::hardware_destructive_interference_size, which GCC warns is ABI-unstable
+        static constexpr bool overwriteOnly = Policy == OverflowPolicy::Overwrite; // Flag to indicate if the buffer is in overwrite-oldest mode
+
+        using Word = std::uintptr_t;                                                     // Unit of the atomic copy in overwrite mode
+        static constexpr size_t wordCount = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word); // Words per element
+
+        struct SeqlockSlot {                             // Overwrite-mode slot, rewritten by the producer while the consumer may read it
+            std::atomic<size_t> sequence{0};             // 2 * (counter + 1) once the element is written, odd while it is being written
+            std::atomic<Word> words[wordCount];          // The element's bytes
+        };
+        using Slot = std::conditional_t<overwriteOnly, SeqlockSlot, T>;
+
+        // Consumer side
+        alignas(cacheLineSize) std::atomic<size_t> head; // Counter of the oldest element, written only by the consumer
+        size_t cachedTail;                               // Consumer's last seen value of tail
+        // Producer side
+        alignas(cacheLineSize) std::atomic<size_t> tail; // Counter of the next slot to write, written only by the producer
+        size_t cachedHead;                               // Producer's last seen value of head (normal mode)
+        // Shared, read-only after construction
+        alignas(cacheLineSize) Slot* slots;              // Contiguous slot array
+        size_t maxCapacity;                              // Length of the slot array (power of two)
+        size_t mask;                                     // maxCapacity - 1, turns a counter into a slot index
+
+        template<typename U>
+        bool pushValue(U&& value);                       // Shared body of the two try_push overloads
+    };
+
+    /*
+     * Name: SpscRingBuffer constructor
+     * Description: Initializes an empty buffer and allocates the slot array. The capacity is rounded up to the next power of two
+     *              so the counter to slot mapping is a mask instead of a division.
+     *              Whether push drops the oldest element when full is the Policy template parameter.
+     * Parameters: capacity - The minimum number of elements the buffer can hold.
+     * Returns: void - No return value.
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    SpscRingBuffer<T, Policy>::SpscRingBuffer(size_t capacity)
+        : head(0), cachedTail(0), tail(0), cachedHead(0), slots(nullptr), maxCapacity(0), mask(0) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SpscRingBuffer capacity must be greater than zero");
+        }
+        maxCapacity = std::bit_ceil(capacity);
+        mask = maxCapacity - 1;
+        if constexpr (overwriteOnly) {
+            slots = new SeqlockSlot[maxCapacity];
+        } else {
+            slots = std::allocator<T>().allocate(maxCapacity);
+        }
+    }
+
+    /*
+     * Name: SpscRingBuffer destructor
+     * Description: Destroys the remaining elements and frees the slot array. No thread may be using the buffer anymore.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    SpscRingBuffer<T, Policy>::~SpscRingBuffer() {
+        if constexpr (overwriteOnly) {
+            delete[] slots; // Trivially copyable elements, nothing to destroy
+        } else {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = head.load(std::memory_order_relaxed); i != tail.load(std::memory_order_relaxed); i++) {
+                    std::destroy_at(slots + (i & mask));
+                }
+            }
+            std::allocator<T>().deallocate(slots, maxCapacity);
+        }
+    }
+
+    /*
+     * Name: SpscRingBuffer.try_push
+     * Description: Adds a new element to the buffer. Producer thread only. Wait-free: never blocks or retries.
+     *              In overwrite mode a full buffer loses its oldest element.
+     * Parameters: value - The value to be added to the buffer.
+     * Returns: bool - True if the value was added, false if the buffer is full (never false in overwrite mode).
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    bool SpscRingBuffer<T, Policy>::try_push(const T& value) {
+        return pushValue(value);
+    }
+
+    /*
+     * Name: SpscRingBuffer.try_push (move)
+     * Description: Adds a new element to the buffer by moving the value in. Producer thread only. The value is left untouched
+     *              when the buffer is full.
+     * Parameters: value - The value to be moved into the buffer.
+     * Returns: bool - True if the value was added, false if the buffer is full (never false in overwrite mode).
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    bool SpscRingBuffer<T, Policy>::try_push(T&& value) {
+        return pushValue(std::move(value));
+    }
+
+    /*
+     * Name: SpscRingBuffer.pushValue
+     * Description: Shared body of the two try_push overloads, constructs the element from a copy or a move.
+     * Parameters: value - The value to be added to the buffer (const T& or T&&).
+     * Returns: bool - True if the value was added, false if the buffer is full.
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    template<typename U>
+    bool SpscRingBuffer<T, Policy>::pushValue(U&& value) {
+        const size_t currentTail = tail.load(std::memory_order_relaxed); // Only this thread writes tail
+        if constexpr (overwriteOnly) {
+            // Seqlock write, the slot may still hold the oldest element (see the notes at the top)
+            Word words[wordCount] = {};
+            std::memcpy(words, std::addressof(value), sizeof(T));
+            SeqlockSlot& slot = slots[currentTail & mask];
+            slot.sequence.store(2 * currentTail + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release); // Keeps the word stores after the odd sequence
+            for (size_t i = 0; i < wordCount; i++) {
+                slot.words[i].store(words[i], std::memory_order_relaxed);
+            }
+            slot.sequence.store(2 * currentTail + 2, std::memory_order_release);
+        } else {
+            if (currentTail - cachedHead >= maxCapacity) {
+                // Looks full, refresh the cached head before giving up
+                cachedHead = head.load(std::memory_order_acquire);
+                if (currentTail - cachedHead >= maxCapacity) {
+                    return false;
+                }
+            }
+            std::construct_at(slots + (currentTail & mask), std::forward<U>(value));
+        }
+        tail.store(currentTail + 1, std::memory_order_release); // Publish the slot to the consumer
+        return true;
+    }
+
+    /*
+     * Name: SpscRingBuffer.try_pop
+     * Description: Removes the oldest element from the buffer. Consumer thread only. Wait-free in both modes.
+     *              In overwrite mode, elements the producer already wrote over are skipped, and if the element being read
+     *              is written over during the read it is dropped and the call returns false.
+     * Parameters: out - Receives the removed element (left untouched when false is returned).
+     * Returns: bool - True if an element was removed, false if the buffer is empty or the element was lost to the producer.
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    bool SpscRingBuffer<T, Policy>::try_pop(T& out) {
+        size_t currentHead = head.load(std::memory_order_relaxed); // Only this thread writes head
+        if (currentHead == cachedTail) {
+            // Looks empty, refresh the cached tail before giving up
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (currentHead == cachedTail) {
+                return false;
+            }
+        }
+        if constexpr (!overwriteOnly) {
+            T* slot = slots + (currentHead & mask);
+            out = std::move(*slot);
+            std::destroy_at(slot);
+            head.store(currentHead + 1, std::memory_order_release); // Hand the slot back to the producer
+            return true;
+        } else {
+            if (cachedTail - currentHead > maxCapacity) {
+                currentHead = cachedTail - maxCapacity; // The producer lapped us, older elements are gone
+            }
+            // Seqlock read (see the notes at the top). The slot was published before tail, so its sequence is at least
+            // the expected value, and anything larger means the producer is writing or has written a newer element there
+            const size_t expected = 2 * currentHead + 2;
+            SeqlockSlot& slot = slots[currentHead & mask];
+            Word words[wordCount];
+            const size_t before = slot.sequence.load(std::memory_order_acquire);
+            for (size_t i = 0; i < wordCount; i++) {
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire); // Keeps the word loads before the second sequence load
+            const size_t after = slot.sequence.load(std::memory_order_relaxed);
+            if (before == expected && after == expected) {
+                std::memcpy(std::addressof(out), words, sizeof(T));
+                head.store(currentHead + 1, std::memory_order_release);
+                return true;
+            }
+            // Overwritten while reading: drop it and everything the producer has lapped since
+            cachedTail = tail.load(std::memory_order_acquire);
+            head.store(std::max(currentHead + 1, cachedTail - std::min(cachedTail, maxCapacity)), std::memory_order_release);
+            return false;
+        }
+    }
+
+    /*
+     * Name: SpscRingBuffer.getSize
+     * Description: Returns the number of elements in the buffer. Safe from either thread, but only a snapshot.
+     * Parameters: None
+     * Returns: size_t - The number of elements in the buffer.
+     */
+    template<typename T, OverflowPolicy Policy>
+        requires (Policy == OverflowPolicy::Reject || std::is_trivially_copyable_v<T>)
+    size_t SpscRingBuffer<T, Policy>::getSize() const {
+        const size_t currentHead = head.load(std::memory_order_acquire);
+        const size_t currentTail = tail.load(std::memory_order_acquire);
+        if (currentTail <= currentHead) {
+            return 0; // head may pass a stale tail read
+        }
+        return std::min(currentTail - currentHead, maxCapacity);
+    }
+
+}
+
+#endif //SPSCRINGBUFFER_H
@@ -5,28 +5,42 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <utility>
 #include "linkedlist.h"
 /* Notes:
  * Functions in the stack class:
  * push - Adds a new element to the top of the stack.
- * pop - Removes and returns the top element of the stack.
+ * emplace - Constructs a new element in place on top of the stack.
+ * pop - Removes and returns the top element of the stack (moved out of the node, not copied).
  * top - Returns the top element of the stack without removing it.
  * getSize - Returns the number of elements in the stack.
  * isEmpty - Checks if the stack is empty.
+ * clear - Removes all elements (O(1) for trivially destructible T on an ArenaAllocator).
+ * getAllocator - Returns the node allocator (a NodePool by default) of the underlying list.
  */
 
 namespace CommandaStructures {
 
-    template<typename T>
+    template<typename T, template<typename> class Allocator = NodePool>
     class Stack {
     public:
         Stack();                     // Constructor to initialize an empty stack
+        explicit Stack(Allocator<SingleNode<T>> nodeAllocator) : list(std::move(nodeAllocator)) {} // Nodes come from the given allocator (e.g. an arena)
+        Stack(const Stack&) = default;             // Deep copy of the elements
+        Stack(Stack&&) = default;                  // Takes over the nodes, O(1)
+        Stack& operator=(const Stack&) = default;
+        Stack& operator=(Stack&&) = default;
         ~Stack();                    // Destructor to clean up the stack
         void push(const T& value);   // Adds a new element to the top of the stack
+        void push(T&& value);        // Same, but moves the value in
+        template<typename... Args>
+        T& emplace(Args&&... args);  // Constructs a new element in place on top of the stack
         T pop();                     // Removes and returns the top element of the stack
         T& top() const;              // Returns the top element of the stack without removing it
         [[nodiscard]] int getSize() const {return list.getSize();};         // Returns the number of elements in the stack
         [[nodiscard]] bool isEmpty() const;        // Checks if the stack is empty
+        void clear() { list.clear(); }                              // Removes all elements
+        auto& getAllocator() { return list.getAllocator(); }         // Node allocator of the underlying list (reserve(), highWater())
         // Forward iterator support
         auto begin()       { return list.begin(); }
         auto end()         { return list.end(); }
@@ -37,7 +51,7 @@ namespace CommandaStructures {
         auto crend() const   { return list.rend(); }
 
     private:
-        LinkedList<T> list;          // Linked list to store the elements of the stack
+        LinkedList<T, Allocator> list;          // Linked list to store the elements of the stack
     };
 
     /*
@@ -46,10 +60,10 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    Stack<T>::Stack() {
-        list = LinkedList<T>(); // Initialize the linked list to manage stack elements
-    };
+    template<typename T, template<typename> class Allocator>
+    Stack<T, Allocator>::Stack() : list() {
+        // The linked list starts out empty, it owns its node pool so it cannot be assigned from a temporary
+    }
 
     /*
      * Name: Stack destructor
@@ -57,8 +71,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: void - No return value.
      */
-    template<typename T>
-    Stack<T>::~Stack() = default; // Use the default destructor (no need for custom cleanup since LinkedList handles its own memory)
+    template<typename T, template<typename> class Allocator>
+    Stack<T, Allocator>::~Stack() = default; // Use the default destructor (no need for custom cleanup since LinkedList handles its own memory)
 
     /*
      * Name: Stack.push
@@ -66,9 +80,32 @@ namespace CommandaStructures {
      * Parameters: value - The value to be added to the stack.
      * Returns: void - No return value.
      */
-    template<typename T>
-    void Stack<T>::push(const T& value) {
-        list.insert(value, LinkedList<T>::HEAD); // Insert at the head of the linked list
+    template<typename T, template<typename> class Allocator>
+    void Stack<T, Allocator>::push(const T& value) {
+        list.insert(value, LinkedList<T, Allocator>::HEAD); // Insert at the head of the linked list
+    }
+
+    /*
+     * Name: Stack.push (move)
+     * Description: Adds a new element to the top of the stack, moving the value in instead of copying it.
+     * Parameters: value - The value to be moved onto the stack.
+     * Returns: void - No return value.
+     */
+    template<typename T, template<typename> class Allocator>
+    void Stack<T, Allocator>::push(T&& value) {
+        list.insert(std::move(value), LinkedList<T, Allocator>::HEAD);
+    }
+
+    /*
+     * Name: Stack.emplace
+     * Description: Constructs a new element in place on top of the stack, straight from the constructor arguments.
+     * Parameters: args - The arguments for T's constructor.
+     * Returns: T& - Reference to the new element.
+     */
+    template<typename T, template<typename> class Allocator>
+    template<typename... Args>
+    T& Stack<T, Allocator>::emplace(Args&&... args) {
+        return list.emplace_front(std::forward<Args>(args)...);
     }
 
     /*
@@ -77,12 +114,12 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T - The value of the removed top element.
      */
-    template<typename T>
-    T Stack<T>::pop() {
+    template<typename T, template<typename> class Allocator>
+    T Stack<T, Allocator>::pop() {
         if (isEmpty()) {
             throw std::out_of_range("Stack is empty");
         }
-        T data = list.getHead()->getData(); // Get the data from the head node
+        T data = std::move(list.getHead()->getData()); // Move the data out of the head node, it is destroyed next
         list.removeNode(list.getHead());
         return data; // Return the removed value
     }
@@ -93,8 +130,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: T& - Reference to the top element.
      */
-    template<typename T>
-    T& Stack<T>::top() const {
+    template<typename T, template<typename> class Allocator>
+    T& Stack<T, Allocator>::top() const {
         if (isEmpty()) {
             throw std::out_of_range("Stack is empty");
         }
@@ -107,8 +144,8 @@ namespace CommandaStructures {
      * Parameters: None
      * Returns: bool - True if empty, false otherwise
      */
-    template<typename T>
-    bool Stack<T>::isEmpty() const {
+    template<typename T, template<typename> class Allocator>
+    bool Stack<T, Allocator>::isEmpty() const {
         return list.getSize() == 0; // Return true if size is zero, false otherwise
     }
 
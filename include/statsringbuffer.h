@@ -0,0 +1,276 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef STATSRINGBUFFER_H
+#define STATSRINGBUFFER_H
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include "ringbuffer.h"
+/* Notes:
+ * Sliding-window ring buffer that keeps its statistics up to date as samples come in, so a control loop can read the
+ * mean / variance / min / max of the last N samples in O(1) instead of walking the whole window every tick.
+ * It behaves like RingBuffer<T>(window, true): push never fails and the oldest sample is evicted once the window is full.
+ *
+ * Functions in the stats ring buffer class:
+ * push - Adds a new sample, evicting the oldest one if the window is full. O(1) amortized.
+ * sum - Returns the sum of the samples in the window (exact for integer samples).
+ * mean - Returns the mean of the samples in the window.
+ * variance - Returns the population variance of the window.
+ * sampleVariance - Returns the sample (n - 1) variance of the window.
+ * stddev - Returns the population standard deviation of the window.
+ * min - Returns the smallest sample in the window.
+ * max - Returns the largest sample in the window.
+ * resynchronize - Recomputes sum and variance from the stored samples, O(N), to wipe out accumulated rounding error.
+ * front / back / getSize / isFull / isEmpty / capacity / clear / iterators - Same as RingBuffer.
+ *
+ * How it works:
+ * The window sum is kept as a running total: a long long for integer samples, so it stays exact (as long as it fits),
+ * and a Kahan (Neumaier) compensated double for floating point, so adding and removing samples does not lose the low
+ * bits. mean is that sum divided by the size.
+ * M2 (sum of squared deviations) follows Welford's method, extended to also remove the evicted sample.
+ * min and max each use a monotonic deque of (value, sequence number) pairs: a new sample first pops every entry from the
+ * back that it beats, so the deque stays sorted and its front is the current min / max. An entry leaves from the front
+ * once its sample is evicted from the window. Each sample enters and leaves each deque once, hence O(1) amortized.
+ * The deques are RingBuffers of window capacity, so nothing allocates after construction.
+ * The incremental update can slowly drift on very long runs, call resynchronize() in an idle moment if that matters.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T>
+    class StatsRingBuffer {
+        static_assert(std::is_arithmetic_v<T>, "StatsRingBuffer needs a numeric sample type");
+    public:
+        using Sum = std::conditional_t<std::is_integral_v<T>, long long, double>; // Exact for integers, compensated for floating point
+
+        explicit StatsRingBuffer(size_t window);
+        void push(const T& value);                         // Adds a new sample, evicting the oldest if the window is full
+        [[nodiscard]] Sum sum() const;                     // Sum of the window
+        [[nodiscard]] double mean() const;                 // Mean of the window
+        [[nodiscard]] double variance() const;             // Population variance of the window
+        [[nodiscard]] double sampleVariance() const;       // Sample (n - 1) variance of the window
+        [[nodiscard]] double stddev() const { return std::sqrt(variance()); } // Population standard deviation of the window
+        [[nodiscard]] T min() const;                       // Smallest sample in the window
+        [[nodiscard]] T max() const;                       // Largest sample in the window
+        void resynchronize();                              // Recomputes the sum and M2 from the stored samples (O(N))
+        T& front() const { return samples.front(); }       // Oldest sample
+        T& back() const { return samples.back(); }         // Newest sample
+        [[nodiscard]] int getSize() const { return samples.getSize(); }          // Number of samples in the window
+        [[nodiscard]] bool isFull() const { return samples.isFull(); }           // Checks if the window is full
+        [[nodiscard]] bool isEmpty() const { return samples.isEmpty(); }         // Checks if the window is empty
+        [[nodiscard]] size_t capacity() const { return samples.capacity(); }     // Window length
+        void clear();                                      // Removes all samples and resets the statistics
+        auto cbegin() const { return samples.cbegin(); }   // Read-only iteration, oldest sample first
+        auto cend() const   { return samples.cend(); }
+        auto begin() const  { return samples.cbegin(); }
+        auto end() const    { return samples.cend(); }
+
+    private:
+        struct Extreme {
+            T value;
+            uint64_t sequence; // Sequence number of the sample, tells when it leaves the window
+        };
+
+        RingBuffer<T> samples;          // The window itself
+        RingBuffer<Extreme> minimums;   // Monotonic deque, values increasing from front to back
+        RingBuffer<Extreme> maximums;   // Monotonic deque, values decreasing from front to back
+        uint64_t nextSequence;          // Sequence number of the next pushed sample
+        Sum total;                      // Running sum of the window
+        double compensation;            // Low-order bits the floating-point total lost (always 0 for integers)
+        double m2;                      // Welford sum of squared deviations from the mean
+
+        void addToSum(Sum value);       // Adds to the running sum (compensated for floating point)
+    };
+
+    /*
+     * Name: StatsRingBuffer constructor
+     * Description: Initializes an empty window and allocates the window and both min/max deques up front.
+     * Parameters: window - Number of most recent samples the statistics cover.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    StatsRingBuffer<T>::StatsRingBuffer(size_t window)
+        : samples(window, true), minimums(window), maximums(window), nextSequence(0), total(0), compensation(0.0), m2(0.0) {}
+
+    /*
+     * Name: StatsRingBuffer.push
+     * Description: Adds a new sample and updates every statistic, evicting the oldest sample if the window is full.
+     * Parameters: value - The sample to be added.
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void StatsRingBuffer<T>::push(const T& value) {
+        const double x = static_cast<double>(value);
+        const double oldMean = mean();
+        if (samples.isFull()) {
+            // Replace the oldest sample: one combined Welford remove + add with n unchanged
+            const double evicted = static_cast<double>(samples.front());
+            const uint64_t evictedSequence = nextSequence - samples.capacity();
+            addToSum(static_cast<Sum>(value));
+            addToSum(-static_cast<Sum>(samples.front()));
+            const double newMean = mean();
+            m2 += (x - evicted) * ((x - newMean) + (evicted - oldMean));
+            if (m2 < 0.0) {
+                m2 = 0.0; // Rounding can push a (near) zero variance slightly negative
+            }
+            if (!minimums.isEmpty() && minimums.front().sequence == evictedSequence) minimums.pop();
+            if (!maximums.isEmpty() && maximums.front().sequence == evictedSequence) maximums.pop();
+        } else {
+            // Plain Welford add
+            addToSum(static_cast<Sum>(value));
+            const double newMean = (std::is_integral_v<T> ? static_cast<double>(total) : total + compensation) /
+                                   static_cast<double>(samples.getSize() + 1);
+            m2 += (x - oldMean) * (x - newMean);
+        }
+        samples.push(value);
+
+        // Entries the new sample beats can never be the min / max again
+        while (!minimums.isEmpty() && !(minimums.back().value < value)) minimums.pop_back();
+        minimums.push({value, nextSequence});
+        while (!maximums.isEmpty() && !(value < maximums.back().value)) maximums.pop_back();
+        maximums.push({value, nextSequence});
+        nextSequence++;
+    }
+
+    /*
+     * Name: StatsRingBuffer.addToSum
+     * Description: Adds value to the running sum. Integers add exactly. Floating point uses Neumaier's variant of Kahan
+     *              summation: the rounding error of every addition is collected in compensation, which also works when
+     *              value is larger than the total (as when a large sample is evicted).
+     * Parameters: value - The value to add (negative to remove a sample).
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void StatsRingBuffer<T>::addToSum(Sum value) {
+        if constexpr (std::is_integral_v<T>) {
+            total += value;
+        } else {
+            const double updated = total + value;
+            if (std::abs(total) >= std::abs(value)) {
+                compensation += (total - updated) + value;
+            } else {
+                compensation += (value - updated) + total;
+            }
+            total = updated;
+        }
+    }
+
+    /*
+     * Name: StatsRingBuffer.sum
+     * Description: Returns the sum of the samples in the window. O(1).
+     * Parameters: None
+     * Returns: Sum - The sum (long long for integer samples, double otherwise; 0 if the window is empty).
+     */
+    template<typename T>
+    typename StatsRingBuffer<T>::Sum StatsRingBuffer<T>::sum() const {
+        if constexpr (std::is_integral_v<T>) {
+            return total;
+        } else {
+            return total + compensation;
+        }
+    }
+
+    /*
+     * Name: StatsRingBuffer.mean
+     * Description: Returns the mean of the samples in the window, the running sum divided by the size. O(1).
+     * Parameters: None
+     * Returns: double - The mean (0 if the window is empty).
+     */
+    template<typename T>
+    double StatsRingBuffer<T>::mean() const {
+        return samples.isEmpty() ? 0.0 : static_cast<double>(sum()) / static_cast<double>(samples.getSize());
+    }
+
+    /*
+     * Name: StatsRingBuffer.variance
+     * Description: Returns the population variance (divide by n) of the window. O(1).
+     * Parameters: None
+     * Returns: double - The variance (0 if the window is empty).
+     */
+    template<typename T>
+    double StatsRingBuffer<T>::variance() const {
+        return samples.isEmpty() ? 0.0 : m2 / static_cast<double>(samples.getSize());
+    }
+
+    /*
+     * Name: StatsRingBuffer.sampleVariance
+     * Description: Returns the sample variance (divide by n - 1) of the window. O(1).
+     * Parameters: None
+     * Returns: double - The sample variance (0 with fewer than two samples).
+     */
+    template<typename T>
+    double StatsRingBuffer<T>::sampleVariance() const {
+        return samples.getSize() < 2 ? 0.0 : m2 / static_cast<double>(samples.getSize() - 1);
+    }
+
+    /*
+     * Name: StatsRingBuffer.min
+     * Description: Returns the smallest sample in the window. O(1).
+     * Parameters: None
+     * Returns: T - The smallest sample.
+     */
+    template<typename T>
+    T StatsRingBuffer<T>::min() const {
+        if (isEmpty()) {
+            throw std::out_of_range("StatsRingBuffer is empty");
+        }
+        return minimums.front().value;
+    }
+
+    /*
+     * Name: StatsRingBuffer.max
+     * Description: Returns the largest sample in the window. O(1).
+     * Parameters: None
+     * Returns: T - The largest sample.
+     */
+    template<typename T>
+    T StatsRingBuffer<T>::max() const {
+        if (isEmpty()) {
+            throw std::out_of_range("StatsRingBuffer is empty");
+        }
+        return maximums.front().value;
+    }
+
+    /*
+     * Name: StatsRingBuffer.resynchronize
+     * Description: Rebuilds the sum and M2 from the stored samples (two passes, O(N)),
+     *              clearing any rounding error the incremental updates have built up.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void StatsRingBuffer<T>::resynchronize() {
+        total = 0;
+        compensation = 0.0;
+        m2 = 0.0;
+        for (auto it = samples.cbegin(); it != samples.cend(); ++it) addToSum(static_cast<Sum>(*it));
+        const double currentMean = mean();
+        for (auto it = samples.cbegin(); it != samples.cend(); ++it) {
+            const double deviation = static_cast<double>(*it) - currentMean;
+            m2 += deviation * deviation;
+        }
+    }
+
+    /*
+     * Name: StatsRingBuffer.clear
+     * Description: Removes all samples and resets the statistics.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T>
+    void StatsRingBuffer<T>::clear() {
+        samples.clear();
+        minimums.clear();
+        maximums.clear();
+        total = 0;
+        compensation = 0.0;
+        m2 = 0.0;
+    }
+
+}
+
+#endif //STATSRINGBUFFER_H
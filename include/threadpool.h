@@ -0,0 +1,289 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "lockfreequeue.h"     // Tasks submitted from outside the pool
+#include "workstealingdeque.h" // One deque per worker
+/* Notes:
+ * Minimal fixed-size thread pool with work stealing, for fanning out independent jobs (image tiles, sensor batches)
+ * across all cores. Every worker owns a WorkStealingDeque. A task submitted from inside a task goes on the submitting
+ * worker's own deque, tasks submitted from other threads go through a shared LockFreeQueue. An idle worker steals from
+ * a random victim, so a job that splits itself into subtasks spreads over the pool by itself.
+ *
+ * Functions in the thread pool class:
+ * submit - Queues a callable for execution. May be called from any thread, including from inside a task.
+ * wait - Blocks until every submitted task (and every task those submitted) has finished, then rethrows the first
+ *        exception a task threw, if any. Must not be called from inside a task.
+ * getSize - Returns the number of worker threads.
+ * getSteals - Returns how many tasks were taken from another worker's deque so far.
+ *
+ * How it works:
+ * A worker looks for work in this order: the back of its own deque (newest first, the data is still in cache), the
+ * shared queue, then the front of the other deques starting at a random one (oldest first, typically the biggest
+ * piece of a split job). A worker that finds nothing spins briefly, then sleeps on a condition variable until a task
+ * is submitted. The destructor waits for all tasks to finish before stopping the workers.
+ */
+
+namespace CommandaStructures {
+
+    class ThreadPool {
+    public:
+        explicit ThreadPool(size_t threads = 0);
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;          // Owns threads
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        template<typename F>
+        void submit(F&& task) { enqueue(new Task(std::forward<F>(task))); } // Queues a callable for execution
+        void wait();                                     // Waits for every task, rethrows the first exception
+        [[nodiscard]] size_t getSize() const { return threads.size(); }      // Number of worker threads
+        [[nodiscard]] size_t getSteals() const { return steals.load(std::memory_order_relaxed); } // Tasks stolen so far
+
+    private:
+        using Task = std::function<void()>;
+        static constexpr unsigned spinRounds = 64;       // Empty searches before a worker goes to sleep
+
+        struct Worker {
+            WorkStealingDeque<Task*> deque;              // Owned by this worker, stolen from by the others
+            uint64_t random;                             // xorshift state for picking victims
+            explicit Worker(uint64_t seed) : random(seed) {}
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::vector<std::thread> threads;
+        LockFreeQueue<Task*> injected;                   // Tasks submitted from outside the pool
+        alignas(64) std::atomic<size_t> queued;          // Tasks submitted but not picked up yet (a sleeping worker's wake-up condition)
+        alignas(64) std::atomic<size_t> unfinished;      // Tasks submitted but not finished yet (wait()'s condition)
+        alignas(64) std::atomic<size_t> sleepers;        // Workers about to sleep or sleeping
+        std::atomic<size_t> steals;
+        std::atomic<bool> stopping;
+        std::mutex sleepMutex;                           // Guards both condition variables
+        std::condition_variable wakeUp;                  // Workers wait here for work
+        std::condition_variable allDone;                 // wait() waits here for unfinished == 0
+        std::mutex errorMutex;
+        std::exception_ptr error;                        // First exception thrown by a task
+
+        inline static thread_local ThreadPool* currentPool = nullptr; // Pool the calling thread works for, if any
+        inline static thread_local size_t currentWorker = 0;          // Its index in that pool
+
+        void enqueue(Task* task);                        // Puts a task on a deque or the shared queue and wakes a worker
+        void workerLoop(size_t index);                   // Body of worker thread index
+        Task* findTask(size_t index);                    // Own deque, shared queue, then stealing; nullptr if nothing
+        void run(Task* task);                            // Runs and deletes a task, records its exception
+        void waitUntilIdle();                            // Blocks until unfinished == 0
+    };
+
+    /*
+     * Name: ThreadPool constructor
+     * Description: Starts the worker threads.
+     * Parameters: threads - Number of workers (default 0 means one per hardware thread).
+     * Returns: void - No return value.
+     */
+    inline ThreadPool::ThreadPool(size_t threads) : queued(0), unfinished(0), sleepers(0), steals(0), stopping(false) {
+        if (threads == 0) {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        for (size_t i = 0; i < threads; i++) {
+            workers.push_back(std::make_unique<Worker>(0x9E3779B97F4A7C15ull * (i + 1)));
+        }
+        this->threads.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            this->threads.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    /*
+     * Name: ThreadPool destructor
+     * Description: Waits for every task to finish, then stops and joins the workers. Exceptions not collected with
+     *              wait() are dropped.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline ThreadPool::~ThreadPool() {
+        waitUntilIdle();
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping.store(true, std::memory_order_release);
+        }
+        wakeUp.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /*
+     * Name: ThreadPool.wait
+     * Description: Blocks until every task has finished, including tasks submitted by tasks, then rethrows the first
+     *              exception a task threw (and forgets it).
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline void ThreadPool::wait() {
+        if (currentPool == this) {
+            throw std::logic_error("ThreadPool::wait cannot be called from inside one of its tasks");
+        }
+        waitUntilIdle();
+        std::exception_ptr failure;
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            std::swap(failure, error);
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    /*
+     * Name: ThreadPool.enqueue
+     * Description: Counts the task, puts it on the calling worker's deque (or the shared queue when called from outside
+     *              the pool) and wakes a worker if any are asleep. queued is raised before sleepers is read and a
+     *              sleeping worker raises sleepers before it reads queued, so at least one side always sees the other.
+     *              The counters go up before the push (a worker may run the task as soon as it is pushed), so if the push
+     *              throws (out of memory growing a deque or the queue's pool) they are taken back and the task deleted,
+     *              otherwise wait() and the destructor would wait for a task that never runs.
+     * Parameters: task - The task, owned by the pool from here on.
+     * Returns: void - No return value.
+     */
+    inline void ThreadPool::enqueue(Task* task) {
+        unfinished.fetch_add(1, std::memory_order_relaxed);
+        queued.fetch_add(1, std::memory_order_seq_cst);
+        try {
+            if (currentPool == this) {
+                workers[currentWorker]->deque.push_back(task);
+            } else {
+                injected.push(task);
+            }
+        } catch (...) {
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            delete task;
+            if (unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                { std::lock_guard<std::mutex> lock(sleepMutex); }
+                allDone.notify_all(); // Another thread may be in wait() for this count to reach zero
+            }
+            throw;
+        }
+        if (sleepers.load(std::memory_order_seq_cst) > 0) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); } // A worker between its check and its wait holds the mutex
+            wakeUp.notify_one();
+        }
+    }
+
+    /*
+     * Name: ThreadPool.workerLoop
+     * Description: Runs tasks until the pool stops. Spins (then yields) through spinRounds empty searches before
+     *              sleeping, so a burst of small tasks does not pay for a wake-up each.
+     * Parameters: index - This worker's index.
+     * Returns: void - No return value.
+     */
+    inline void ThreadPool::workerLoop(size_t index) {
+        currentPool = this;
+        currentWorker = index;
+        unsigned idle = 0;
+        while (true) {
+            if (Task* task = findTask(index)) {
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                run(task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < spinRounds) {
+                if (idle > spinRounds / 4) {
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wakeUp.wait(lock, [this] {
+                    return stopping.load(std::memory_order_acquire) || queued.load(std::memory_order_seq_cst) > 0;
+                });
+            }
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            if (stopping.load(std::memory_order_acquire)) {
+                return; // The destructor only stops the pool once every task has finished
+            }
+            idle = 0;
+        }
+    }
+
+    /*
+     * Name: ThreadPool.findTask
+     * Description: Takes the newest task from the worker's own deque, else one from the shared queue, else steals the
+     *              oldest task of another worker, trying every victim once starting at a random one.
+     * Parameters: index - The searching worker's index.
+     * Returns: Task* - A task to run, or nullptr if none was found.
+     */
+    inline ThreadPool::Task* ThreadPool::findTask(size_t index) {
+        Worker& self = *workers[index];
+        Task* task = nullptr;
+        if (self.deque.pop_back(task) || injected.try_pop(task)) {
+            return task;
+        }
+        const size_t count = workers.size();
+        self.random ^= self.random << 13;
+        self.random ^= self.random >> 7;
+        self.random ^= self.random << 17;
+        const size_t start = self.random % count;
+        for (size_t i = 0; i < count; i++) {
+            const size_t victim = (start + i) % count;
+            if (victim != index && workers[victim]->deque.steal(task)) {
+                steals.fetch_add(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    /*
+     * Name: ThreadPool.run
+     * Description: Runs a task and deletes it. The first exception thrown by any task is kept for wait(). The worker
+     *              that finishes the last task wakes wait().
+     * Parameters: task - The task to run.
+     * Returns: void - No return value.
+     */
+    inline void ThreadPool::run(Task* task) {
+        try {
+            (*task)();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        delete task;
+        if (unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            allDone.notify_all();
+        }
+    }
+
+    /*
+     * Name: ThreadPool.waitUntilIdle
+     * Description: Blocks until no task is queued or running.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    inline void ThreadPool::waitUntilIdle() {
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        allDone.wait(lock, [this] { return unfinished.load(std::memory_order_acquire) == 0; });
+    }
+
+}
+
+#endif //THREADPOOL_H
@@ -0,0 +1,389 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "doublelinkedlist.h"
+#include "nodepool.h"
+#include "slotmap.h" // SlotHandle
+/* Notes:
+ * Hierarchical timing wheel for the control loop's timeouts (sensor watchdogs, retransmits, actuator deadlines).
+ * Time is counted in ticks (whatever the loop's period is). schedule and cancel are O(1) no matter how many timers are
+ * pending, and advance() only touches the timers that are due (plus a cascade step every 256 ticks), instead of
+ * scanning or sorting a list of deadlines.
+ *
+ * Functions in the timing wheel class:
+ * schedule - Runs a callback delay ticks from now, returns the timer's handle. A deadline past the end of the clock
+ *            saturates to never. O(1).
+ * scheduleAt - Same, at an absolute tick. A tick that has already passed fires on the next tick. O(1).
+ * cancel - Stops a pending timer, returns false if it already fired or was cancelled. O(1).
+ * isPending - Checks if a timer has not fired or been cancelled yet.
+ * advance - Moves the clock forward to a tick and fires every timer due by then, returns how many fired.
+ * getNow / getSize / isEmpty - Current tick, number of pending timers, empty check.
+ * reserve - Makes room for n pending timers, so scheduling them does not allocate.
+ * clear - Cancels every pending timer without firing it.
+ *
+ * How it works:
+ * Four levels of 256 buckets each. Level 0 has one bucket per tick for the next 256 ticks. Level 1 has one bucket per
+ * 256 ticks, and so on; level 3 reaches 2^32 ticks ahead and anything further waits in an overflow bucket. A timer goes
+ * into the lowest level where its deadline and the current tick only differ in that level's 8 bits (or lower). When the
+ * clock crosses a multiple of 256^k, the level k bucket for the new position is cascaded: each of its timers moves down
+ * to the level its deadline now belongs in. Level 0's bucket for the current tick is spliced whole onto a firing list and
+ * drained, so timers fire in batches, one tick at a time, in no particular order within a tick. When the lower levels are
+ * empty, advance() jumps straight to the next cascade instead of stepping through empty ticks.
+ * Every bucket is a DoubleLinkedList, and all of them share one NodePool through NodePoolRef. A cascade moves a node
+ * between buckets with DoubleLinkedList::splice, it is never copied or reallocated. Handles are SlotHandles (index plus
+ * generation, as in SlotMap): a slot table points at the timer's node, and firing or cancelling a timer bumps its slot's
+ * generation, so cancelling a timer that already fired is safe and returns false.
+ * Callbacks run inside advance(). They may schedule and cancel timers (a timer scheduled for the current tick or
+ * earlier fires on the next tick), but must not call advance(). If a callback throws, advance() rethrows and the rest
+ * of that tick's batch fires on the next call. Not thread safe: schedule from the thread that calls advance().
+ * The clock stops at never - 1 (UINT64_MAX - 1), so a timer scheduled at never stays pending until it is cancelled.
+ */
+
+namespace CommandaStructures {
+
+    template<typename Callback = std::function<void()>>
+    class TimingWheel {
+    public:
+        using Handle = SlotHandle;
+        static constexpr uint64_t never = UINT64_MAX;    // Deadline that never fires, the clock stops one tick short of it
+
+        explicit TimingWheel(uint64_t startTick = 0);    // Empty wheel with its clock at startTick
+        TimingWheel(const TimingWheel&) = delete;        // The buckets point at this wheel's node pool
+        TimingWheel& operator=(const TimingWheel&) = delete;
+        Handle schedule(uint64_t delay, Callback callback) {                 // Fires delay ticks from now (never if that overflows)
+            return scheduleAt(delay >= never - now ? never : now + delay, std::move(callback));
+        }
+        Handle scheduleAt(uint64_t deadline, Callback callback); // Fires at an absolute tick, returns the timer's handle
+        bool cancel(Handle handle);                      // Stops a pending timer, false if it already fired or was cancelled
+        [[nodiscard]] bool isPending(Handle handle) const; // Checks if a timer is still waiting to fire
+        size_t advance(uint64_t target);                 // Moves the clock to target and fires every timer due, returns how many fired
+        [[nodiscard]] uint64_t getNow() const { return now; }      // Current tick
+        [[nodiscard]] size_t getSize() const { return pending; }   // Number of pending timers
+        [[nodiscard]] bool isEmpty() const { return pending == 0; } // Checks if no timer is pending
+        void reserve(size_t timers);                     // Makes room for n pending timers
+        void clear();                                    // Cancels every pending timer without firing it
+
+    private:
+        static constexpr unsigned levels = 4;
+        static constexpr unsigned levelBits = 8;
+        static constexpr uint32_t slotsPerLevel = 1u << levelBits;
+        static constexpr uint32_t overflowBucket = levels * slotsPerLevel; // Deadlines 2^32 or more ticks ahead
+        static constexpr uint32_t firingBucket = overflowBucket + 1;       // Timers due in the current tick
+        static constexpr uint32_t none = UINT32_MAX;     // End of the free list
+
+        struct Timer {
+            uint64_t deadline;                           // Tick the timer fires at
+            Callback callback;
+            uint32_t slot;                               // The slot its handle refers to
+            uint32_t bucket;                             // The bucket it is linked in
+        };
+        using Bucket = DoubleLinkedList<Timer, NodePoolRef>;
+        using Node = DoubleNode<Timer>;
+        struct Slot {
+            Node* node;                                  // The timer's node while pending, nullptr while free
+            uint32_t generation;                         // Bumped when the timer fires or is cancelled, never 0
+            uint32_t nextFree;                           // Next free slot while free
+        };
+
+        NodePool<Node> pool;                             // Every bucket's nodes, declared first so it outlives them
+        std::vector<Bucket> buckets;                     // levels * slotsPerLevel, then overflow, then firing
+        Bucket scratch;                                  // Holds a bucket's timers while they are cascaded
+        size_t levelCount[levels + 1] = {};              // Pending timers per level (last one: overflow)
+        std::vector<Slot> slots;
+        uint32_t freeHead = none;                        // First free slot
+        uint64_t now;
+        size_t pending = 0;
+        bool advancing = false;                          // Set while advance() runs, to catch a callback calling it
+
+        uint32_t bucketFor(uint64_t deadline) const;     // The bucket a deadline belongs in at the current tick
+        static unsigned levelOf(uint32_t bucket) { return bucket / slotsPerLevel; } // Level of a bucket (levels = overflow)
+        void link(Node* node, Bucket& from);             // Moves a node from another bucket to the bucket of its deadline
+        void cascade(uint32_t bucket);                   // Moves a bucket's timers down to the level they belong in now
+        void tick(uint64_t current);                     // Sets the clock, cascades and moves the tick's timers to firing
+        size_t drain();                                  // Fires the timers on the firing list
+        void release(Node* node);                        // Frees a timer's slot (its handle goes stale) and its node
+    };
+
+    /*
+     * Name: TimingWheel constructor
+     * Description: Creates the buckets, all empty and sharing this wheel's node pool.
+     * Parameters: startTick - The tick the clock starts at (default is 0).
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    TimingWheel<Callback>::TimingWheel(uint64_t startTick) : scratch(pool), now(std::min(startTick, never - 1)) {
+        buckets.reserve(firingBucket + 1);
+        for (uint32_t i = 0; i <= firingBucket; i++) {
+            buckets.emplace_back(pool);
+        }
+    }
+
+    /*
+     * Name: TimingWheel.scheduleAt
+     * Description: Adds a timer in the bucket its deadline belongs in. A deadline at or before the current tick is
+     *              moved to the next tick, since the current one has already fired.
+     * Parameters: deadline - The tick to fire at.
+     *             callback - The function to call when the timer fires.
+     * Returns: Handle - The timer's handle, for cancel() and isPending().
+     */
+    template<typename Callback>
+    typename TimingWheel<Callback>::Handle TimingWheel<Callback>::scheduleAt(uint64_t deadline, Callback callback) {
+        deadline = std::max(deadline, now + 1);
+        if (freeHead == none) {
+            if (slots.size() >= none) {
+                throw std::length_error("TimingWheel has too many timers");
+            }
+            slots.push_back(Slot{nullptr, 1, none}); // A spare free slot is harmless if the insert below throws
+            freeHead = static_cast<uint32_t>(slots.size() - 1);
+        }
+        const uint32_t slotIndex = freeHead;
+        const uint32_t bucket = bucketFor(deadline);
+        buckets[bucket].emplace_back(Timer{deadline, std::move(callback), slotIndex, bucket});
+        Slot& slot = slots[slotIndex];
+        freeHead = slot.nextFree;
+        slot.node = buckets[bucket].getTail();
+        levelCount[levelOf(bucket)]++;
+        pending++;
+        return Handle(slotIndex, slot.generation);
+    }
+
+    /*
+     * Name: TimingWheel.cancel
+     * Description: Unlinks a pending timer from its bucket (or from the firing list, if it is due in the tick being
+     *              fired) and frees it without calling its callback.
+     * Parameters: handle - The timer's handle.
+     * Returns: bool - True if the timer was cancelled, false if it already fired or was cancelled before.
+     */
+    template<typename Callback>
+    bool TimingWheel<Callback>::cancel(Handle handle) {
+        if (!isPending(handle)) {
+            return false;
+        }
+        Node* node = slots[handle.index()].node;
+        const uint32_t bucket = node->getData().bucket;
+        if (bucket != firingBucket) {
+            levelCount[levelOf(bucket)]--;
+        }
+        release(node);
+        return true;
+    }
+
+    template<typename Callback>
+    bool TimingWheel<Callback>::isPending(Handle handle) const {
+        return handle.index() < slots.size() && slots[handle.index()].generation == handle.generation() && slots[handle.index()].node;
+    }
+
+    /*
+     * Name: TimingWheel.advance
+     * Description: Moves the clock forward one tick at a time up to target, cascading and firing each tick's timers. While
+     *              level 0 is empty it jumps to the next tick where a higher level cascades (or straight to target if
+     *              nothing is pending), so long idle stretches cost O(1).
+     * Parameters: target - The tick to move to, at most never - 1. A tick at or before the current one only fires
+     *             leftovers of a batch interrupted by an exception.
+     * Returns: size_t - The number of timers that fired. Throws std::logic_error if called from a callback.
+     */
+    template<typename Callback>
+    size_t TimingWheel<Callback>::advance(uint64_t target) {
+        if (advancing) {
+            throw std::logic_error("TimingWheel advance called from a timer callback");
+        }
+        target = std::min(target, never - 1); // Timers at never must not fire
+        advancing = true;
+        try {
+            size_t fired = drain();
+            while (now < target) {
+                uint64_t next = now + 1;
+                if (levelCount[0] == 0) {
+                    unsigned level = 1;
+                    while (level <= levels && levelCount[level] == 0) {
+                        level++;
+                    }
+                    if (level > levels) {
+                        now = target; // Nothing pending
+                        break;
+                    }
+                    const unsigned shift = levelBits * level;
+                    const uint64_t block = now >> shift;
+                    if (block == (never >> shift)) {
+                        now = target; // Last block of that level, there is no later cascade (the next one would wrap to 0)
+                        break;
+                    }
+                    next = (block + 1) << shift; // Next cascade of that level
+                    if (next > target) {
+                        now = target;
+                        break;
+                    }
+                }
+                tick(next);
+                fired += drain();
+            }
+            advancing = false;
+            return fired;
+        } catch (...) {
+            advancing = false;
+            throw;
+        }
+    }
+
+    /*
+     * Name: TimingWheel.reserve
+     * Description: Makes room for n pending timers, so scheduling up to n does not allocate nodes or slots.
+     * Parameters: timers - The number of timers.
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    void TimingWheel<Callback>::reserve(size_t timers) {
+        pool.reserve(timers);
+        slots.reserve(timers);
+    }
+
+    /*
+     * Name: TimingWheel.clear
+     * Description: Cancels every pending timer without calling its callback, all their handles become stale.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    void TimingWheel<Callback>::clear() {
+        for (Bucket& bucket : buckets) {
+            while (Node* node = bucket.getHead()) {
+                release(node);
+            }
+        }
+        std::fill(std::begin(levelCount), std::end(levelCount), 0);
+    }
+
+    /*
+     * Name: TimingWheel.bucketFor
+     * Description: Finds the lowest level where the deadline and the current tick differ only in that level's bits or
+     *              below; the deadline's bits for that level pick the bucket. Past level 3 it is the overflow bucket.
+     * Parameters: deadline - The deadline, not before the current tick.
+     * Returns: uint32_t - The bucket's index.
+     */
+    template<typename Callback>
+    uint32_t TimingWheel<Callback>::bucketFor(uint64_t deadline) const {
+        const uint64_t differs = deadline ^ now;
+        for (unsigned level = 0; level < levels; level++) {
+            if ((differs >> (levelBits * (level + 1))) == 0) {
+                return level * slotsPerLevel + static_cast<uint32_t>((deadline >> (levelBits * level)) & (slotsPerLevel - 1));
+            }
+        }
+        return overflowBucket;
+    }
+
+    /*
+     * Name: TimingWheel.link
+     * Description: Moves a timer's node from a bucket to the bucket its deadline belongs in at the current tick.
+     * Parameters: node - The timer's node.
+     *             from - The bucket it is in now.
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    void TimingWheel<Callback>::link(Node* node, Bucket& from) {
+        Timer& timer = node->getData();
+        timer.bucket = bucketFor(timer.deadline);
+        buckets[timer.bucket].splice(from, node);
+        levelCount[levelOf(timer.bucket)]++;
+    }
+
+    /*
+     * Name: TimingWheel.cascade
+     * Description: Takes every timer out of a bucket (through the scratch list, since an overflow timer can land in the
+     *              overflow bucket again) and links each one into the bucket it belongs in now.
+     * Parameters: bucket - The bucket's index.
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    void TimingWheel<Callback>::cascade(uint32_t bucket) {
+        if (buckets[bucket].getSize() == 0) {
+            return;
+        }
+        levelCount[levelOf(bucket)] -= buckets[bucket].getSize();
+        scratch.splice(buckets[bucket]);
+        while (Node* node = scratch.getHead()) {
+            link(node, scratch);
+        }
+    }
+
+    /*
+     * Name: TimingWheel.tick
+     * Description: Sets the clock to a tick. Cascades the overflow bucket every 2^32 ticks, then each level whose lower
+     *              bits of the tick are all zero, highest first (so timers can cascade more than one level down in one
+     *              tick). The level 0 bucket of the tick is then spliced onto the firing list.
+     * Parameters: current - The new current tick.
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    void TimingWheel<Callback>::tick(uint64_t current) {
+        now = current;
+        if ((current & ((uint64_t{1} << (levelBits * levels)) - 1)) == 0) {
+            cascade(overflowBucket);
+        }
+        for (unsigned level = levels - 1; level > 0; level--) {
+            const unsigned shift = levelBits * level;
+            if ((current & ((uint64_t{1} << shift) - 1)) == 0) {
+                cascade(level * slotsPerLevel + static_cast<uint32_t>((current >> shift) & (slotsPerLevel - 1)));
+            }
+        }
+        Bucket& due = buckets[static_cast<uint32_t>(current & (slotsPerLevel - 1))];
+        levelCount[0] -= due.getSize();
+        for (Timer& timer : due) {
+            timer.bucket = firingBucket;
+        }
+        buckets[firingBucket].splice(due);
+    }
+
+    /*
+     * Name: TimingWheel.drain
+     * Description: Fires the timers on the firing list one by one. Each timer is freed (its handle goes stale) before
+     *              its callback runs, so the callback can schedule new timers and cancel others, including ones still
+     *              waiting on the firing list.
+     * Parameters: None
+     * Returns: size_t - The number of timers that fired.
+     */
+    template<typename Callback>
+    size_t TimingWheel<Callback>::drain() {
+        Bucket& firing = buckets[firingBucket];
+        size_t fired = 0;
+        while (Node* node = firing.getHead()) {
+            Callback callback = std::move(node->getData().callback);
+            release(node);
+            fired++;
+            callback();
+        }
+        return fired;
+    }
+
+    /*
+     * Name: TimingWheel.release
+     * Description: Bumps the timer's slot generation, puts the slot on the free list and removes the node from its
+     *              bucket. The caller keeps levelCount up to date.
+     * Parameters: node - The timer's node.
+     * Returns: void - No return value.
+     */
+    template<typename Callback>
+    void TimingWheel<Callback>::release(Node* node) {
+        const Timer& timer = node->getData();
+        Slot& slot = slots[timer.slot];
+        slot.node = nullptr;
+        slot.generation = slot.generation + 1 == 0 ? 1 : slot.generation + 1; // 0 stays reserved for the null handle
+        slot.nextFree = freeHead;
+        freeHead = timer.slot;
+        buckets[timer.bucket].removeNode(node);
+        pending--;
+    }
+
+}
+
+#endif //TIMINGWHEEL_H
@@ -0,0 +1,600 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "nodepool.h" // Default node allocator
+#include "nodes.h"    // Include the UnrolledNode class definition
+using namespace CommandaStructures::Unrolled;
+/* Notes:
+ * Singly linked list that stores a small array of values in every node (an "unrolled" linked list). A LinkedList<float>
+ * spends 16 bytes of node on every 4 byte value and takes a cache miss on every step of the iterator, an
+ * UnrolledList<float> packs 28 values into one 128 byte node, so a full traversal reads the memory almost like an array.
+ *
+ * Functions in the unrolled list class:
+ * insert - Inserts a value at a position (HEAD, TAIL or an index), same as LinkedList::insert. O(1) at the ends. An rvalue is moved in.
+ * remove - Removes the first value equal to the given one.
+ * find - Returns an iterator to the first value equal to the given one, or end().
+ * contains - Checks if the list holds a value equal to the given one.
+ * reverse - Reverses the list in place.
+ * front / back - Returns the first / last value.
+ * clear - Removes every value.
+ * display - Calls a function for every value, in order.
+ * getSize / isEmpty / getNodeCount - Number of values, empty check, number of nodes.
+ * Copying copies every value (node layout is rebuilt densely), moving hands the nodes over in O(1), like LinkedList.
+ *
+ * Layout:
+ * NodeBytes (default 128, two cache lines) is the size each node aims for; the node keeps (NodeBytes - 16) / sizeof(T)
+ * values (at least one). Nodes are never empty. Appending fills the tail node before a new one is started, an insert
+ * into a full node splits it in half, and a remove merges a node that drops below half full into its successor when
+ * both fit in one node, so the list stays at least about half dense. Nodes are cache line aligned, so NodeBytes should
+ * be a multiple of 64.
+ * Inserting or removing in the middle moves the values after it within their node, so pointers and references to values
+ * are invalidated by any insert or remove (iterators too). Nodes come from Allocator, a NodePool by default.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T, size_t NodeBytes = 128, template<typename> class Allocator = NodePool>
+    class UnrolledList {
+    public:
+        // Values per node
+        static constexpr size_t nodeCapacity = NodeBytes > 2 * sizeof(void*) + sizeof(T) ? (NodeBytes - 2 * sizeof(void*)) / sizeof(T) : 1;
+        using Node = UnrolledNode<T, nodeCapacity>;
+
+        UnrolledList();
+        explicit UnrolledList(Allocator<Node> nodeAllocator); // Uses the given allocator, e.g. an ArenaAllocator bound to an arena
+        UnrolledList(const UnrolledList& other);       // Deep copy, the copy gets its own allocator (same arena for ArenaAllocator)
+        UnrolledList(UnrolledList&& other) noexcept(std::is_nothrow_move_constructible_v<Allocator<Node>>); // Takes over the nodes, O(1)
+        UnrolledList& operator=(const UnrolledList& other);
+        UnrolledList& operator=(UnrolledList&& other) noexcept(std::is_nothrow_move_assignable_v<Allocator<Node>>);
+        ~UnrolledList();
+        void insert(const T& value, int spot = TAIL);  // Inserts a value at spot (default is TAIL, which appends to the end)
+        void insert(T&& value, int spot = TAIL);       // Same, but moves the value in
+        void remove(const T& value);                   // Removes the first value equal to value
+        template<typename Func>
+        void display(Func func) const;                 // Calls func on every value, in order
+        T& front() const;                              // First value
+        T& back() const;                               // Last value
+        [[nodiscard]] size_t getSize() const { return size; }            // Number of values
+        [[nodiscard]] bool isEmpty() const { return size == 0; }         // Checks if the list is empty
+        [[nodiscard]] size_t getNodeCount() const { return nodeCount; }  // Number of nodes
+        void clear();                                  // Removes every value
+        void reverse();                                // Reverses the list in place
+        Allocator<Node>& getAllocator() { return allocator; }            // Node allocator, e.g. for reserve() / highWater()
+        const Allocator<Node>& getAllocator() const { return allocator; }
+
+        enum Spot {
+            HEAD = 0, // Insert at the front
+            TAIL = -1 // Insert at the end (default behavior)
+        };
+
+        class Iterator {
+        public:
+            Iterator(Node* node, size_t index) : node(node), index(index) {}
+            T& operator*() const { return node->items()[index]; }
+            T* operator->() const { return node->items() + index; }
+            Iterator& operator++() {
+                if (++index == node->count) { // Nodes are never empty, so the next node starts at 0
+                    node = node->next;
+                    index = 0;
+                }
+                return *this;
+            }
+            Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+            bool operator!=(const Iterator& other) const { return node != other.node || index != other.index; }
+            bool operator==(const Iterator& other) const { return node == other.node && index == other.index; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+        private:
+            Node* node;
+            size_t index;
+        };
+
+        Iterator begin() const { return Iterator(head, 0); }
+        Iterator end() const { return Iterator(nullptr, 0); }
+        Iterator find(const T& value) const;           // Iterator to the first value equal to value, or end()
+        bool contains(const T& value) const { return find(value) != end(); } // Checks if the list holds value
+
+        class ConstIterator {
+        public:
+            ConstIterator(const Node* node, size_t index) : node(node), index(index) {}
+            const T& operator*() const { return node->items()[index]; }
+            const T* operator->() const { return node->items() + index; }
+            ConstIterator& operator++() {
+                if (++index == node->count) {
+                    node = node->next;
+                    index = 0;
+                }
+                return *this;
+            }
+            ConstIterator operator++(int) { ConstIterator old = *this; ++*this; return old; }
+            bool operator!=(const ConstIterator& other) const { return node != other.node || index != other.index; }
+            bool operator==(const ConstIterator& other) const { return node == other.node && index == other.index; }
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+        private:
+            const Node* node;
+            size_t index;
+        };
+        ConstIterator cbegin() const { return ConstIterator(head, 0); }
+        ConstIterator cend() const { return ConstIterator(nullptr, 0); }
+
+    private:
+        size_t size;      // Number of values
+        size_t nodeCount; // Number of nodes
+        Node* head;       // First node
+        Node* tail;       // Last node
+        Allocator<Node> allocator; // Where the nodes come from
+
+        Node* createNode(Node* after);                 // Allocates an empty node and links it in after after (or as the head)
+        void destroyNode(Node* node);                  // Destroys the node's values and gives its memory back
+        template<typename U>
+        void insertValue(U&& value, int spot);         // Shared body of the two insert overloads
+        template<typename U>
+        void insertInto(Node* node, size_t index, U&& value);      // Inserts into a node that is not full
+        static Allocator<Node> copyAllocator(const Allocator<Node>& source); // Allocator for a copy of the list
+        Node* split(Node* node);                       // Moves the upper half of a full node into a new node after it
+        void eraseFrom(Node* node, Node* prev, size_t index);      // Removes one value, unlinking or merging the node if needed
+    };
+
+    /*
+     * Name: UnrolledList constructor
+     * Description: Initializes an empty list with the head and tail pointer set to nullptr.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>::UnrolledList() : size(0), nodeCount(0), head(nullptr), tail(nullptr) {}
+
+    /*
+     * Name: UnrolledList constructor (allocator)
+     * Description: Initializes an empty list that gets its nodes from the given allocator.
+     * Parameters: nodeAllocator - The allocator to use, e.g. ArenaAllocator (constructible straight from an Arena).
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>::UnrolledList(Allocator<Node> nodeAllocator)
+        : size(0), nodeCount(0), head(nullptr), tail(nullptr), allocator(std::move(nodeAllocator)) {}
+
+    /*
+     * Name: UnrolledList copy constructor
+     * Description: Initializes a list holding copies of other's values, in the same order, packed into full nodes.
+     *              A copyable allocator (ArenaAllocator, std::allocator) is copied, a NodePool is not shared: the copy gets its own.
+     * Parameters: other - The list to copy.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>::UnrolledList(const UnrolledList& other)
+        : size(0), nodeCount(0), head(nullptr), tail(nullptr), allocator(copyAllocator(other.allocator)) {
+        try {
+            for (const Node* node = other.head; node; node = node->next) {
+                const T* items = node->items();
+                for (size_t i = 0; i < node->count; i++) {
+                    insert(items[i]); // Appends, which fills each node before starting the next
+                }
+            }
+        } catch (...) {
+            clear(); // The destructor does not run for a half-built object
+            throw;
+        }
+    }
+
+    /*
+     * Name: UnrolledList move constructor
+     * Description: Takes over other's nodes and allocator without touching a single value. other is left empty.
+     * Parameters: other - The list to move from.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>::UnrolledList(UnrolledList&& other) noexcept(std::is_nothrow_move_constructible_v<Allocator<Node>>)
+        : size(std::exchange(other.size, 0)), nodeCount(std::exchange(other.nodeCount, 0)),
+          head(std::exchange(other.head, nullptr)), tail(std::exchange(other.tail, nullptr)), allocator(std::move(other.allocator)) {}
+
+    /*
+     * Name: UnrolledList copy assignment
+     * Description: Replaces the contents with copies of other's values (copy, then move into place).
+     * Parameters: other - The list to copy.
+     * Returns: UnrolledList& - This list.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>& UnrolledList<T, NodeBytes, Allocator>::operator=(const UnrolledList& other) {
+        if (this != &other) {
+            *this = UnrolledList(other); // If copying throws, this list is untouched
+        }
+        return *this;
+    }
+
+    /*
+     * Name: UnrolledList move assignment
+     * Description: Destroys this list's nodes, then takes over other's nodes and allocator. other is left empty.
+     * Parameters: other - The list to move from.
+     * Returns: UnrolledList& - This list.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>& UnrolledList<T, NodeBytes, Allocator>::operator=(UnrolledList&& other) noexcept(std::is_nothrow_move_assignable_v<Allocator<Node>>) {
+        if (this != &other) {
+            clear(); // Our nodes go back to our allocator before it is replaced
+            allocator = std::move(other.allocator);
+            head = std::exchange(other.head, nullptr);
+            tail = std::exchange(other.tail, nullptr);
+            size = std::exchange(other.size, 0);
+            nodeCount = std::exchange(other.nodeCount, 0);
+        }
+        return *this;
+    }
+
+    /*
+     * Name: UnrolledList destructor
+     * Description: Destroys every value and gives the nodes back to the allocator.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    UnrolledList<T, NodeBytes, Allocator>::~UnrolledList() {
+        clear();
+    }
+
+    /*
+     * Name: UnrolledList.insert
+     * Description: Inserts a value at the given position. Appending fills the tail node and only starts a new node when
+     *              it is full; inserting into a full node in the middle splits it first.
+     * Parameters: value - The value to be inserted.
+     *             spot - HEAD (0) for the front, TAIL (-1, default) or any index past the end for the back,
+     *                    otherwise the index the value will have.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::insert(const T& value, int spot) {
+        insertValue(value, spot);
+    }
+
+    /*
+     * Name: UnrolledList.insert (move)
+     * Description: Same as insert, but the value is moved into the node instead of copied.
+     * Parameters: value - The value to be moved in.
+     *             spot - Same as for insert.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::insert(T&& value, int spot) {
+        insertValue(std::move(value), spot);
+    }
+
+    /*
+     * Name: UnrolledList.insertValue
+     * Description: Inserts a value (copied from an lvalue, moved from an rvalue) at the given position, see insert.
+     * Parameters: value - The value to be inserted.
+     *             spot - Same as for insert.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    template<typename U>
+    void UnrolledList<T, NodeBytes, Allocator>::insertValue(U&& value, int spot) {
+        // Append: O(1), no walk
+        if (spot < 0 || static_cast<size_t>(spot) >= size) {
+            Node* node = (!tail || tail->isFull()) ? createNode(tail) : tail;
+            insertInto(node, node->count, std::forward<U>(value));
+            return;
+        }
+        // Prepend: a full head gets a fresh node in front of it instead of a split, so repeated HEAD inserts stay dense
+        if (spot == HEAD) {
+            Node* node = head->isFull() ? createNode(nullptr) : head;
+            insertInto(node, 0, std::forward<U>(value));
+            return;
+        }
+        // Walk whole nodes until the index falls inside one
+        size_t index = static_cast<size_t>(spot);
+        Node* node = head;
+        while (index > node->count) {
+            index -= node->count;
+            node = node->next;
+        }
+        if (node->isFull()) {
+            Node* upper = split(node);
+            if (index > node->count) {
+                index -= node->count;
+                node = upper;
+            }
+        }
+        insertInto(node, index, std::forward<U>(value));
+    }
+
+    /*
+     * Name: UnrolledList.remove
+     * Description: Removes the first value equal to the given one, if there is one.
+     * Parameters: value - The value to be removed.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::remove(const T& value) {
+        Node* prev = nullptr;
+        for (Node* node = head; node; prev = node, node = node->next) {
+            T* items = node->items();
+            for (size_t i = 0; i < node->count; i++) {
+                if (items[i] == value) {
+                    eraseFrom(node, prev, i);
+                    return;
+                }
+            }
+        }
+        // If we didn't find the value, do nothing
+    }
+
+    /*
+     * Name: UnrolledList.display
+     * Description: Calls a function for every value in the list, in order.
+     * Parameters: func - The function to call with each value.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    template<typename Func>
+    void UnrolledList<T, NodeBytes, Allocator>::display(Func func) const {
+        for (const Node* node = head; node; node = node->next) {
+            const T* items = node->items();
+            for (size_t i = 0; i < node->count; i++) {
+                func(items[i]);
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    /*
+     * Name: UnrolledList.front
+     * Description: Returns the first value in the list.
+     * Parameters: None
+     * Returns: T& - Reference to the first value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    T& UnrolledList<T, NodeBytes, Allocator>::front() const {
+        if (!head) {
+            throw std::out_of_range("UnrolledList is empty");
+        }
+        return head->items()[0];
+    }
+
+    /*
+     * Name: UnrolledList.back
+     * Description: Returns the last value in the list.
+     * Parameters: None
+     * Returns: T& - Reference to the last value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    T& UnrolledList<T, NodeBytes, Allocator>::back() const {
+        if (!tail) {
+            throw std::out_of_range("UnrolledList is empty");
+        }
+        return tail->items()[tail->count - 1];
+    }
+
+    /*
+     * Name: UnrolledList.find
+     * Description: Finds the first value equal to the given one, scanning each node's array in turn.
+     * Parameters: value - The value to search for.
+     * Returns: Iterator - Iterator to the value, or end() if it is not in the list.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    typename UnrolledList<T, NodeBytes, Allocator>::Iterator UnrolledList<T, NodeBytes, Allocator>::find(const T& value) const {
+        for (Node* node = head; node; node = node->next) {
+            const T* items = node->items();
+            for (size_t i = 0; i < node->count; i++) {
+                if (items[i] == value) {
+                    return Iterator(node, i);
+                }
+            }
+        }
+        return end();
+    }
+
+    /*
+     * Name: UnrolledList.clear
+     * Description: Removes every value and gives the nodes back to the allocator.
+     *              With an allocator that releases in bulk (ArenaAllocator) and a trivially destructible T, the nodes are
+     *              just forgotten in O(1), the arena takes the memory back on reset() / rollback().
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::clear() {
+        if constexpr (!(allocatorReleasesInBulk<Allocator<Node>> && std::is_trivially_destructible_v<T>)) {
+            Node* current = head;
+            while (current) {
+                Node* nextNode = current->next;
+                destroyNode(current);
+                current = nextNode;
+            }
+        }
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+        nodeCount = 0;
+    }
+
+    /*
+     * Name: UnrolledList.reverse
+     * Description: Reverses the list in place: the node chain is reversed and so is the array inside every node.
+     * Parameters: None
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::reverse() {
+        Node* prev = nullptr;
+        Node* current = head;
+        tail = head;
+        while (current) {
+            Node* nextNode = current->next;
+            std::reverse(current->items(), current->items() + current->count);
+            current->next = prev;
+            prev = current;
+            current = nextNode;
+        }
+        head = prev;
+    }
+
+    /*
+     * Name: UnrolledList.createNode
+     * Description: Gets memory for a node from the allocator, constructs an empty node in it and links it in.
+     * Parameters: after - The node to link the new node after, or nullptr to make it the new head.
+     * Returns: Node* - The new, empty node.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    typename UnrolledList<T, NodeBytes, Allocator>::Node* UnrolledList<T, NodeBytes, Allocator>::createNode(Node* after) {
+        Node* node = std::construct_at(allocator.allocate(1));
+        if (after) {
+            node->next = after->next;
+            after->next = node;
+        } else {
+            node->next = head;
+            head = node;
+        }
+        if (tail == after) {
+            tail = node; // Appended after the tail (or the list was empty)
+        }
+        nodeCount++;
+        return node;
+    }
+
+    /*
+     * Name: UnrolledList.destroyNode
+     * Description: Destroys the values in a node and returns its memory to the allocator.
+     * Parameters: node - The node to destroy (already unlinked).
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::destroyNode(Node* node) {
+        std::destroy(node->items(), node->items() + node->count);
+        std::destroy_at(node);
+        allocator.deallocate(node, 1);
+    }
+
+    /*
+     * Name: UnrolledList.insertInto
+     * Description: Inserts a value into a node that has room, moving the values after index up by one.
+     *              A freshly created node whose first value fails to copy is unlinked again, so nodes are never empty.
+     * Parameters: node - The node, must not be full.
+     *             index - Position inside the node (0 to count).
+     *             value - The value to insert.
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    template<typename U>
+    void UnrolledList<T, NodeBytes, Allocator>::insertInto(Node* node, size_t index, U&& value) {
+        T* items = node->items();
+        if (index < node->count) {
+            T copy(std::forward<U>(value)); // value may refer to an element that is about to move
+            std::construct_at(items + node->count, std::move(items[node->count - 1]));
+            node->count++;
+            size++;
+            std::move_backward(items + index, items + node->count - 2, items + node->count - 1);
+            items[index] = std::move(copy);
+            return;
+        }
+        try {
+            std::construct_at(items + index, std::forward<U>(value));
+        } catch (...) {
+            if (node->count == 0) {
+                Node* prev = nullptr;
+                if (node != head) {
+                    prev = head;
+                    while (prev->next != node) prev = prev->next;
+                }
+                eraseFrom(node, prev, 0);
+            }
+            throw;
+        }
+        node->count++;
+        size++;
+    }
+
+    /*
+     * Name: UnrolledList.copyAllocator
+     * Description: Picks the allocator for a copy of the list: a copy of source if the allocator can be copied
+     *              (ArenaAllocator keeps using the same arena), else a fresh one (every list owns its own NodePool).
+     * Parameters: source - The allocator of the list being copied.
+     * Returns: Allocator<Node> - The allocator for the copy.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    Allocator<typename UnrolledList<T, NodeBytes, Allocator>::Node> UnrolledList<T, NodeBytes, Allocator>::copyAllocator(const Allocator<Node>& source) {
+        if constexpr (std::is_copy_constructible_v<Allocator<Node>>) {
+            return source;
+        } else {
+            return Allocator<Node>();
+        }
+    }
+
+    /*
+     * Name: UnrolledList.split
+     * Description: Moves the upper half of a full node into a new node linked in right after it.
+     * Parameters: node - The full node.
+     * Returns: Node* - The new node holding the upper half.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    typename UnrolledList<T, NodeBytes, Allocator>::Node* UnrolledList<T, NodeBytes, Allocator>::split(Node* node) {
+        Node* upper = createNode(node);
+        const size_t keep = node->count / 2;
+        T* items = node->items();
+        std::uninitialized_move(items + keep, items + node->count, upper->items());
+        std::destroy(items + keep, items + node->count);
+        upper->count = node->count - keep;
+        node->count = keep;
+        return upper;
+    }
+
+    /*
+     * Name: UnrolledList.eraseFrom
+     * Description: Removes one value from a node. An emptied node is unlinked, and a node that falls below half full is
+     *              merged with its successor when both fit in one node.
+     * Parameters: node - The node holding the value.
+     *             prev - The node before it (nullptr if node is the head).
+     *             index - Position of the value inside the node (or 0 for an empty node).
+     * Returns: void - No return value.
+     */
+    template<typename T, size_t NodeBytes, template<typename> class Allocator>
+    void UnrolledList<T, NodeBytes, Allocator>::eraseFrom(Node* node, Node* prev, size_t index) {
+        T* items = node->items();
+        if (node->count > 0) {
+            std::move(items + index + 1, items + node->count, items + index);
+            std::destroy_at(items + node->count - 1);
+            node->count--;
+            size--;
+        }
+
+        Node* next = node->next;
+        if (node->count == 0) {
+            (prev ? prev->next : head) = next;
+            if (tail == node) tail = prev;
+            destroyNode(node);
+            nodeCount--;
+        } else if (next && node->count < nodeCapacity / 2 && node->count + next->count <= nodeCapacity) {
+            std::uninitialized_move(next->items(), next->items() + next->count, items + node->count);
+            node->count += next->count;
+            std::destroy(next->items(), next->items() + next->count);
+            next->count = 0;
+            node->next = next->next;
+            if (tail == next) tail = node;
+            destroyNode(next);
+            nodeCount--;
+        }
+    }
+
+}
+
+#endif //UNROLLEDLIST_H
@@ -0,0 +1,200 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+/* Notes:
+ * Chase-Lev work-stealing deque. One owner thread pushes and pops at the back, any number of thief threads steal
+ * from the front. The owner's push_back / pop_back are plain loads and stores plus a fence: the only read-modify-write
+ * is a CAS when the owner takes the very last element, the one case where it can race a thief. Thieves always CAS.
+ *
+ * Functions in the work-stealing deque class:
+ * push_back - Owner only. Adds an element at the back, growing the array if it is full.
+ * pop_back - Owner only. Removes the newest element into out, returns false if the deque is empty.
+ * steal - Any thread. Removes the oldest element into out, returns false if the deque is empty or another thread won.
+ * getSize - Returns the number of elements (snapshot).
+ * isEmpty - Checks if the deque is empty (snapshot).
+ * capacity - Returns the current size of the circular array.
+ *
+ * How it works (Le, Pop, Cohen and Zappa Nardelli's C11 version of Chase and Lev's algorithm):
+ * top and bottom are free-running 64-bit indices into a circular array, the elements live in [top, bottom). The owner
+ * moves bottom, thieves move top with a CAS. When the array is full the owner copies the live elements into one twice
+ * the size and publishes it; a thief may still be reading the old array, so old arrays are kept until the deque is
+ * destroyed (together they are never larger than the current one). Elements are copied in and out racily by design,
+ * so T must be trivially copyable, typically a pointer or an index to the real work item.
+ *
+ * ThreadSanitizer does not model the two seq_cst fences (GCC warns about them under -DCOMMANDA_TSAN=ON). They only
+ * order the accesses to top and bottom, which are atomics, so TSan still checks everything published through the deque.
+ */
+
+namespace CommandaStructures {
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    class WorkStealingDeque {
+    public:
+        explicit WorkStealingDeque(size_t capacity = 256);
+        ~WorkStealingDeque() = default;
+        WorkStealingDeque(const WorkStealingDeque&) = delete;    // Shared between threads, copying makes no sense
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+        void push_back(const T& value);                          // Owner only: adds an element at the back
+        bool pop_back(T& out);                                   // Owner only: removes the newest element, false if empty
+        bool steal(T& out);                                      // Any thread: removes the oldest element, false if empty or lost the race
+        [[nodiscard]] size_t getSize() const;                    // Number of elements (snapshot)
+        [[nodiscard]] bool isEmpty() const { return getSize() == 0; } // Checks if the deque is empty (snapshot)
+        [[nodiscard]] size_t capacity() const { return array.load(std::memory_order_relaxed)->size(); } // Current array size
+
+    private:
+        static constexpr size_t cacheLineSize = 64;
+
+        // Circular array of atomic slots (relaxed accesses, the ordering comes from top / bottom)
+        class Array {
+        public:
+            explicit Array(size_t size) : slots(new std::atomic<T>[size]), mask(size - 1) {}
+            [[nodiscard]] size_t size() const { return mask + 1; }
+            T get(int64_t index) const { return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed); }
+            void put(int64_t index, const T& value) { slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed); }
+        private:
+            std::unique_ptr<std::atomic<T>[]> slots;
+            size_t mask;
+        };
+
+        alignas(cacheLineSize) std::atomic<int64_t> top;         // Next element thieves take, only ever increases
+        alignas(cacheLineSize) std::atomic<int64_t> bottom;      // One past the newest element, written by the owner
+        alignas(cacheLineSize) std::atomic<Array*> array;        // Current array
+        std::vector<std::unique_ptr<Array>> arrays;              // Every array so far (owner only), the last one is current
+
+        Array* grow(Array* old, int64_t front, int64_t back);    // Owner only: doubles the array
+    };
+
+    /*
+     * Name: WorkStealingDeque constructor
+     * Description: Initializes an empty deque.
+     * Parameters: capacity - Initial size of the circular array, rounded up to a power of two (default is 256). It grows as needed.
+     * Returns: void - No return value.
+     */
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : top(0), bottom(0), array(nullptr) {
+        if (capacity == 0) {
+            throw std::invalid_argument("WorkStealingDeque capacity must be greater than zero");
+        }
+        arrays.push_back(std::make_unique<Array>(std::bit_ceil(capacity)));
+        array.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    /*
+     * Name: WorkStealingDeque.push_back
+     * Description: Adds an element at the back. No atomic read-modify-write: the element is stored, then published by
+     *              a release store of bottom. Grows the array if it is full.
+     * Parameters: value - The element to add.
+     * Returns: void - No return value.
+     */
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void WorkStealingDeque<T>::push_back(const T& value) {
+        const int64_t back = bottom.load(std::memory_order_relaxed);
+        const int64_t front = top.load(std::memory_order_acquire);
+        Array* current = array.load(std::memory_order_relaxed);
+        if (back - front > static_cast<int64_t>(current->size()) - 1) {
+            current = grow(current, front, back);
+        }
+        current->put(back, value);
+        bottom.store(back + 1, std::memory_order_release); // Publishes the element (and whatever it points to) to thieves
+    }
+
+    /*
+     * Name: WorkStealingDeque.pop_back
+     * Description: Removes the newest element. bottom is lowered first and a full fence orders that against the read
+     *              of top, so a thief and the owner can only collide on the last element, which is settled with a CAS on top.
+     * Parameters: out - Receives the removed element.
+     * Returns: bool - True if an element was removed, false if the deque was empty (or a thief took the last element).
+     */
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool WorkStealingDeque<T>::pop_back(T& out) {
+        const int64_t back = bottom.load(std::memory_order_relaxed) - 1;
+        Array* current = array.load(std::memory_order_relaxed);
+        bottom.store(back, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t front = top.load(std::memory_order_relaxed);
+        if (front > back) {
+            bottom.store(back + 1, std::memory_order_relaxed); // Was empty, undo
+            return false;
+        }
+        out = current->get(back);
+        if (front < back) {
+            return true; // More than one element, no thief can reach this one
+        }
+        // Last element: race the thieves for it
+        const bool won = top.compare_exchange_strong(front, front + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(back + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    /*
+     * Name: WorkStealingDeque.steal
+     * Description: Removes the oldest element. The element is read before the CAS on top claims it; if the CAS fails,
+     *              another thief or the owner got it first and the value read is discarded.
+     * Parameters: out - Receives the removed element.
+     * Returns: bool - True if an element was stolen, false if the deque was empty or another thread won the race.
+     */
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool WorkStealingDeque<T>::steal(T& out) {
+        int64_t front = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t back = bottom.load(std::memory_order_acquire);
+        if (front >= back) {
+            return false;
+        }
+        const T value = array.load(std::memory_order_acquire)->get(front);
+        if (!top.compare_exchange_strong(front, front + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        out = value;
+        return true;
+    }
+
+    /*
+     * Name: WorkStealingDeque.getSize
+     * Description: Returns the number of elements. Only a snapshot while other threads are working on the deque.
+     * Parameters: None
+     * Returns: size_t - The number of elements.
+     */
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    size_t WorkStealingDeque<T>::getSize() const {
+        const int64_t back = bottom.load(std::memory_order_acquire);
+        const int64_t front = top.load(std::memory_order_acquire);
+        return back > front ? static_cast<size_t>(back - front) : 0;
+    }
+
+    /*
+     * Name: WorkStealingDeque.grow
+     * Description: Copies the live elements into an array twice the size and publishes it. The old array stays alive
+     *              (thieves may still be reading from it) until the deque is destroyed.
+     * Parameters: old - The current array.
+     *             front - top as read by push_back.
+     *             back - bottom.
+     * Returns: Array* - The new array.
+     */
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::grow(Array* old, int64_t front, int64_t back) {
+        auto bigger = std::make_unique<Array>(old->size() * 2);
+        for (int64_t i = front; i < back; i++) {
+            bigger->put(i, old->get(i)); // Same indices, the mask does the rest
+        }
+        Array* current = bigger.get();
+        arrays.push_back(std::move(bigger));
+        array.store(current, std::memory_order_release);
+        return current;
+    }
+
+}
+
+#endif //WORKSTEALINGDEQUE_H
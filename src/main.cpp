@@ -1,3 +1,4 @@
+#include <cstring>
 #include <iostream>
 
 using namespace std;
@@ -9,13 +10,84 @@ extern void runDequeTest();
 extern void runDequeTemplateTest();
 extern void runStackTest();
 extern void runRingBufferTest();
+extern void runRingBufferBulkTest();
+extern void runFixedRingBufferTest();
 extern void runIteratorsTest();
+extern void runSpscRingBufferTest();
+extern void runMpmcQueueTest();
+extern void runSharedRingBufferTest();
+extern void runMirroredRingBufferTest();
+extern void runStatsRingBufferTest();
+extern void runQuantileRingBufferTest();
+extern void runSimdKernelsTest();
+extern void runNodePoolTest();
+extern void runArenaTest();
+extern void runUnrolledListTest();
+extern void runIndexLinkedListTest();
+extern void runIntrusiveListTest();
+extern void runMoveSemanticsTest();
+extern void runLockFreeStackTest();
+extern void runLockFreeQueueTest();
+extern void runWorkStealingTest();
+extern void runBlockDequeTest();
+extern void runSmallStackTest();
+extern void runSlotMapTest();
+extern void runCacheTest();
+extern void runPriorityQueueTest();
+extern void runTimingWheelTest();
 
+struct ExampleEntry {
+    const char* name;
+    void (*run)();
+};
 
+// Pass one or more names on the command line to run only those examples (CTest runs each one separately),
+// no arguments runs everything
+static const ExampleEntry examples[] = {
+    {"linkedlist", runLinkedListExample},
+    {"queue", runQueueIntTest},
+    {"queuetemplate", runQueueTemplateTest},
+    {"doublelinkedlist", runDoubleLinkedListTest},
+    {"deque", runDequeTest},
+    {"dequetemplate", runDequeTemplateTest},
+    {"stack", runStackTest},
+    {"ringbuffer", runRingBufferTest},
+    {"ringbufferbulk", runRingBufferBulkTest},
+    {"fixedringbuffer", runFixedRingBufferTest},
+    {"iterators", runIteratorsTest},
+    {"spsc", runSpscRingBufferTest},
+    {"mpmc", runMpmcQueueTest},
+    {"sharedringbuffer", runSharedRingBufferTest},
+    {"mirroredringbuffer", runMirroredRingBufferTest},
+    {"stats", runStatsRingBufferTest},
+    {"quantile", runQuantileRingBufferTest},
+    {"simd", runSimdKernelsTest},
+    {"nodepool", runNodePoolTest},
+    {"arena", runArenaTest},
+    {"unrolled", runUnrolledListTest},
+    {"indexlist", runIndexLinkedListTest},
+    {"intrusive", runIntrusiveListTest},
+    {"moves", runMoveSemanticsTest},
+    {"lockfreestack", runLockFreeStackTest},
+    {"lockfreequeue", runLockFreeQueueTest},
+    {"workstealing", runWorkStealingTest},
+    {"blockdeque", runBlockDequeTest},
+    {"smallstack", runSmallStackTest},
+    {"slotmap", runSlotMapTest},
+    {"cache", runCacheTest},
+    {"priorityqueue", runPriorityQueueTest},
+    {"timingwheel", runTimingWheelTest},
+};
 
-int main() {
-
-    runIteratorsTest();
-
+int main(int argc, char** argv) {
+    for (const auto& example : examples) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc && !selected; i++) {
+            selected = strcmp(argv[i], example.name) == 0;
+        }
+        if (selected) {
+            example.run();
+        }
+    }
     return 0;
 }
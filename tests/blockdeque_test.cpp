@@ -0,0 +1,85 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include "blockdeque.h"
+#include "check.h"
+using namespace CommandaStructures;
+
+/* Random pushes and pops at both ends of a BlockDeque are mirrored on a std::deque, and every indexed read is compared
+ * against it. The chunk sizes cover one element per chunk (every push links or unlinks a chunk), the default, and a
+ * large chunk. std::string elements make a missed destructor or a double destroy show up as a leak or a heap error.
+ */
+
+namespace {
+    template<size_t ChunkBytes>
+    void modelRun() {
+        std::mt19937 random(1);
+        std::deque<std::string> model;
+        BlockDeque<std::string, ChunkBytes> deque;
+        for (int i = 0; i < 200000; i++) {
+            const int operation = static_cast<int>(random() % 7);
+            if (operation <= 1) {
+                deque.push_back(std::to_string(i));
+                model.push_back(std::to_string(i));
+            } else if (operation <= 3) {
+                deque.emplace_front(std::to_string(i));
+                model.push_front(std::to_string(i));
+            } else if (operation == 4 && !model.empty()) {
+                CHECK(deque.pop_front() == model.front());
+                model.pop_front();
+            } else if (operation == 5 && !model.empty()) {
+                CHECK(deque.pop_back() == model.back());
+                model.pop_back();
+            } else if (operation == 6 && !model.empty()) {
+                const size_t index = random() % model.size();
+                CHECK(deque[index] == model[index]);
+                CHECK(deque.at(index) == model[index]);
+            }
+            CHECK(static_cast<size_t>(deque.getSize()) == model.size());
+
+            if (i % 5000 == 0) {
+                CHECK(std::equal(deque.begin(), deque.end(), model.begin(), model.end()));
+                CHECK(std::equal(deque.rbegin(), deque.rend(), model.rbegin(), model.rend()));
+                size_t seen = 0;
+                for (size_t k = 0; k < deque.chunkCount(); k++) {
+                    auto chunk = deque.chunk(k);
+                    CHECK(!chunk.empty());
+                    for (const auto& value : chunk) CHECK(value == model[seen++]);
+                }
+                CHECK(seen == model.size());
+
+                auto copy = deque;
+                CHECK(std::equal(copy.begin(), copy.end(), model.begin(), model.end()));
+                auto moved = std::move(copy);
+                CHECK(moved.getSize() == deque.getSize());
+                copy = moved;
+                copy.clear();
+                copy.push_back("reused after clear");
+                CHECK(copy.getSize() == 1);
+            }
+        }
+        CHECK_THROWS(deque.at(model.size()), std::out_of_range);
+
+        deque.clear();
+        CHECK(deque.isEmpty());
+        CHECK(deque.chunkCount() == 0);
+        CHECK_THROWS(deque.pop_back(), std::out_of_range);
+        CHECK_THROWS(deque.pop_front(), std::out_of_range);
+        std::sort(deque.begin(), deque.end()); // Random-access iterators on an empty deque
+    }
+}
+
+int main() {
+    modelRun<1>();
+    modelRun<512>();
+    modelRun<4096>();
+
+    std::cout << "blockdeque: OK" << std::endl;
+    return 0;
+}
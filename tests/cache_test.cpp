@@ -0,0 +1,154 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cache.h"
+#include "check.h"
+using namespace CommandaStructures;
+
+/* A brute-force model keeps every cache entry with its use count and last-use tick and picks the victim by scanning, so
+ * each eviction has to match the callback exactly, for both policies and for capacities from 1 up. Moved-from caches
+ * must stay usable, and the sharded cache is hammered from several threads.
+ */
+
+namespace {
+    struct ModelEntry {
+        int key;
+        int value;
+        unsigned uses;
+        unsigned long lastUse;
+    };
+
+    template<EvictionPolicy Policy>
+    void modelRun(size_t capacity, int keys, int operations, unsigned seed) {
+        constexpr bool leastFrequent = Policy == EvictionPolicy::LeastFrequentlyUsed;
+        Cache<int, int, Policy> cache(capacity);
+        std::vector<ModelEntry> model;
+        unsigned long clock = 0;
+        std::mt19937 random(seed);
+        std::vector<int> evicted;
+        cache.setEvictionCallback([&](const int& key, int&) { evicted.push_back(key); });
+
+        for (int i = 0; i < operations; i++) {
+            const int key = static_cast<int>(random() % keys);
+            const int operation = static_cast<int>(random() % 10);
+            auto entry = std::find_if(model.begin(), model.end(), [&](const ModelEntry& e) { return e.key == key; });
+            if (operation < 5) {
+                int* value = cache.get(key);
+                CHECK((value != nullptr) == (entry != model.end()));
+                if (value) {
+                    CHECK(*value == entry->value);
+                    entry->uses++;
+                    entry->lastUse = ++clock;
+                }
+            } else if (operation < 9) {
+                const int value = static_cast<int>(random());
+                evicted.clear();
+                if (entry != model.end()) {
+                    entry->value = value;
+                    entry->uses++;
+                    entry->lastUse = ++clock;
+                    cache.put(key, value);
+                    CHECK(evicted.empty());
+                } else {
+                    int victim = -1;
+                    if (model.size() == capacity) {
+                        auto oldest = std::min_element(model.begin(), model.end(), [](const ModelEntry& a, const ModelEntry& b) {
+                            if (leastFrequent && a.uses != b.uses) return a.uses < b.uses;
+                            return a.lastUse < b.lastUse; // LRU, and the tie-break between equal counts
+                        });
+                        victim = oldest->key;
+                        model.erase(oldest);
+                    }
+                    cache.put(key, value);
+                    model.push_back({key, value, 1, ++clock});
+                    CHECK(evicted.size() == (victim < 0 ? 0u : 1u));
+                    if (victim >= 0) CHECK(evicted[0] == victim);
+                }
+            } else {
+                CHECK(cache.erase(key) == (entry != model.end()));
+                if (entry != model.end()) model.erase(entry);
+            }
+
+            CHECK(cache.getSize() == model.size());
+            for (const auto& e : model) CHECK(cache.peek(e.key) && *cache.peek(e.key) == e.value);
+        }
+        cache.clear();
+        CHECK(cache.isEmpty());
+        cache.put(1, 1);
+        CHECK(*cache.get(1) == 1);
+    }
+
+    template<EvictionPolicy Policy>
+    void moves() {
+        Cache<int, std::string, Policy> first(4);
+        for (int i = 0; i < 6; i++) first.put(i, std::to_string(i));
+        Cache<int, std::string, Policy> second(std::move(first));
+        CHECK(second.getSize() == 4);
+        CHECK(second.get(5) && *second.get(5) == "5");
+
+        CHECK(first.getSize() == 0); // Moved-from: empty but still usable
+        CHECK(!first.get(5));
+        CHECK(!first.contains(1));
+        CHECK(!first.erase(5));
+        for (int i = 0; i < 10; i++) first.put(i, "x" + std::to_string(i));
+        CHECK(first.getSize() == 4);
+        CHECK(first.get(9));
+
+        first = std::move(second);
+        CHECK(first.getSize() == 4);
+        CHECK(*first.get(5) == "5");
+        CHECK(second.getSize() == 0);
+        second.put(1, "one");
+        CHECK(*second.get(1) == "one");
+
+        std::vector<Cache<int, int, Policy>> caches; // Relocated when the vector grows
+        caches.emplace_back(2);
+        caches.emplace_back(3);
+        caches[0].put(1, 1);
+        caches.emplace_back(4);
+        CHECK(*caches[0].get(1) == 1);
+    }
+
+    void sharded() {
+        ShardedCache<int, int> cache(1000, 8);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < 20000; i++) {
+                    const int key = (i * 7 + t) % 1500;
+                    int value = 0;
+                    if (!cache.get(key, value)) cache.put(key, key);
+                    else CHECK(value == key);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        CHECK(cache.getSize() <= cache.capacity());
+        CHECK(cache.getHits() + cache.getMisses() == 4 * 20000);
+        CHECK(cache.getEvictions() > 0);
+    }
+}
+
+int main() {
+    for (unsigned seed = 0; seed < 20; seed++) {
+        modelRun<EvictionPolicy::LeastRecentlyUsed>(1 + seed % 7, 12, 3000, seed);
+        modelRun<EvictionPolicy::LeastFrequentlyUsed>(1 + seed % 7, 12, 3000, seed);
+    }
+    modelRun<EvictionPolicy::LeastRecentlyUsed>(64, 200, 20000, 99);
+    modelRun<EvictionPolicy::LeastFrequentlyUsed>(64, 200, 20000, 99);
+
+    moves<EvictionPolicy::LeastRecentlyUsed>();
+    moves<EvictionPolicy::LeastFrequentlyUsed>();
+    sharded();
+    CHECK_THROWS((Cache<int, int>(0)), std::invalid_argument);
+
+    std::cout << "cache: OK" << std::endl;
+    return 0;
+}
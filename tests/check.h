@@ -0,0 +1,39 @@
+//
+// Created by Levi on 2026-10-17.
+//
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <cstdlib>
+#include <iostream>
+/* Notes:
+ * Minimal checking for the test executables in tests/, each one is a plain main() registered with CTest.
+ * CHECK stays active in release builds (unlike assert), prints the failed condition with its location and aborts,
+ * so CTest reports the test as failed and a sanitizer build still gets its report for whatever ran before.
+ * CHECK_THROWS checks that an expression throws the given exception type.
+ */
+
+#define CHECK(condition)                                                                              \
+    do {                                                                                              \
+        if (!(condition)) {                                                                           \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            std::abort();                                                                             \
+        }                                                                                             \
+    } while (false)
+
+#define CHECK_THROWS(expression, Exception)                                                                \
+    do {                                                                                                   \
+        bool thrown = false;                                                                               \
+        try {                                                                                              \
+            (void)(expression);                                                                            \
+        } catch (const Exception&) {                                                                       \
+            thrown = true;                                                                                 \
+        }                                                                                                  \
+        if (!thrown) {                                                                                     \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #expression " did not throw " #Exception << std::endl; \
+            std::abort();                                                                                  \
+        }                                                                                                  \
+    } while (false)
+
+#endif //CHECK_H
@@ -0,0 +1,73 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "check.h"
+#include "indexlinkedlist.h"
+using namespace CommandaStructures;
+
+/* removeNode releases a value's resources when the node is removed, not when its slot is reused. Resource has no default
+ * constructor and its move can be told to throw: a failed removal must leave the list exactly as it was, and a
+ * successful one must release the value at once.
+ */
+
+namespace {
+    int liveCount = 0;
+    bool failMoves = false;
+
+    struct Resource {
+        std::string name; // Empty once moved from
+        explicit Resource(std::string name) : name(std::move(name)) { liveCount += !this->name.empty(); }
+        Resource(const Resource& other) : name(other.name) { liveCount += !name.empty(); }
+        Resource(Resource&& other) : name() {
+            if (failMoves) throw std::runtime_error("move failed");
+            name.swap(other.name);
+        }
+        Resource& operator=(const Resource& other) {
+            liveCount += !other.name.empty() - !name.empty();
+            name = other.name;
+            return *this;
+        }
+        ~Resource() { liveCount -= !name.empty(); }
+        bool operator==(const Resource& other) const { return name == other.name; }
+    };
+}
+
+int main() {
+    IndexLinkedList<Resource> list;
+    list.reserve(8); // No reallocation, so no moves other than removeNode's
+    IndexLinkedList<Resource>::Handle handles[4];
+    for (int i = 0; i < 4; i++) handles[i] = list.insert(Resource("resource " + std::to_string(i)));
+    CHECK(liveCount == 4);
+
+    failMoves = true;
+    CHECK_THROWS(list.removeNode(handles[1]), std::runtime_error);
+    failMoves = false;
+    CHECK(list.getSize() == 4);
+    CHECK(list.get(handles[1]).name == "resource 1");
+    CHECK(list.next(handles[0]) == handles[1] && list.prev(handles[2]) == handles[1]);
+    CHECK(liveCount == 4);
+
+    list.removeNode(handles[1]);
+    CHECK(liveCount == 3); // Released now, the slot is still free
+    CHECK(list.getSize() == 3);
+    CHECK(list.next(handles[0]) == handles[2]);
+    CHECK_THROWS(list.get(handles[1]), std::invalid_argument);
+
+    const auto reused = list.insert(Resource("resource 4"));
+    CHECK(reused == handles[1]);
+    CHECK(liveCount == 4);
+    int position = 0;
+    const char* expected[] = {"resource 0", "resource 2", "resource 3", "resource 4"};
+    for (const Resource& resource : list) CHECK(resource.name == expected[position++]);
+    CHECK(position == 4);
+
+    list.remove(Resource("resource 0"));
+    list.clear();
+    CHECK(liveCount == 0);
+
+    std::cout << "indexlinkedlist: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,91 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "check.h"
+#include "lockfreequeue.h"
+using namespace CommandaStructures;
+
+/* 4 producers and 4 consumers move std::string elements through a LockFreeQueue, so a node that is reused while another
+ * thread still reads it shows up as a heap race or a corrupted string, not just a wrong number. Every round checks
+ * exactly-once delivery and per-producer FIFO order, then destroys the queue while retired nodes may still be waiting in
+ * the hazard domain.
+ */
+
+namespace {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int itemsPerProducer = 20000;
+    constexpr int producerStride = 1000000; // Element value = producer * producerStride + sequence number
+
+    void stressRound(size_t nodesPerSlab) {
+        auto* queue = new LockFreeQueue<std::string>(nodesPerSlab); // Small slabs so the pool grows under contention
+        std::atomic<int> consumed{0};
+        std::atomic<long long> checksum{0};
+        std::vector<std::vector<int>> lastSeen(consumers, std::vector<int>(producers, -1));
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < itemsPerProducer; i++) {
+                    if (i & 1) queue->push(std::to_string(p * producerStride + i));
+                    else queue->emplace(std::to_string(p * producerStride + i));
+                }
+            });
+        }
+        for (int c = 0; c < consumers; c++) {
+            threads.emplace_back([&, c] {
+                std::string value;
+                while (consumed.load(std::memory_order_relaxed) < producers * itemsPerProducer) {
+                    if (!queue->try_pop(value)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    const int number = std::stoi(value);
+                    const int producer = number / producerStride;
+                    const int sequence = number % producerStride;
+                    CHECK(producer >= 0 && producer < producers);
+                    CHECK(sequence > lastSeen[c][producer]); // One consumer sees each producer's items in push order
+                    lastSeen[c][producer] = sequence;
+                    checksum.fetch_add(number, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        long long expected = 0;
+        for (int p = 0; p < producers; p++) {
+            for (int i = 0; i < itemsPerProducer; i++) expected += static_cast<long long>(p) * producerStride + i;
+        }
+        CHECK(consumed.load() == producers * itemsPerProducer);
+        CHECK(checksum.load() == expected);
+        CHECK(queue->isEmpty());
+
+        queue->push("left");
+        queue->push("over");
+        CHECK(queue->pop() == "left");
+        delete queue; // One element still queued, nodes may still be retired
+    }
+}
+
+int main() {
+    for (size_t nodesPerSlab : {4, 64, 256}) {
+        stressRound(nodesPerSlab);
+    }
+
+    LockFreeQueue<int> empty;
+    CHECK_THROWS(empty.pop(), std::out_of_range);
+    int out = 0;
+    CHECK(!empty.try_pop(out));
+    empty.reserve(1000);
+    empty.push(1);
+    CHECK(empty.pop() == 1);
+
+    std::cout << "lockfreequeue: OK" << std::endl;
+    return 0;
+}
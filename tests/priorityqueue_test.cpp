@@ -0,0 +1,149 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "check.h"
+#include "priorityqueue.h"
+using namespace CommandaStructures;
+
+/* Random pushes, pops, decrease_key, update and erase through PriorityQueue handles are mirrored on a std::map of live
+ * handles, and the minimum is found by scanning the map. Every arity is covered since the sift code depends on it.
+ * Erased and popped handles must stay dead, and assign() must invalidate every handle from before, unless copying the
+ * range throws, in which case the queue must be left as it was.
+ */
+
+namespace {
+    template<size_t Arity>
+    void modelRun(unsigned seed) {
+        PriorityQueue<int, Arity> queue;
+        std::map<uint64_t, std::pair<SlotHandle, int>> live; // Packed handle -> handle and current priority
+        std::vector<SlotHandle> dead;
+        std::mt19937 random(seed);
+        for (int i = 0; i < 20000; i++) {
+            const int operation = static_cast<int>(random() % 10);
+            if (operation < 4 || live.empty()) {
+                const int value = static_cast<int>(random() % 1000);
+                const SlotHandle handle = queue.push(value);
+                CHECK(live.count(handle.value()) == 0);
+                live[handle.value()] = {handle, value};
+            } else if (operation < 6) {
+                int minimum = live.begin()->second.second;
+                for (const auto& [key, entry] : live) minimum = std::min(minimum, entry.second);
+                CHECK(queue.top() == minimum);
+                const SlotHandle handle = queue.topHandle();
+                CHECK(live[handle.value()].second == minimum);
+                CHECK(queue.pop() == minimum);
+                live.erase(handle.value());
+                dead.push_back(handle);
+            } else {
+                auto picked = live.begin();
+                std::advance(picked, random() % live.size());
+                const SlotHandle handle = picked->second.first;
+                int& priority = picked->second.second;
+                CHECK(queue.get(handle) == priority);
+                if (operation == 6) {
+                    priority -= static_cast<int>(random() % 50);
+                    queue.decrease_key(handle, priority);
+                } else if (operation == 7) {
+                    priority = static_cast<int>(random() % 1000);
+                    queue.update(handle, priority);
+                } else if (operation == 8) {
+                    CHECK_THROWS(queue.decrease_key(handle, priority + 1), std::invalid_argument);
+                } else {
+                    queue.erase(handle);
+                    dead.push_back(handle);
+                    live.erase(picked);
+                }
+            }
+            CHECK(static_cast<size_t>(queue.getSize()) == live.size());
+            if (!dead.empty()) {
+                const SlotHandle handle = dead[random() % dead.size()];
+                CHECK(!queue.contains(handle));
+                CHECK_THROWS(queue.get(handle), std::out_of_range);
+            }
+        }
+
+        std::vector<int> values;
+        for (int i = 0; i < 1000; i++) values.push_back(static_cast<int>(random() % 500));
+        const auto handles = queue.assign(values.begin(), values.end());
+        for (size_t i = 0; i < values.size(); i++) CHECK(queue.get(handles[i]) == values[i]);
+        for (const auto& [key, entry] : live) CHECK(!queue.contains(entry.first));
+        std::sort(values.begin(), values.end());
+        for (int value : values) CHECK(queue.pop() == value);
+        CHECK_THROWS(queue.pop(), std::out_of_range);
+
+        PriorityQueue<int, Arity, std::greater<int>> maxQueue(values.begin(), values.end());
+        CHECK(maxQueue.top() == values.back());
+    }
+
+    int copiesUntilThrow = -1; // Negative: never throw
+
+    struct Fragile {
+        int value;
+        explicit Fragile(int value) : value(value) {}
+        Fragile(const Fragile& other) : value(other.value) {
+            if (copiesUntilThrow == 0) throw std::runtime_error("copy failed");
+            if (copiesUntilThrow > 0) copiesUntilThrow--;
+        }
+        Fragile(Fragile&&) noexcept = default;
+        Fragile& operator=(const Fragile&) = default;
+        Fragile& operator=(Fragile&&) noexcept = default;
+        bool operator<(const Fragile& other) const { return value < other.value; }
+    };
+
+    void throwingAssign() {
+        PriorityQueue<Fragile> queue;
+        std::vector<SlotHandle> handles;
+        for (int i = 0; i < 10; i++) handles.push_back(queue.emplace(10 - i));
+        const std::vector<Fragile> values(20, Fragile(5));
+        copiesUntilThrow = 7;
+        CHECK_THROWS(queue.assign(values.begin(), values.end()), std::runtime_error);
+        copiesUntilThrow = -1;
+        CHECK(queue.getSize() == 10); // Untouched: same elements, same handles, still in heap order
+        for (int i = 0; i < 10; i++) CHECK(queue.get(handles[i]).value == 10 - i);
+        for (int i = 1; i <= 10; i++) CHECK(queue.pop().value == i);
+
+        const auto fresh = queue.assign(values.begin(), values.end());
+        CHECK(queue.getSize() == 20);
+        for (const SlotHandle handle : handles) CHECK(!queue.contains(handle));
+        for (const SlotHandle handle : fresh) CHECK(queue.contains(handle));
+    }
+}
+
+int main() {
+    for (unsigned seed = 0; seed < 5; seed++) {
+        modelRun<2>(seed);
+        modelRun<3>(seed);
+        modelRun<4>(seed);
+        modelRun<8>(seed);
+    }
+
+    using Pointer = std::unique_ptr<int>;
+    PriorityQueue<Pointer, 4, bool (*)(const Pointer&, const Pointer&)> pointers(
+        [](const Pointer& a, const Pointer& b) { return *a < *b; });
+    pointers.push(std::make_unique<int>(3));
+    pointers.emplace(new int(1));
+    CHECK(*pointers.pop() == 1); // Move-only elements
+    CHECK(*pointers.pop() == 3);
+
+    throwingAssign();
+
+    PriorityQueue<std::string> strings;
+    strings.push("b");
+    strings.push("a");
+    CHECK(strings.pop() == "a");
+
+    std::cout << "priorityqueue: OK" << std::endl;
+    return 0;
+}
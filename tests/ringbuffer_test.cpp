@@ -0,0 +1,94 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "check.h"
+#include "ringbuffer.h"
+using namespace CommandaStructures;
+
+/* push_bulk copies whole blocks of elements into the runtime-capacity RingBuffer, so a copy that throws halfway and a
+ * source span that points back into the buffer are the cases to get right. Tracked counts every live element and can
+ * be told to throw on the n-th copy: after a throw, the only live elements are the ones the buffer reports.
+ */
+
+namespace {
+    int liveCount = 0;
+    int copiesUntilThrow = -1; // Negative: never throw
+
+    struct Tracked {
+        std::string value; // Heap-backed, so a destroyed element read again shows up under ASan
+        explicit Tracked(std::string value) : value(std::move(value)) { liveCount++; }
+        Tracked(const Tracked& other) : value(other.value) {
+            if (copiesUntilThrow == 0) throw std::runtime_error("copy failed");
+            if (copiesUntilThrow > 0) copiesUntilThrow--;
+            liveCount++;
+        }
+        Tracked(Tracked&& other) noexcept : value(std::move(other.value)) { liveCount++; }
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&&) noexcept = default;
+        ~Tracked() { liveCount--; }
+    };
+
+    std::string name(int i) {
+        return "tracked ring buffer value " + std::to_string(i); // Longer than the small-string buffer
+    }
+
+    std::vector<Tracked> makeValues(int first, int n) {
+        std::vector<Tracked> values;
+        for (int i = 0; i < n; i++) values.emplace_back(name(first + i));
+        return values;
+    }
+
+    void throwingBulkPush(bool overwrite) {
+        const int pushed = overwrite ? 7 : 5; // Overwrite mode has to drop 2 elements first
+        for (int failAt = 0; failAt <= pushed; failAt++) {
+            RingBuffer<Tracked> buffer(8, overwrite);
+            buffer.push_bulk(makeValues(0, 6));
+            for (int i = 0; i < 3; i++) buffer.pop(); // tail is now in the middle, so the push wraps around
+            const auto values = makeValues(100, pushed);
+            copiesUntilThrow = failAt;
+            bool threw = false;
+            try {
+                buffer.push_bulk(values);
+            } catch (const std::runtime_error&) {
+                threw = true;
+            }
+            copiesUntilThrow = -1;
+            CHECK(threw == (failAt < pushed));
+            if (threw) {
+                CHECK(buffer.getSize() == (overwrite ? 1 : 3)); // Dropped elements stay dropped
+                CHECK(buffer.front().value == name(overwrite ? 5 : 3));
+            } else {
+                CHECK(buffer.getSize() == 8);
+                CHECK(buffer.back().value == name(100 + pushed - 1));
+            }
+            CHECK(liveCount == buffer.getSize() + pushed); // Nothing half-added is left alive
+        }
+    }
+
+    void aliasedBulkPush() {
+        RingBuffer<Tracked> buffer(6, true);
+        buffer.push_bulk(makeValues(0, 6)); // Full
+        auto [first, second] = buffer.peek_contiguous();
+        CHECK(first.size() == 6 && second.empty());
+        CHECK(buffer.push_bulk(std::span<const Tracked>(first.first(4))) == 4); // The drop destroys what is being pushed
+        const int expected[] = {4, 5, 0, 1, 2, 3};
+        int position = 0;
+        for (const Tracked& element : buffer) CHECK(element.value == name(expected[position++]));
+        CHECK(position == 6);
+    }
+}
+
+int main() {
+    throwingBulkPush(false);
+    throwingBulkPush(true);
+    aliasedBulkPush();
+    CHECK(liveCount == 0);
+
+    std::cout << "ringbuffer: OK" << std::endl;
+    return 0;
+}
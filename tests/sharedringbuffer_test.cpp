@@ -0,0 +1,136 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "check.h"
+#include "sharedringbuffer.h"
+using namespace CommandaStructures;
+
+/* The producer and consumer run as two threads on one mapping, which is what ThreadSanitizer can follow (it does not see
+ * a second process). Overwrite mode is lapped continuously while the consumer reads, and torn or out-of-order samples
+ * fail the test. The attach checks corrupt the header of a real shared-memory object and expect the attach to refuse it.
+ */
+
+namespace {
+    struct Sample {
+        uint64_t sequence;
+        uint64_t copies[3]; // Each one sequence * (i + 2), so a mix of two writes does not add up
+    };
+
+    Sample makeSample(uint64_t sequence) {
+        return {sequence, {sequence * 2, sequence * 3, sequence * 4}};
+    }
+
+    bool isIntact(const Sample& sample) {
+        return sample.copies[0] == sample.sequence * 2 && sample.copies[1] == sample.sequence * 3 &&
+               sample.copies[2] == sample.sequence * 4;
+    }
+
+    struct RawHeader { // Mirror of the start of SharedRingBuffer's header, layout version 2
+        uint64_t magic;
+        uint32_t version;
+        uint32_t elementSize;
+        uint64_t capacity;
+        uint64_t slotsOffset;
+        uint32_t overwrite;
+    };
+
+    void overwriteMode(const std::string& name, size_t capacity) {
+        constexpr uint64_t items = 1000000;
+        SharedRingBuffer<Sample> buffer(name, capacity, true);
+        CHECK_THROWS(buffer.peek_contiguous(), std::logic_error);
+        CHECK_THROWS(buffer.consume(0), std::logic_error);
+        std::atomic<bool> done{false};
+        std::thread producer([&] {
+            for (uint64_t i = 1; i <= items; i++) CHECK(buffer.try_push(makeSample(i)));
+            done = true;
+        });
+        uint64_t last = 0;
+        Sample sample{};
+        while (!done.load() || !buffer.isEmpty()) {
+            if (!buffer.try_pop(sample)) continue;
+            CHECK(isIntact(sample));
+            CHECK(sample.sequence > last);
+            last = sample.sequence;
+        }
+        producer.join();
+        CHECK(last == items);
+    }
+
+    void normalMode(const std::string& name) {
+        constexpr uint64_t items = 200000;
+        SharedRingBuffer<Sample> buffer(name, 64);
+        std::thread producer([&] {
+            for (uint64_t i = 1; i <= items; i++) {
+                while (!buffer.try_push(makeSample(i))) std::this_thread::yield();
+            }
+        });
+        uint64_t expected = 1;
+        Sample sample{};
+        while (expected <= items) {
+            if (expected % 2 == 0) {
+                size_t batch = 0;
+                for (const auto& segment : buffer.peek_contiguous()) {
+                    for (const Sample& peeked : segment) CHECK(peeked.sequence == expected + batch++);
+                }
+                buffer.consume(batch);
+                expected += batch;
+            } else if (buffer.try_pop(sample)) {
+                CHECK(sample.sequence == expected++);
+            }
+        }
+        producer.join();
+        CHECK(buffer.isEmpty());
+        CHECK_THROWS(buffer.consume(1), std::out_of_range);
+    }
+
+    void corruptHeader(const std::string& name, void (*corrupt)(RawHeader&)) {
+        SharedRingBuffer<Sample> creator(name, 16);
+        const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+        CHECK(fd >= 0);
+        void* mapping = mmap(nullptr, sizeof(RawHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        CHECK(mapping != MAP_FAILED);
+        corrupt(*static_cast<RawHeader*>(mapping));
+        munmap(mapping, sizeof(RawHeader));
+        close(fd);
+        CHECK_THROWS(SharedRingBuffer<Sample>{name}, std::runtime_error);
+    }
+}
+
+int main() {
+    const std::string name = "/commanda_sharedringbuffer_test_" + std::to_string(getpid());
+    normalMode(name);
+    for (size_t capacity : {1, 4, 64}) {
+        overwriteMode(name, capacity);
+    }
+
+    {
+        SharedRingBuffer<Sample> creator(name, 16, true);
+        SharedRingBuffer<Sample> attached(name);
+        CHECK(attached.capacity() == 16);
+        CHECK(attached.isOverwriteOnly());
+        creator.try_push(makeSample(7));
+        Sample sample{};
+        CHECK(attached.try_pop(sample));
+        CHECK(sample.sequence == 7);
+    }
+
+    corruptHeader(name, [](RawHeader& header) { header.capacity = 0; });
+    corruptHeader(name, [](RawHeader& header) { header.capacity = 12; });                // Not a power of two
+    corruptHeader(name, [](RawHeader& header) { header.capacity = 1ULL << 62; });         // capacity * slot size wraps
+    corruptHeader(name, [](RawHeader& header) { header.capacity = 32; });                 // Larger than the mapping
+    corruptHeader(name, [](RawHeader& header) { header.slotsOffset = ~0ULL - 63; });       // Past the end of the mapping
+    corruptHeader(name, [](RawHeader& header) { header.elementSize = 8; });
+    corruptHeader(name, [](RawHeader& header) { header.overwrite = 5; });
+
+    std::cout << "sharedringbuffer: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,75 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "check.h"
+#include "slotmap.h"
+using namespace CommandaStructures;
+
+/* Random SlotMap inserts and erases are mirrored on a std::map keyed by the packed handle. Every handle that was erased
+ * is kept and must stay dead even after its slot is reused by a later insert. Every so often the whole model is
+ * compared against the map, and the dense array is checked against handleAt().
+ */
+
+namespace {
+    SlotHandle unpack(uint64_t value) {
+        return SlotHandle(static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32));
+    }
+}
+
+int main() {
+    std::mt19937 random(3);
+    SlotMap<std::string> map;
+    std::map<uint64_t, std::string> model;
+    std::vector<SlotHandle> live;
+    std::vector<SlotHandle> dead;
+    for (int i = 0; i < 200000; i++) {
+        const int operation = static_cast<int>(random() % 4);
+        if (operation < 2) {
+            const SlotHandle handle = map.insert(std::to_string(i));
+            CHECK(model.count(handle.value()) == 0); // A reused slot gets a new generation
+            model[handle.value()] = std::to_string(i);
+            live.push_back(handle);
+        } else if (operation == 2 && !live.empty()) {
+            const size_t pick = random() % live.size();
+            const SlotHandle handle = live[pick];
+            live[pick] = live.back();
+            live.pop_back();
+            CHECK(map.erase(handle));
+            CHECK(!map.erase(handle));
+            model.erase(handle.value());
+            dead.push_back(handle);
+        } else if (!dead.empty()) {
+            const SlotHandle handle = dead[random() % dead.size()];
+            CHECK(!map.contains(handle));
+            CHECK(map.find(handle) == nullptr);
+            CHECK_THROWS(map.at(handle), std::out_of_range);
+        }
+
+        if (i % 1000 == 0) {
+            CHECK(static_cast<size_t>(map.getSize()) == model.size());
+            for (const auto& [key, value] : model) CHECK(map.at(unpack(key)) == value);
+            for (size_t position = 0; position < static_cast<size_t>(map.getSize()); position++) {
+                CHECK(*map.find(map.handleAt(position)) == *(map.begin() + position));
+            }
+        }
+    }
+    CHECK(!map.contains(SlotHandle()));
+
+    const SlotHandle beforeClear = map.insert("cleared");
+    map.clear();
+    CHECK(map.isEmpty());
+    CHECK(!map.contains(beforeClear));
+    for (const auto& handle : live) CHECK(!map.contains(handle));
+    const SlotHandle afterClear = map.insert("kept");
+    CHECK(map.at(afterClear) == "kept");
+
+    std::cout << "slotmap: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,90 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "check.h"
+#include "smallstack.h"
+using namespace CommandaStructures;
+
+/* Random SmallStack pushes and pops are mirrored on a std::vector while the stack moves between inline and heap storage,
+ * including push(top()) across the growth point where the argument lives in the storage being replaced. Copies and
+ * moves are taken in both storage modes. A throwing constructor must leave the stack unchanged.
+ */
+
+namespace {
+    struct Thrower {
+        int value;
+        explicit Thrower(int value) : value(value) {
+            if (value == 5) throw std::runtime_error("constructor failed");
+        }
+    };
+
+    void modelRun() {
+        std::mt19937 random(2);
+        SmallStack<std::string, 4> stack;
+        std::vector<std::string> model;
+        for (int i = 0; i < 100000; i++) {
+            const int operation = static_cast<int>(random() % 5);
+            if (operation < 2) {
+                stack.push(std::to_string(i));
+                model.push_back(std::to_string(i));
+            } else if (operation == 2 && !model.empty()) {
+                stack.push(stack.top());
+                model.push_back(model.back());
+            } else if (operation == 3 && !model.empty()) {
+                CHECK(stack.pop() == model.back());
+                model.pop_back();
+            } else if (operation == 4 && i % 97 == 0) {
+                auto copy = stack;
+                CHECK(copy.getSize() == stack.getSize());
+                auto moved = std::move(copy);
+                copy = moved;
+                moved = std::move(copy);
+                CHECK(std::equal(moved.begin(), moved.end(), model.rbegin(), model.rend())); // Iterates top first
+                stack = moved;
+                if (i % 3 == 0) {
+                    stack.clear();
+                    model.clear();
+                    SmallStack<std::string, 4> empty;
+                    stack = std::move(empty);
+                }
+            }
+            CHECK(static_cast<size_t>(stack.getSize()) == model.size());
+        }
+        CHECK(std::equal(stack.crbegin(), stack.crend(), model.begin(), model.end()));
+    }
+}
+
+int main() {
+    modelRun();
+
+    SmallStack<int, 8> numbers;
+    for (int i = 0; i < 8; i++) numbers.emplace(i);
+    CHECK(numbers.isInline());
+    numbers.push(numbers.top()); // Spills to the heap while reading the inline top
+    CHECK(!numbers.isInline());
+    CHECK(numbers.capacity() == 16);
+    CHECK(numbers.top() == 7);
+    numbers.reserve(100);
+    CHECK(numbers.capacity() == 100);
+    CHECK(numbers.top() == 7);
+
+    SmallStack<Thrower, 2> throwers;
+    throwers.emplace(1);
+    throwers.emplace(2);
+    CHECK_THROWS(throwers.emplace(5), std::runtime_error);
+    CHECK(throwers.getSize() == 2);
+    CHECK(throwers.capacity() == 2);
+    CHECK(throwers.top().value == 2);
+
+    SmallStack<int, 2> empty;
+    CHECK_THROWS(empty.pop(), std::out_of_range);
+
+    std::cout << "smallstack: OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,113 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include "check.h"
+#include "spscringbuffer.h"
+using namespace CommandaStructures;
+
+/* One producer and one consumer thread run against each mode. In normal mode every element has to arrive exactly once
+ * and in order. In overwrite mode the producer laps a small buffer over and over while the consumer is reading; each
+ * element carries its sequence number in every word, so a copy torn between two writes of the same slot shows up as
+ * mismatched words, and the sequence numbers the consumer sees must keep increasing.
+ */
+
+namespace {
+    struct Sample {
+        uint64_t sequence;
+        uint64_t copies[5]; // Each one sequence * (i + 2), so a mix of two writes does not add up
+        uint32_t tail;      // Odd size, the last word is only partly used
+    };
+
+    Sample makeSample(uint64_t sequence) {
+        Sample sample{sequence, {}, static_cast<uint32_t>(sequence)};
+        for (uint64_t i = 0; i < 5; i++) sample.copies[i] = sequence * (i + 2);
+        return sample;
+    }
+
+    bool isIntact(const Sample& sample) {
+        for (uint64_t i = 0; i < 5; i++) {
+            if (sample.copies[i] != sample.sequence * (i + 2)) return false;
+        }
+        return sample.tail == static_cast<uint32_t>(sample.sequence);
+    }
+
+    void normalMode() {
+        constexpr int items = 200000;
+        SpscRingBuffer<std::string> buffer(64);
+        std::thread producer([&] {
+            for (int i = 0; i < items; i++) {
+                std::string value = std::to_string(i);
+                while (!buffer.try_push(std::move(value))) std::this_thread::yield(); // A failed push leaves value intact
+            }
+        });
+        std::string value;
+        for (int expected = 0; expected < items;) {
+            if (!buffer.try_pop(value)) {
+                std::this_thread::yield();
+                continue;
+            }
+            CHECK(value == std::to_string(expected));
+            expected++;
+        }
+        producer.join();
+        CHECK(buffer.isEmpty());
+        CHECK(!buffer.try_pop(value));
+
+        SpscRingBuffer<std::unique_ptr<int>> moveOnly(2);
+        CHECK(moveOnly.try_push(std::make_unique<int>(1)));
+        CHECK(moveOnly.try_push(std::make_unique<int>(2)));
+        auto rejected = std::make_unique<int>(3);
+        CHECK(!moveOnly.try_push(std::move(rejected)));
+        CHECK(rejected && *rejected == 3);
+    }
+
+    void overwriteMode(size_t capacity) {
+        constexpr uint64_t items = 2000000;
+        SpscRingBuffer<Sample, OverflowPolicy::Overwrite> buffer(capacity);
+        std::atomic<bool> done{false};
+        std::thread producer([&] {
+            for (uint64_t i = 1; i <= items; i++) CHECK(buffer.try_push(makeSample(i)));
+            done = true;
+        });
+        uint64_t last = 0;
+        uint64_t received = 0;
+        Sample sample{};
+        while (!done.load() || !buffer.isEmpty()) {
+            if (!buffer.try_pop(sample)) continue;
+            CHECK(isIntact(sample));
+            CHECK(sample.sequence > last);
+            last = sample.sequence;
+            received++;
+        }
+        producer.join();
+        CHECK(received > 0);
+        CHECK(last == items); // The newest element is never overwritten
+        CHECK(buffer.getSize() == 0);
+    }
+}
+
+int main() {
+    normalMode();
+    for (size_t capacity : {1, 4, 64}) {
+        overwriteMode(capacity);
+    }
+
+    SpscRingBuffer<int, OverflowPolicy::Overwrite> latest(4);
+    for (int i = 0; i < 10; i++) latest.try_push(i);
+    CHECK(latest.getSize() == 4);
+    int value = 0;
+    for (int expected = 6; expected < 10; expected++) {
+        CHECK(latest.try_pop(value));
+        CHECK(value == expected);
+    }
+    CHECK(!latest.try_pop(value));
+
+    std::cout << "spscringbuffer: OK" << std::endl;
+    return 0;
+}
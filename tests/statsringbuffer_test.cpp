@@ -0,0 +1,63 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include "check.h"
+#include "statsringbuffer.h"
+using namespace CommandaStructures;
+
+/* The running sum is checked against a sum over the stored samples after every push. Integer windows must match exactly,
+ * also with values large enough that a double would round them. Floating-point windows mix huge and tiny samples, where
+ * plain running addition loses the tiny ones once the huge ones are evicted, and must stay within a few ulps.
+ */
+
+namespace {
+    void integerSum() {
+        StatsRingBuffer<int64_t> window(5);
+        std::mt19937_64 random(1);
+        for (int i = 0; i < 100000; i++) {
+            window.push(static_cast<int64_t>(random() % (1ULL << 50)) + (i % 3)); // Past 2^53 once summed
+            long long expected = 0;
+            for (int64_t sample : window) expected += sample;
+            CHECK(window.sum() == expected);
+            CHECK(window.mean() == static_cast<double>(expected) / window.getSize());
+        }
+
+        StatsRingBuffer<int> small(3);
+        for (int value : {1, 1, 1}) small.push(value);
+        CHECK(small.sum() == 3);
+        CHECK(small.mean() == 1.0);
+        small.clear();
+        CHECK(small.sum() == 0);
+        CHECK(small.mean() == 0.0);
+    }
+
+    void floatingSum() {
+        StatsRingBuffer<double> window(4);
+        for (int i = 0; i < 10000; i++) {
+            window.push(i % 4 == 0 ? 1e17 : 1.0 + i % 7); // Each large sample swamps the small ones, then leaves
+            double expected = 0.0;
+            for (double sample : window) expected += sample; // Exact enough: at most one large sample in the window
+            CHECK(std::abs(window.sum() - expected) <= 32.0);
+        }
+        for (int i = 0; i < 4; i++) window.push(0.1);
+        CHECK(std::abs(window.sum() - 0.4) < 1e-12); // The large samples left nothing behind (plain running sums end up off by units)
+        CHECK(std::abs(window.mean() - 0.1) < 1e-12);
+        CHECK(window.variance() < 1e-12);
+
+        window.resynchronize();
+        CHECK(std::abs(window.sum() - 0.4) < 1e-15);
+        CHECK(window.min() == 0.1 && window.max() == 0.1);
+    }
+}
+
+int main() {
+    integerSum();
+    floatingSum();
+
+    std::cout << "statsringbuffer: OK" << std::endl;
+    return 0;
+}
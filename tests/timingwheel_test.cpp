@@ -0,0 +1,171 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "check.h"
+#include "timingwheel.h"
+using namespace CommandaStructures;
+
+/* Random schedules, cancels and clock jumps on a TimingWheel are checked against a map of deadlines: every timer fires
+ * exactly once, at exactly its deadline, and none is left behind a jump. Delays span every level of the wheel, the clock
+ * starts at zero, just below a 32-bit boundary or at a random point, and callbacks schedule more timers while firing.
+ * The rest covers re-entrancy, exceptions thrown by callbacks, and deadlines at the very end of the 64-bit clock.
+ */
+
+namespace {
+    struct ModelTimer {
+        uint64_t deadline = 0;
+        SlotHandle handle;
+        bool gone = false; // Fired or cancelled
+    };
+
+    void modelRun(unsigned seed) {
+        std::mt19937_64 random(seed);
+        const uint64_t start = seed % 3 == 0 ? 0 : seed % 3 == 1 ? (1ull << 32) - 300 : random() % 100000;
+        TimingWheel<> wheel(start);
+        std::map<int, ModelTimer> timers;
+        std::vector<int> live;
+        int nextId = 0;
+
+        std::function<void(uint64_t)> add = [&](uint64_t deadline) {
+            const int id = nextId++;
+            timers[id].deadline = std::max(deadline, wheel.getNow() + 1); // A past deadline fires on the next tick
+            timers[id].handle = wheel.scheduleAt(deadline, [&, id] {
+                ModelTimer& timer = timers[id];
+                CHECK(!timer.gone);
+                CHECK(wheel.getNow() == timer.deadline);
+                timer.gone = true;
+                if (id % 7 == 0 && nextId < 20000) { // Schedule from inside a callback, sometimes in the past
+                    add(wheel.getNow() + random() % 600 - (id % 14 == 0 ? 3 : 0));
+                }
+            });
+            live.push_back(id);
+        };
+
+        for (int step = 0; step < 3000; step++) {
+            const int operation = static_cast<int>(random() % 10);
+            if (operation < 5) {
+                const uint64_t range = random() % 100;
+                const uint64_t delay = range < 60 ? random() % 300
+                                     : range < 90 ? random() % 70000
+                                     : range < 98 ? random() % 20000000
+                                     : random() % (1ull << 34);
+                add(wheel.getNow() + delay - (range == 0 ? std::min<uint64_t>(wheel.getNow(), 5) : 0));
+            } else if (operation < 7 && !live.empty()) {
+                const size_t pick = random() % live.size();
+                ModelTimer& timer = timers[live[pick]];
+                const bool cancelled = wheel.cancel(timer.handle);
+                CHECK(cancelled == !timer.gone);
+                CHECK(!wheel.isPending(timer.handle));
+                timer.gone = true;
+                live[pick] = live.back();
+                live.pop_back();
+            } else {
+                const uint64_t range = random() % 10;
+                const uint64_t jump = range < 6 ? random() % 50 : range < 9 ? random() % 100000 : random() % (1ull << 33);
+                const uint64_t target = wheel.getNow() + jump;
+                wheel.advance(target);
+                CHECK(wheel.getNow() == target || jump == 0);
+                for (const auto& [id, timer] : timers) CHECK(timer.gone || timer.deadline > target);
+            }
+            size_t pending = 0;
+            for (const auto& [id, timer] : timers) pending += !timer.gone;
+            CHECK(pending == wheel.getSize());
+        }
+        wheel.advance(wheel.getNow() + (1ull << 35));
+        CHECK(wheel.isEmpty());
+        for (const auto& [id, timer] : timers) CHECK(timer.gone);
+    }
+
+    void reentrancy() {
+        TimingWheel<> wheel;
+        int first = 0;
+        int sibling = 0;
+        int nested = 0;
+        SlotHandle siblingHandle;
+        wheel.schedule(5, [&] {
+            first++;
+            wheel.cancel(siblingHandle); // Cancels a timer due in the same tick
+            wheel.schedule(0, [&] { nested++; });
+        });
+        siblingHandle = wheel.schedule(5, [&] { sibling++; });
+        CHECK(wheel.advance(5) == 1);
+        CHECK(first == 1 && sibling == 0 && nested == 0);
+        CHECK(wheel.advance(6) == 1);
+        CHECK(nested == 1);
+
+        wheel.schedule(1, [] { throw 42; });
+        wheel.schedule(1, [&] { first++; });
+        CHECK_THROWS(wheel.advance(10), int);
+        CHECK(wheel.getSize() <= 1); // The timer after the throwing one may still be pending
+        wheel.advance(10);
+        CHECK(wheel.isEmpty());
+
+        bool refused = false;
+        wheel.schedule(1, [&] {
+            try {
+                wheel.advance(100);
+            } catch (const std::logic_error&) {
+                refused = true;
+            }
+        });
+        wheel.advance(20);
+        CHECK(refused); // advance() from inside a callback is refused
+
+        for (int i = 0; i < 100; i++) wheel.schedule(i * 1000, [] {});
+        wheel.clear();
+        CHECK(wheel.isEmpty());
+        CHECK(wheel.advance(1000000) == 0);
+
+        static int pointerFired = 0;
+        TimingWheel<void (*)()> pointers;
+        pointers.reserve(10);
+        pointers.schedule(3, [] { pointerFired++; });
+        pointers.advance(3);
+        CHECK(pointerFired == 1);
+    }
+
+    void endOfClock() {
+        int fired = 0;
+        TimingWheel<> wheel(UINT64_MAX - 1000);
+        const SlotHandle never = wheel.schedule(UINT64_MAX, [&] { fired += 100; }); // Saturates, never fires
+        const SlotHandle late = wheel.schedule(500, [&] { fired++; });
+        wheel.schedule(999, [&] { fired++; });
+        wheel.advance(UINT64_MAX);
+        CHECK(fired == 2);
+        CHECK(wheel.getNow() == UINT64_MAX - 1);
+        CHECK(wheel.isPending(never));
+        CHECK(!wheel.isPending(late));
+        CHECK(wheel.cancel(never));
+        CHECK(wheel.isEmpty());
+
+        TimingWheel<> wrapping(0xFFFFFFFF00000000ull - 5);
+        wrapping.schedule(3ull << 32, [&] { fired++; }); // now + delay overflows
+        wrapping.scheduleAt(UINT64_MAX - 7, [&] { fired++; });
+        wrapping.advance(UINT64_MAX);
+        CHECK(fired == 3);
+        CHECK(wrapping.getSize() == 1);
+
+        TimingWheel<> stepping(UINT64_MAX - 10);
+        stepping.schedule(5, [&] { fired++; });
+        stepping.advance(UINT64_MAX - 8);
+        stepping.advance(UINT64_MAX);
+        CHECK(fired == 4);
+    }
+}
+
+int main() {
+    for (unsigned seed = 0; seed < 30; seed++) modelRun(seed);
+    reentrancy();
+    endOfClock();
+
+    std::cout << "timingwheel: OK" << std::endl;
+    return 0;
+}
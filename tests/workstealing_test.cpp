@@ -0,0 +1,106 @@
+//
+// Created by Levi on 2026-10-17.
+//
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "check.h"
+#include "threadpool.h"
+#include "workstealingdeque.h"
+using namespace CommandaStructures;
+
+/* The WorkStealingDeque starts small so it grows while thieves are stealing, and every item has to come out exactly
+ * once. The ThreadPool runs nested fan-out (tasks submitted from inside tasks land on the worker's own deque) and has to
+ * rethrow the first task exception from wait() and stay usable afterwards.
+ */
+
+namespace {
+    void dequeRound() {
+        constexpr int items = 50000;
+        constexpr int thiefCount = 3;
+        WorkStealingDeque<int> deque(8);
+        std::vector<std::atomic<int>> seen(items);
+        std::atomic<bool> ownerDone{false};
+        std::vector<std::thread> thieves;
+        for (int t = 0; t < thiefCount; t++) {
+            thieves.emplace_back([&] {
+                int item = 0;
+                while (!ownerDone.load() || !deque.isEmpty()) {
+                    if (deque.steal(item)) seen[item]++;
+                    else std::this_thread::yield();
+                }
+            });
+        }
+        int item = 0;
+        for (int i = 0; i < items; i++) {
+            deque.push_back(i);
+            if (i % 3 == 0 && deque.pop_back(item)) seen[item]++;
+        }
+        while (deque.pop_back(item)) seen[item]++;
+        ownerDone = true;
+        for (auto& thief : thieves) thief.join();
+
+        for (int i = 0; i < items; i++) CHECK(seen[i].load() == 1);
+        CHECK(deque.isEmpty());
+        CHECK(!deque.steal(item));
+        CHECK(!deque.pop_back(item));
+        CHECK(deque.capacity() >= 8);
+    }
+
+    void poolFanOut(ThreadPool& pool) {
+        constexpr size_t samples = 200000;
+        std::atomic<long long> total{0};
+        std::atomic<int> leaves{0};
+        std::function<void(size_t, size_t)> sum = [&](size_t begin, size_t end) {
+            if (end - begin > 1000) {
+                const size_t middle = begin + (end - begin) / 2;
+                pool.submit([&, begin, middle] { sum(begin, middle); });
+                pool.submit([&, middle, end] { sum(middle, end); });
+                return;
+            }
+            long long partial = 0;
+            for (size_t i = begin; i < end; i++) partial += static_cast<long long>(i);
+            total += partial;
+            leaves++;
+        };
+        pool.submit([&] { sum(0, samples); });
+        pool.wait();
+        CHECK(total.load() == static_cast<long long>(samples) * (samples - 1) / 2);
+        CHECK(leaves.load() > 1);
+    }
+
+    void poolExceptions(ThreadPool& pool) {
+        std::atomic<int> ran{0};
+        for (int i = 0; i < 100; i++) {
+            pool.submit([&, i] {
+                ran++;
+                if (i == 50) throw std::runtime_error("task failed");
+            });
+        }
+        CHECK_THROWS(pool.wait(), std::runtime_error);
+        CHECK(ran.load() == 100); // The other tasks still ran
+
+        pool.wait(); // The exception was consumed by the previous wait()
+        std::atomic<int> after{0};
+        for (int i = 0; i < 1000; i++) pool.submit([&] { after++; });
+        pool.wait();
+        CHECK(after.load() == 1000);
+    }
+}
+
+int main() {
+    for (int round = 0; round < 3; round++) dequeRound();
+
+    ThreadPool pool(4);
+    for (int round = 0; round < 3; round++) poolFanOut(pool);
+    poolExceptions(pool);
+
+    ThreadPool single(1); // One worker: nothing to steal from, nested tasks must still all run
+    poolFanOut(single);
+
+    std::cout << "workstealing: OK" << std::endl;
+    return 0;
+}